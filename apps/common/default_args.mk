@@ -34,6 +34,20 @@ def_args_pathfinder  ?= "1 1024 64"
 def_args_roi_align   ?= "1 32 4 4 4 2 2"
 # SpMV configuration: row, col, density
 def_args_spmv        ?= "128 128 0.6"
+# Gathered elements, table size
+def_args_gather      ?= "256 4096"
+# Elements per access, largest stride (in elements)
+def_args_strided     ?= "256 8"
+# Elements per stream, largest number of independent streams
+def_args_memlat      ?= "1024 8"
+# Segments of three 32-bit fields
+def_args_segment     ?= "1024"
+# Elements per stream
+def_args_membw       ?= "4096"
+# Elements per permutation
+def_args_permute     ?= "64"
+# Largest vector length
+def_args_redlat      ?= "512"
 # Conjugate gradient size and steps
 def_args_conjugate_gradient	?= "128 0 0.5"
 # box1d, particles_per_box, alpha, maxelm
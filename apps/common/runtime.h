@@ -11,6 +11,51 @@ extern int64_t event_trigger;
 extern int64_t timer;
 // SoC-level CSR
 extern uint64_t hw_cnt_en_reg;
+// SoC-level performance counters, see hardware/src/ctrl_registers.sv
+extern volatile uint64_t perf_ctrl_reg;
+extern volatile uint64_t perf_cnt_reg[];
+// Stride prefetcher of the VLSU
+extern volatile uint64_t pf_ctrl_reg;
+
+#define PERF_CTRL_ENABLE 0x1
+#define PERF_CTRL_CLEAR 0x2
+#define PERF_CTRL_SNAPSHOT 0x4
+
+#define PF_CTRL_ENABLE 0x1
+
+// Order of the performance counters, see hardware/src/ara_soc.sv
+enum perf_cnt_e {
+  PERF_CNT_CYCLES,
+  // Vector instructions issued to each unit
+  PERF_CNT_ISSUED_VALU,
+  PERF_CNT_ISSUED_VMFPU,
+  PERF_CNT_ISSUED_SLDU,
+  PERF_CNT_ISSUED_MASKU,
+  PERF_CNT_ISSUED_VLDU,
+  PERF_CNT_ISSUED_VSTU,
+  PERF_CNT_ISSUED_NONE,
+  // Cycles each unit is running at least one instruction
+  PERF_CNT_ACTIVE_VALU,
+  PERF_CNT_ACTIVE_VMFPU,
+  PERF_CNT_ACTIVE_SLDU,
+  PERF_CNT_ACTIVE_MASKU,
+  PERF_CNT_ACTIVE_VLDU,
+  PERF_CNT_ACTIVE_VSTU,
+  // Bytes read and written by Ara on its AXI port
+  PERF_CNT_AXI_RD_BYTES,
+  PERF_CNT_AXI_WR_BYTES,
+  // VRF bank conflicts, summed over the lanes
+  PERF_CNT_VRF_CONFLICTS,
+  // Load bursts answered by the stride prefetcher and sent to the memory, and
+  // prefetched blocks
+  PERF_CNT_PF_HIT,
+  PERF_CNT_PF_MISS,
+  PERF_CNT_PF_ISSUED,
+  // Read hits and misses of the last-level cache
+  PERF_CNT_LLC_HIT,
+  PERF_CNT_LLC_MISS,
+  NR_PERF_CNT
+};
 
 // Return the current value of the cycle counter
 inline int64_t get_cycle_count() {
@@ -36,6 +81,32 @@ inline void stop_timer() { timer += get_cycle_count(); }
 
 // Get the value of the timer
 inline int64_t get_timer() { return timer; }
+
+// Start, stop, and reset the performance counters
+inline void perf_cnt_start() { perf_ctrl_reg = PERF_CTRL_ENABLE; }
+inline void perf_cnt_stop() {
+  asm volatile("fence");
+  perf_ctrl_reg = 0;
+}
+inline void perf_cnt_reset() { perf_ctrl_reg |= PERF_CTRL_CLEAR; }
+// Copy all the performance counters at once into the readable registers
+inline void perf_cnt_snapshot() {
+  asm volatile("fence");
+  perf_ctrl_reg |= PERF_CTRL_SNAPSHOT;
+  asm volatile("fence");
+}
+// Get the value of a performance counter at the last snapshot
+inline uint64_t get_perf_cnt(enum perf_cnt_e cnt) { return perf_cnt_reg[cnt]; }
+
+// Enable and disable the stride prefetcher of the VLSU
+inline void pf_enable() {
+  asm volatile("fence");
+  pf_ctrl_reg = PF_CTRL_ENABLE;
+}
+inline void pf_disable() {
+  asm volatile("fence");
+  pf_ctrl_reg = 0;
+}
 #else
 #define HW_CNT_READY ;
 #define HW_CNT_NOT_READY ;
@@ -51,6 +122,36 @@ inline void stop_timer() {
 
 // Get the value of the timer
 inline int64_t get_timer() { return 0; }
+
+// Start, stop, and reset the performance counters
+inline void perf_cnt_start() {
+  while (0)
+    ;
+}
+inline void perf_cnt_stop() {
+  while (0)
+    ;
+}
+inline void perf_cnt_reset() {
+  while (0)
+    ;
+}
+inline void perf_cnt_snapshot() {
+  while (0)
+    ;
+}
+// Get the value of a performance counter at the last snapshot
+inline uint64_t get_perf_cnt(enum perf_cnt_e cnt) { return 0; }
+
+// Enable and disable the stride prefetcher of the VLSU
+inline void pf_enable() {
+  while (0)
+    ;
+}
+inline void pf_disable() {
+  while (0)
+    ;
+}
 #endif
 
 #endif // _RUNTIME_H_
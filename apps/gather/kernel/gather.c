@@ -0,0 +1,80 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gather.h"
+
+#ifndef SPIKE
+#include "printf.h"
+#else
+#include <stdio.h>
+#endif
+
+void gather_v64b(double *dst, const double *table, const uint32_t *idx,
+                 uint64_t n) {
+  uint64_t vl;
+
+  while (n > 0) {
+    asm volatile("vsetvli %0, %1, e32, m2, ta, ma" : "=r"(vl) : "r"(n));
+    asm volatile("vle32.v v8, (%0)" ::"r"(idx));
+    asm volatile("vsetvli zero, %0, e64, m4, ta, ma" ::"r"(vl));
+    asm volatile("vloxei32.v v0, (%0), v8" ::"r"(table));
+    asm volatile("vse64.v v0, (%0)" ::"r"(dst));
+    n -= vl;
+    idx += vl;
+    dst += vl;
+  }
+}
+
+void scatter_v64b(double *table, const double *src, const uint32_t *idx,
+                  uint64_t n) {
+  uint64_t vl;
+
+  while (n > 0) {
+    asm volatile("vsetvli %0, %1, e32, m2, ta, ma" : "=r"(vl) : "r"(n));
+    asm volatile("vle32.v v8, (%0)" ::"r"(idx));
+    asm volatile("vsetvli zero, %0, e64, m4, ta, ma" ::"r"(vl));
+    asm volatile("vle64.v v0, (%0)" ::"r"(src));
+    asm volatile("vsoxei32.v v0, (%0), v8" ::"r"(table));
+    n -= vl;
+    idx += vl;
+    src += vl;
+  }
+}
+
+int gather_verify(const double *dst, const double *table, const uint32_t *idx,
+                  uint64_t n) {
+  for (uint64_t i = 0; i < n; ++i) {
+    double gold = *(const double *)((const char *)table + idx[i]);
+    if (dst[i] != gold) {
+      printf("Error: dst[%d] = %f, expected %f\n", i, dst[i], gold);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int scatter_verify(const double *table, const double *src,
+                   const uint32_t *idx, uint64_t n) {
+  for (uint64_t i = 0; i < n; ++i) {
+    double res = *(const double *)((const char *)table + idx[i]);
+    if (res != src[i]) {
+      printf("Error: table[%d] = %f, expected %f\n", idx[i] / sizeof(double),
+             res, src[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,34 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _GATHER_H_
+#define _GATHER_H_
+
+#include <stdint.h>
+
+// dst[i] = *(table + idx[i]), with idx holding byte offsets
+void gather_v64b(double *dst, const double *table, const uint32_t *idx,
+                 uint64_t n);
+// *(table + idx[i]) = src[i], with idx holding byte offsets
+void scatter_v64b(double *table, const double *src, const uint32_t *idx,
+                  uint64_t n);
+
+int gather_verify(const double *dst, const double *table, const uint32_t *idx,
+                  uint64_t n);
+int scatter_verify(const double *table, const double *src,
+                   const uint32_t *idx, uint64_t n);
+
+#endif
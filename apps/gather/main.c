@@ -0,0 +1,98 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Gather/scatter throughput as a function of the index locality
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#include "kernel/gather.h"
+
+#include "util.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Check the vector results against golden vectors
+#define CHECK 1
+
+extern uint64_t N;
+extern uint64_t M;
+
+extern double TABLE[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern double SCATTER_TABLE[]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern double GATHER_OUT[]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern uint32_t IDX_SEQ[]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern uint32_t IDX_BAND[]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern uint32_t IDX_SPARSE[]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern uint32_t IDX_RAND[]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+
+int main() {
+  printf("\n");
+  printf("============\n");
+  printf("=  GATHER  =\n");
+  printf("============\n");
+  printf("\n");
+  printf("\n");
+
+  const char *names[] = {"sequential", "band", "sparse", "random"};
+  uint32_t *idx[] = {IDX_SEQ, IDX_BAND, IDX_SPARSE, IDX_RAND};
+
+  printf("Gathering and scattering %d elements of a %d-element table.\n", N,
+         M);
+
+  for (int p = 0; p < 4; ++p) {
+    int64_t runtime;
+
+    start_timer();
+    gather_v64b(GATHER_OUT, TABLE, idx[p], N);
+    stop_timer();
+    runtime = get_timer();
+    printf("[%s] gather:  %d cycles, %f elements/cycle.\n", names[p], runtime,
+           (float)N / runtime);
+
+    start_timer();
+    scatter_v64b(SCATTER_TABLE, GATHER_OUT, idx[p], N);
+    stop_timer();
+    runtime = get_timer();
+    printf("[%s] scatter: %d cycles, %f elements/cycle.\n", names[p], runtime,
+           (float)N / runtime);
+
+    if (CHECK) {
+      if (gather_verify(GATHER_OUT, TABLE, idx[p], N) ||
+          scatter_verify(SCATTER_TABLE, GATHER_OUT, idx[p], N)) {
+        return 1;
+      }
+    }
+  }
+
+  printf("Passed.\n");
+
+  return 0;
+}
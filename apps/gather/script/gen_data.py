@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+# Copyright 2021 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generate input data for the gather/scatter benchmark
+# arg1: #elements gathered, arg2: #elements of the table
+#
+# The byte offsets of the gathered elements follow four patterns,
+# from the highest to the lowest index locality:
+# - IDX_SEQ:    contiguous elements
+# - IDX_BAND:   sorted elements picked from a band twice as large
+# - IDX_SPARSE: sorted elements picked from the whole table (SpMV row)
+# - IDX_RAND:   elements picked from the whole table, in random order
+
+import numpy as np
+import random
+import sys
+
+def emit(name, array, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  bs = array.tobytes()
+  for i in range(0, len(bs), 4):
+    s = ""
+    for n in range(4):
+      s += "%02x" % bs[i+3-n]
+    print("    .word 0x%s" % s)
+
+if len(sys.argv) == 3:
+  N = int(sys.argv[1])
+  M = int(sys.argv[2])
+else:
+  print("Error. Give me two arguments: the number of gathered elements and the table size.")
+  sys.exit()
+
+if M < 2 * N:
+  print("Error. The table must hold at least twice the gathered elements.")
+  sys.exit()
+
+dtype = np.float64
+element_byte = 8
+
+seq    = list(range(N))
+band   = sorted(random.sample(range(2 * N), N))
+sparse = sorted(random.sample(range(M), N))
+rand   = random.sample(range(M), N)
+
+# Create the file
+print(".section .data,\"aw\",@progbits")
+emit("N", np.array(N, dtype=np.uint64))
+emit("M", np.array(M, dtype=np.uint64))
+emit("TABLE", np.random.rand(M).astype(dtype), 'NR_LANES*4')
+emit("SCATTER_TABLE", np.zeros(M, dtype=dtype), 'NR_LANES*4')
+emit("GATHER_OUT", np.zeros(N, dtype=dtype), 'NR_LANES*4')
+emit("IDX_SEQ", np.array(seq, dtype=np.uint32) * element_byte, 'NR_LANES*4')
+emit("IDX_BAND", np.array(band, dtype=np.uint32) * element_byte, 'NR_LANES*4')
+emit("IDX_SPARSE", np.array(sparse, dtype=np.uint32) * element_byte, 'NR_LANES*4')
+emit("IDX_RAND", np.array(rand, dtype=np.uint32) * element_byte, 'NR_LANES*4')
@@ -17,8 +17,13 @@
 
 # Author: Matteo Perotti <mperotti@iis.ee.ethz.ch>
 
-# Decode the vector instructions replacing the register names with their actual values
+# Decode the vector instructions replacing the register names with their actual values.
+# The trace is written as gzip-compressed binary records, streamed by the ideal
+# dispatcher at run time (see hardware/tb/dpi/vtrace_reader.cc):
+#   insn (32 bits), rs1 (64 bits), rs2 (64 bits), all little-endian
 
+import gzip
+import struct
 import sys
 
 infile  = sys.argv[1]
@@ -135,7 +140,7 @@ def addRs2(disasm, args):
   return rs2
 
 # If an instruction needs a register value, fetch it from the next XRF/FRF state
-with open(infile, "r") as fin, open(outfile, "w") as fout:
+with open(infile, "r") as fin, gzip.open(outfile, "wb") as fout:
   # Read all the lines
   for line in fin:
     # Look for instructions
@@ -167,5 +172,4 @@ with open(infile, "r") as fin, open(outfile, "w") as fout:
       for reg in frf:
         if (reg in insn['regs']):
           insn['vals'] = "{}".format(frf[reg])
-    insn_out = ''
-    fout.write(insn_out.join([insn['asm'], insn['vals'], rs2]) + '\n')
+    fout.write(struct.pack('<IQQ', int(insn['asm'], 16), int(insn['vals'] or '0', 16), int(rs2, 16)))
@@ -0,0 +1,60 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "membw.h"
+
+// The chunks alternate between two register groups, so that a load does not
+// wait for the store of the previous chunk to read its register group
+
+void membw_read(const int64_t *src, uint64_t n) {
+  uint64_t vl;
+
+  for (uint64_t i = 0; i < n; i += vl) {
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(n - i));
+    asm volatile("vle64.v v0, (%0)" ::"r"(src + i));
+    i += vl;
+    if (i >= n) break;
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(n - i));
+    asm volatile("vle64.v v8, (%0)" ::"r"(src + i));
+  }
+}
+
+void membw_write(int64_t *dst, int64_t val, uint64_t n) {
+  uint64_t vl;
+
+  asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(n));
+  asm volatile("vmv.v.x v0, %0" ::"r"(val));
+  for (uint64_t i = 0; i < n; i += vl) {
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(n - i));
+    asm volatile("vse64.v v0, (%0)" ::"r"(dst + i));
+  }
+}
+
+void membw_copy(int64_t *dst, const int64_t *src, uint64_t n) {
+  uint64_t vl;
+
+  for (uint64_t i = 0; i < n; i += vl) {
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(n - i));
+    asm volatile("vle64.v v0, (%0)" ::"r"(src + i));
+    asm volatile("vse64.v v0, (%0)" ::"r"(dst + i));
+    i += vl;
+    if (i >= n) break;
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(n - i));
+    asm volatile("vle64.v v8, (%0)" ::"r"(src + i));
+    asm volatile("vse64.v v8, (%0)" ::"r"(dst + i));
+  }
+}
@@ -0,0 +1,31 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef _MEMBW_H_
+#define _MEMBW_H_
+
+#include <stdint.h>
+
+// Load the n elements of src
+void membw_read(const int64_t *src, uint64_t n);
+// Store the n elements of dst, all set to val
+void membw_write(int64_t *dst, int64_t val, uint64_t n);
+// Copy the n elements of src to dst, with the loads of a chunk overlapping
+// the stores of the previous one
+void membw_copy(int64_t *dst, const int64_t *src, uint64_t n);
+
+#endif
@@ -0,0 +1,101 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Sustained L2 bandwidth of read, write, and mixed (copy) vector streams
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#include "kernel/membw.h"
+
+#include "util.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Check the vector results against golden vectors
+#define CHECK 1
+
+// Value stored by the write stream
+#define WRITE_VAL 0x5a5a5a5a5a5a5a5aLL
+
+extern uint64_t N;
+
+extern int64_t SRC[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern int64_t DST[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+
+int main() {
+  printf("\n");
+  printf("===========\n");
+  printf("=  MEMBW  =\n");
+  printf("===========\n");
+  printf("\n");
+  printf("\n");
+
+  printf("Streams of %d elements, bytes/cycle:\n", N);
+  printf("stream bytes/cycle\n");
+
+  // Read
+  start_timer();
+  membw_read(SRC, N);
+  stop_timer();
+  int64_t runtime = get_timer();
+  printf("read   %f\n", (float)(N * sizeof(int64_t)) / runtime);
+
+  // Write
+  start_timer();
+  membw_write(DST, WRITE_VAL, N);
+  stop_timer();
+  runtime = get_timer();
+  printf("write  %f\n", (float)(N * sizeof(int64_t)) / runtime);
+
+  if (CHECK) {
+    for (uint64_t i = 0; i < N; ++i) {
+      if (DST[i] != WRITE_VAL) {
+        printf("Error: write, element %d\n", i);
+        return 1;
+      }
+    }
+  }
+
+  // Mixed: every element is read and written
+  start_timer();
+  membw_copy(DST, SRC, N);
+  stop_timer();
+  runtime = get_timer();
+  printf("mixed  %f\n", (float)(2 * N * sizeof(int64_t)) / runtime);
+
+  if (CHECK) {
+    for (uint64_t i = 0; i < N; ++i) {
+      if (DST[i] != SRC[i]) {
+        printf("Error: mixed, element %d\n", i);
+        return 1;
+      }
+    }
+  }
+
+  printf("Passed.\n");
+
+  return 0;
+}
@@ -0,0 +1,98 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "memlat.h"
+
+// Every stream is loaded into its own register group, so that the loads of
+// different streams can be in flight at the same time
+
+void memlat_load(const int64_t *src, uint64_t k, uint64_t n) {
+  uint64_t vl;
+
+  for (uint64_t i = 0; i < n; i += vl) {
+    const int64_t *p = src + i;
+    asm volatile("vsetvli %0, %1, e64, m4, ta, ma" : "=r"(vl) : "r"(n - i));
+    switch (k) {
+      case 8:
+        asm volatile("vle64.v v28, (%0)" ::"r"(p + 7 * n));
+        // fall through
+      case 7:
+        asm volatile("vle64.v v24, (%0)" ::"r"(p + 6 * n));
+        // fall through
+      case 6:
+        asm volatile("vle64.v v20, (%0)" ::"r"(p + 5 * n));
+        // fall through
+      case 5:
+        asm volatile("vle64.v v16, (%0)" ::"r"(p + 4 * n));
+        // fall through
+      case 4:
+        asm volatile("vle64.v v12, (%0)" ::"r"(p + 3 * n));
+        // fall through
+      case 3:
+        asm volatile("vle64.v v8, (%0)" ::"r"(p + 2 * n));
+        // fall through
+      case 2:
+        asm volatile("vle64.v v4, (%0)" ::"r"(p + n));
+        // fall through
+      default:
+        asm volatile("vle64.v v0, (%0)" ::"r"(p));
+    }
+  }
+}
+
+void memlat_copy(int64_t *dst, const int64_t *src, uint64_t k, uint64_t n) {
+  uint64_t vl;
+
+  for (uint64_t i = 0; i < n; i += vl) {
+    const int64_t *p = src + i;
+    int64_t *q = dst + i;
+    asm volatile("vsetvli %0, %1, e64, m4, ta, ma" : "=r"(vl) : "r"(n - i));
+    switch (k) {
+      case 8:
+        asm volatile("vle64.v v28, (%0)" ::"r"(p + 7 * n));
+        asm volatile("vse64.v v28, (%0)" ::"r"(q + 7 * n));
+        // fall through
+      case 7:
+        asm volatile("vle64.v v24, (%0)" ::"r"(p + 6 * n));
+        asm volatile("vse64.v v24, (%0)" ::"r"(q + 6 * n));
+        // fall through
+      case 6:
+        asm volatile("vle64.v v20, (%0)" ::"r"(p + 5 * n));
+        asm volatile("vse64.v v20, (%0)" ::"r"(q + 5 * n));
+        // fall through
+      case 5:
+        asm volatile("vle64.v v16, (%0)" ::"r"(p + 4 * n));
+        asm volatile("vse64.v v16, (%0)" ::"r"(q + 4 * n));
+        // fall through
+      case 4:
+        asm volatile("vle64.v v12, (%0)" ::"r"(p + 3 * n));
+        asm volatile("vse64.v v12, (%0)" ::"r"(q + 3 * n));
+        // fall through
+      case 3:
+        asm volatile("vle64.v v8, (%0)" ::"r"(p + 2 * n));
+        asm volatile("vse64.v v8, (%0)" ::"r"(q + 2 * n));
+        // fall through
+      case 2:
+        asm volatile("vle64.v v4, (%0)" ::"r"(p + n));
+        asm volatile("vse64.v v4, (%0)" ::"r"(q + n));
+        // fall through
+      default:
+        asm volatile("vle64.v v0, (%0)" ::"r"(p));
+        asm volatile("vse64.v v0, (%0)" ::"r"(q));
+    }
+  }
+}
@@ -0,0 +1,30 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef _MEMLAT_H_
+#define _MEMLAT_H_
+
+#include <stdint.h>
+
+// Up to 8 streams
+// Load n elements from each of the k streams of src, stored back-to-back.
+// The loads of different streams do not depend on each other.
+void memlat_load(const int64_t *src, uint64_t k, uint64_t n);
+// Same as memlat_load, and store the k streams to dst
+void memlat_copy(int64_t *dst, const int64_t *src, uint64_t k, uint64_t n);
+
+#endif
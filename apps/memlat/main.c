@@ -0,0 +1,82 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Load bandwidth as a function of the number of independent load streams
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#include "kernel/memlat.h"
+
+#include "util.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Check the vector results against golden vectors
+#define CHECK 1
+
+extern uint64_t N;
+extern uint64_t MAX_STREAMS;
+
+extern int64_t SRC[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern int64_t DST[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+
+int main() {
+  printf("\n");
+  printf("============\n");
+  printf("=  MEMLAT  =\n");
+  printf("============\n");
+  printf("\n");
+  printf("\n");
+
+  printf("Loads of %d elements per stream, bytes/cycle:\n", N);
+  printf("streams bytes/cycle\n");
+
+  for (uint64_t k = 1; k <= MAX_STREAMS; ++k) {
+    start_timer();
+    memlat_load(SRC, k, N);
+    stop_timer();
+    int64_t runtime = get_timer();
+
+    if (CHECK) {
+      // Same access pattern, with the streams written back
+      memlat_copy(DST, SRC, k, N);
+      for (uint64_t s = 0; s < k; ++s) {
+        for (uint64_t i = 0; i < N; ++i) {
+          if (DST[s * N + i] != SRC[s * N + i]) {
+            printf("Error: %d streams, stream %d, element %d\n", k, s, i);
+            return 1;
+          }
+        }
+      }
+    }
+
+    printf("%7d %f\n", k, (float)(k * N * sizeof(int64_t)) / runtime);
+  }
+
+  printf("Passed.\n");
+
+  return 0;
+}
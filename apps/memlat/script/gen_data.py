@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+# Copyright 2021 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generate input data for the memlat benchmark
+# arg1: #elements per stream, arg2: largest number of streams (up to 8)
+
+import numpy as np
+import sys
+
+def emit(name, array, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  bs = array.tobytes()
+  for i in range(0, len(bs), 4):
+    s = ""
+    for n in range(4):
+      s += "%02x" % bs[i+3-n]
+    print("    .word 0x%s" % s)
+
+if len(sys.argv) == 3:
+  N = int(sys.argv[1])
+  K = int(sys.argv[2])
+else:
+  print("Error. Give me two arguments: the number of elements per stream and the largest number of streams.")
+  sys.exit()
+
+if K < 1 or K > 8:
+  print("Error. The number of streams must be between 1 and 8.")
+  sys.exit()
+
+# Create the file
+print(".section .data,\"aw\",@progbits")
+emit("N", np.array(N, dtype=np.uint64))
+emit("MAX_STREAMS", np.array(K, dtype=np.uint64))
+emit("SRC", np.random.randint(0, 2**63, size=N*K, dtype=np.int64), 'NR_LANES*4')
+emit("DST", np.zeros(N*K, dtype=np.int64), 'NR_LANES*4')
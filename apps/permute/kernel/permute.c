@@ -0,0 +1,51 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "permute.h"
+
+void permute_vrgather(uint32_t *dst, const uint32_t *src, const uint16_t *idx,
+                      uint64_t vl, uint64_t reps) {
+  asm volatile("vsetvli zero, %0, e16, m2, ta, ma" ::"r"(vl));
+  asm volatile("vle16.v v16, (%0)" ::"r"(idx));
+  asm volatile("vsetvli zero, %0, e32, m4, ta, ma" ::"r"(vl));
+  asm volatile("vle32.v v0, (%0)" ::"r"(src));
+
+  for (uint64_t r = 0; r < reps; ++r) {
+    asm volatile("vrgatherei16.vv v8, v0, v16");
+  }
+
+  asm volatile("vse32.v v8, (%0)" ::"r"(dst));
+}
+
+void permute_vcompress(uint32_t *dst, const uint32_t *src,
+                       const uint8_t *mask, uint64_t vl, uint64_t reps,
+                       uint64_t *cnt) {
+  uint64_t n;
+
+  asm volatile("vsetvli zero, %0, e32, m4, ta, ma" ::"r"(vl));
+  asm volatile("vlm.v v24, (%0)" ::"r"(mask));
+  asm volatile("vle32.v v0, (%0)" ::"r"(src));
+
+  for (uint64_t r = 0; r < reps; ++r) {
+    asm volatile("vcompress.vm v8, v0, v24");
+  }
+
+  asm volatile("vcpop.m %0, v24" : "=r"(n));
+  asm volatile("vsetvli zero, %0, e32, m4, ta, ma" ::"r"(n));
+  asm volatile("vse32.v v8, (%0)" ::"r"(dst));
+  *cnt = n;
+}
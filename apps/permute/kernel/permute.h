@@ -0,0 +1,34 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef _PERMUTE_H_
+#define _PERMUTE_H_
+
+#include <stdint.h>
+
+// The operands are loaded once, and permuted reps times in the vector
+// registers. The last result is stored to dst.
+
+// dst[i] = src[idx[i]], for the vl elements of src
+void permute_vrgather(uint32_t *dst, const uint32_t *src, const uint16_t *idx,
+                      uint64_t vl, uint64_t reps);
+// Pack the elements of src enabled by mask into dst, return how many
+void permute_vcompress(uint32_t *dst, const uint32_t *src,
+                       const uint8_t *mask, uint64_t vl, uint64_t reps,
+                       uint64_t *cnt);
+
+#endif
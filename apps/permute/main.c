@@ -0,0 +1,118 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Throughput of the vector permutations (vrgather, vcompress) executed by the
+// mask unit, in elements per cycle
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#include "kernel/permute.h"
+
+#include "util.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Check the vector results against golden vectors
+#define CHECK 1
+
+// Permutations executed back to back for each measure
+#define REPS 16
+
+extern uint64_t N;
+
+extern uint32_t SRC[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern uint32_t DST[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern uint16_t IDX_IDENTITY[]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern uint16_t IDX_BITREV[]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern uint16_t IDX_RAND[]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern uint16_t IDX_SPLAT[]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern uint8_t MASK[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+
+int main() {
+  printf("\n");
+  printf("=============\n");
+  printf("=  PERMUTE  =\n");
+  printf("=============\n");
+  printf("\n");
+  printf("\n");
+
+  const char *names[] = {"identity", "bitrev", "random", "splat"};
+  uint16_t *idx[] = {IDX_IDENTITY, IDX_BITREV, IDX_RAND, IDX_SPLAT};
+
+  printf("%d lanes, permutations of %d 32-bit elements, elements/cycle:\n",
+         NR_LANES, N);
+  printf("pattern   elements/cycle\n");
+
+  for (int p = 0; p < 4; ++p) {
+    start_timer();
+    permute_vrgather(DST, SRC, idx[p], N, REPS);
+    stop_timer();
+    int64_t runtime = get_timer();
+    printf("%-9s %f\n", names[p], (float)(REPS * N) / runtime);
+
+    if (CHECK) {
+      for (uint64_t i = 0; i < N; ++i) {
+        if (DST[i] != SRC[idx[p][i]]) {
+          printf("Error: %s, element %d\n", names[p], i);
+          return 1;
+        }
+      }
+    }
+  }
+
+  // VCOMPRESS: the rate is measured on the source elements
+  uint64_t cnt;
+  start_timer();
+  permute_vcompress(DST, SRC, MASK, N, REPS, &cnt);
+  stop_timer();
+  int64_t runtime = get_timer();
+  printf("%-9s %f\n", "compress", (float)(REPS * N) / runtime);
+
+  if (CHECK) {
+    uint64_t j = 0;
+    for (uint64_t i = 0; i < N; ++i) {
+      if ((MASK[i / 8] >> (i % 8)) & 1) {
+        if (DST[j] != SRC[i]) {
+          printf("Error: compress, element %d\n", j);
+          return 1;
+        }
+        ++j;
+      }
+    }
+    if (j != cnt) {
+      printf("Error: compress, %d elements instead of %d\n", cnt, j);
+      return 1;
+    }
+  }
+
+  printf("Passed.\n");
+
+  return 0;
+}
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+# Copyright 2021 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# arg1: #elements per permutation, at most VLMAX for e32 and LMUL=4
+
+import numpy as np
+import sys
+
+def emit(name, array, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  bs = array.tobytes()
+  for i in range(0, len(bs), 4):
+    s = ""
+    for n in range(4):
+      s += "%02x" % bs[i+3-n]
+    print("    .word 0x%s" % s)
+
+# Pad to a multiple of 32 bits
+def pad(array):
+  return np.concatenate((array, np.zeros((-array.nbytes) % 4 // array.itemsize, dtype=array.dtype)))
+
+if len(sys.argv) == 2:
+  N = int(sys.argv[1])
+else:
+  print("Error. Give me one argument: the number of elements per permutation.")
+  sys.exit()
+
+# Bit-reversed indices (FFT reordering), for the power of two below N
+bits = max(int(N).bit_length() - 1, 0)
+bitrev = np.array([int(format(i % (1 << bits), '0%db' % bits)[::-1] or '0', 2) for i in range(N)], dtype=np.uint16)
+
+# Create the file
+print(".section .data,\"aw\",@progbits")
+emit("N", np.array(N, dtype=np.uint64))
+emit("SRC", np.random.randint(0, 2**32, size=N, dtype=np.uint64).astype(np.uint32), 'NR_LANES*4')
+emit("DST", np.zeros(N, dtype=np.uint32), 'NR_LANES*4')
+emit("IDX_IDENTITY", pad(np.arange(N, dtype=np.uint16)), 'NR_LANES*4')
+emit("IDX_BITREV", pad(bitrev), 'NR_LANES*4')
+emit("IDX_RAND", pad(np.random.permutation(N).astype(np.uint16)), 'NR_LANES*4')
+emit("IDX_SPLAT", pad(np.zeros(N, dtype=np.uint16)), 'NR_LANES*4')
+emit("MASK", pad(np.packbits(np.random.randint(0, 2, size=N, dtype=np.uint8), bitorder='little')), 'NR_LANES*4')
@@ -0,0 +1,65 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "redlat.h"
+
+// The source operands are loaded in v8, the scalar operand and the result of
+// the reductions live in v0. Every reduction is followed by a move to the
+// scalar core, which waits for the result to be written back.
+
+void redlat_load_i64(const int64_t *src, uint64_t vl) {
+  asm volatile("vsetvli zero, %0, e64, m8, ta, ma" ::"r"(vl));
+  asm volatile("vle64.v v8, (%0)" ::"r"(src));
+}
+
+void redlat_load_f64(const double *src, uint64_t vl) {
+  asm volatile("vsetvli zero, %0, e64, m8, ta, ma" ::"r"(vl));
+  asm volatile("vle64.v v8, (%0)" ::"r"(src));
+}
+
+int64_t redlat_vredsum(uint64_t vl) {
+  int64_t red;
+
+  asm volatile("vsetvli zero, %0, e64, m8, ta, ma" ::"r"(vl));
+  asm volatile("vmv.s.x v0, zero");
+  asm volatile("vredsum.vs v0, v8, v0");
+  asm volatile("vmv.x.s %0, v0" : "=r"(red));
+
+  return red;
+}
+
+double redlat_vfredusum(uint64_t vl) {
+  double red;
+
+  asm volatile("vsetvli zero, %0, e64, m8, ta, ma" ::"r"(vl));
+  asm volatile("vmv.s.x v0, zero");
+  asm volatile("vfredusum.vs v0, v8, v0");
+  asm volatile("vfmv.f.s %0, v0" : "=f"(red));
+
+  return red;
+}
+
+double redlat_vfredosum(uint64_t vl) {
+  double red;
+
+  asm volatile("vsetvli zero, %0, e64, m8, ta, ma" ::"r"(vl));
+  asm volatile("vmv.s.x v0, zero");
+  asm volatile("vfredosum.vs v0, v8, v0");
+  asm volatile("vfmv.f.s %0, v0" : "=f"(red));
+
+  return red;
+}
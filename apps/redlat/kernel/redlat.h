@@ -0,0 +1,32 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef _REDLAT_H_
+#define _REDLAT_H_
+
+#include <stdint.h>
+
+// Load vl elements of src into the source register group of the reductions
+void redlat_load_i64(const int64_t *src, uint64_t vl);
+void redlat_load_f64(const double *src, uint64_t vl);
+// Reduce the first vl elements of the source register group, and move the
+// result to the scalar core, so that the whole reduction tail is measured
+int64_t redlat_vredsum(uint64_t vl);
+double redlat_vfredusum(uint64_t vl);
+double redlat_vfredosum(uint64_t vl);
+
+#endif
@@ -0,0 +1,100 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Latency of the reductions as a function of the vector length
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#include "kernel/redlat.h"
+
+#include "util.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Check the vector results against golden values
+#define CHECK 1
+
+extern uint64_t N;
+
+extern int64_t ISRC[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern double FSRC[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+
+int main() {
+  printf("\n");
+  printf("============\n");
+  printf("=  REDLAT  =\n");
+  printf("============\n");
+  printf("\n");
+  printf("\n");
+
+  // An LMUL=8 register group holds at most VLEN/8 elements of 64 bits
+  uint64_t max_vl = N < VLEN / 8 ? N : VLEN / 8;
+
+  printf("Reduction latency, cycles:\n");
+  printf("     vl vredsum vfredusum vfredosum\n");
+
+  for (uint64_t vl = 1; vl <= max_vl; vl *= 2) {
+    int64_t ired;
+    double ured, ored;
+
+    redlat_load_i64(ISRC, vl);
+    start_timer();
+    ired = redlat_vredsum(vl);
+    stop_timer();
+    int64_t iruntime = get_timer();
+
+    redlat_load_f64(FSRC, vl);
+    start_timer();
+    ured = redlat_vfredusum(vl);
+    stop_timer();
+    int64_t uruntime = get_timer();
+
+    start_timer();
+    ored = redlat_vfredosum(vl);
+    stop_timer();
+    int64_t oruntime = get_timer();
+
+    if (CHECK) {
+      int64_t igold = 0;
+      double fgold = 0;
+      for (uint64_t i = 0; i < vl; ++i) {
+        igold += ISRC[i];
+        fgold += FSRC[i];
+      }
+      // The FP sources are small integers, so every summation order is exact
+      if (ired != igold || ured != fgold || ored != fgold) {
+        printf("Error: vl = %d\n", vl);
+        return 1;
+      }
+    }
+
+    printf("%7d %7d %9d %9d\n", vl, iruntime, uruntime, oruntime);
+  }
+
+  printf("Passed.\n");
+
+  return 0;
+}
@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+# Copyright 2021 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generate input data for the redlat benchmark
+# arg1: largest vector length
+
+import numpy as np
+import sys
+
+def emit(name, array, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  bs = array.tobytes()
+  for i in range(0, len(bs), 4):
+    s = ""
+    for n in range(4):
+      s += "%02x" % bs[i+3-n]
+    print("    .word 0x%s" % s)
+
+if len(sys.argv) == 2:
+  N = int(sys.argv[1])
+else:
+  print("Error. Give me one argument: the largest vector length.")
+  sys.exit()
+
+# Create the file
+print(".section .data,\"aw\",@progbits")
+emit("N", np.array(N, dtype=np.uint64))
+emit("ISRC", np.random.randint(-2**31, 2**31, size=N, dtype=np.int64), 'NR_LANES*4')
+# Small integers, so that the FP sums are exact in any order
+emit("FSRC", np.random.randint(-2**20, 2**20, size=N).astype(np.float64), 'NR_LANES*4')
@@ -0,0 +1,107 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segment.h"
+
+// The fields live in the register groups v0, v4, and v8
+
+void segment_vlseg(const int32_t *src, uint64_t n) {
+  uint64_t vl;
+
+  for (uint64_t i = 0; i < n; i += vl) {
+    asm volatile("vsetvli %0, %1, e32, m4, ta, ma" : "=r"(vl) : "r"(n - i));
+    asm volatile("vlseg3e32.v v0, (%0)" ::"r"(src + 3 * i));
+  }
+}
+
+void segment_vlse(const int32_t *src, uint64_t n) {
+  const uint64_t stride = 3 * sizeof(int32_t);
+  uint64_t vl;
+
+  for (uint64_t i = 0; i < n; i += vl) {
+    const int32_t *p = src + 3 * i;
+    asm volatile("vsetvli %0, %1, e32, m4, ta, ma" : "=r"(vl) : "r"(n - i));
+    asm volatile("vlse32.v v0, (%0), %1" ::"r"(p), "r"(stride));
+    asm volatile("vlse32.v v4, (%0), %1" ::"r"(p + 1), "r"(stride));
+    asm volatile("vlse32.v v8, (%0), %1" ::"r"(p + 2), "r"(stride));
+  }
+}
+
+void segment_vle(const int32_t *src, uint64_t n) {
+  uint64_t vl;
+
+  for (uint64_t i = 0; i < 3 * n; i += vl) {
+    asm volatile("vsetvli %0, %1, e32, m4, ta, ma" : "=r"(vl) : "r"(3 * n - i));
+    asm volatile("vle32.v v0, (%0)" ::"r"(src + i));
+  }
+}
+
+void segment_vsseg(int32_t *dst, uint64_t n) {
+  uint64_t vl;
+
+  for (uint64_t i = 0; i < n; i += vl) {
+    asm volatile("vsetvli %0, %1, e32, m4, ta, ma" : "=r"(vl) : "r"(n - i));
+    asm volatile("vsseg3e32.v v0, (%0)" ::"r"(dst + 3 * i));
+  }
+}
+
+void segment_vsse(int32_t *dst, uint64_t n) {
+  const uint64_t stride = 3 * sizeof(int32_t);
+  uint64_t vl;
+
+  for (uint64_t i = 0; i < n; i += vl) {
+    int32_t *p = dst + 3 * i;
+    asm volatile("vsetvli %0, %1, e32, m4, ta, ma" : "=r"(vl) : "r"(n - i));
+    asm volatile("vsse32.v v0, (%0), %1" ::"r"(p), "r"(stride));
+    asm volatile("vsse32.v v4, (%0), %1" ::"r"(p + 1), "r"(stride));
+    asm volatile("vsse32.v v8, (%0), %1" ::"r"(p + 2), "r"(stride));
+  }
+}
+
+void segment_vse(int32_t *dst, uint64_t n) {
+  uint64_t vl;
+
+  for (uint64_t i = 0; i < 3 * n; i += vl) {
+    asm volatile("vsetvli %0, %1, e32, m4, ta, ma" : "=r"(vl) : "r"(3 * n - i));
+    asm volatile("vse32.v v0, (%0)" ::"r"(dst + i));
+  }
+}
+
+void segment_deinterleave(int32_t *x, int32_t *y, int32_t *z,
+                          const int32_t *src, uint64_t n) {
+  uint64_t vl;
+
+  for (uint64_t i = 0; i < n; i += vl) {
+    asm volatile("vsetvli %0, %1, e32, m4, ta, ma" : "=r"(vl) : "r"(n - i));
+    asm volatile("vlseg3e32.v v0, (%0)" ::"r"(src + 3 * i));
+    asm volatile("vse32.v v0, (%0)" ::"r"(x + i));
+    asm volatile("vse32.v v4, (%0)" ::"r"(y + i));
+    asm volatile("vse32.v v8, (%0)" ::"r"(z + i));
+  }
+}
+
+void segment_interleave(int32_t *dst, const int32_t *x, const int32_t *y,
+                        const int32_t *z, uint64_t n) {
+  uint64_t vl;
+
+  for (uint64_t i = 0; i < n; i += vl) {
+    asm volatile("vsetvli %0, %1, e32, m4, ta, ma" : "=r"(vl) : "r"(n - i));
+    asm volatile("vle32.v v0, (%0)" ::"r"(x + i));
+    asm volatile("vle32.v v4, (%0)" ::"r"(y + i));
+    asm volatile("vle32.v v8, (%0)" ::"r"(z + i));
+    asm volatile("vsseg3e32.v v0, (%0)" ::"r"(dst + 3 * i));
+  }
+}
@@ -0,0 +1,42 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef _SEGMENT_H_
+#define _SEGMENT_H_
+
+#include <stdint.h>
+
+// An array of n segments of three 32-bit fields (e.g., xyz coordinates) is
+// accessed as three vectors, one per field, in three different ways:
+// - vlseg/vsseg: segment loads/stores
+// - vlse/vsse: one strided access per field
+// - vle/vse: unit-stride accesses to the same bytes, without deinterleaving
+void segment_vlseg(const int32_t *src, uint64_t n);
+void segment_vlse(const int32_t *src, uint64_t n);
+void segment_vle(const int32_t *src, uint64_t n);
+void segment_vsseg(int32_t *dst, uint64_t n);
+void segment_vsse(int32_t *dst, uint64_t n);
+void segment_vse(int32_t *dst, uint64_t n);
+
+// Split the n segments of src into the fields x, y, z
+void segment_deinterleave(int32_t *x, int32_t *y, int32_t *z,
+                          const int32_t *src, uint64_t n);
+// Merge the fields x, y, z into the n segments of dst
+void segment_interleave(int32_t *dst, const int32_t *x, const int32_t *y,
+                        const int32_t *z, uint64_t n);
+
+#endif
@@ -0,0 +1,114 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Segment loads/stores against strided and unit-stride accesses to the same
+// array of segments
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#include "kernel/segment.h"
+
+#include "util.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Check the vector results against golden vectors
+#define CHECK 1
+
+extern uint64_t N;
+
+extern int32_t SRC[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern int32_t DST[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern int32_t X[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern int32_t Y[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern int32_t Z[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+
+int main() {
+  printf("\n");
+  printf("=============\n");
+  printf("=  SEGMENT  =\n");
+  printf("=============\n");
+  printf("\n");
+  printf("\n");
+
+  const uint64_t bytes = 3 * N * sizeof(int32_t);
+  int64_t runtime;
+
+  printf("%d segments of three 32-bit fields, bytes/cycle:\n", N);
+  printf("access       load   store\n");
+
+  start_timer();
+  segment_vlseg(SRC, N);
+  stop_timer();
+  runtime = get_timer();
+  start_timer();
+  segment_vsseg(DST, N);
+  stop_timer();
+  printf("segment    %f %f\n", (float)bytes / runtime,
+         (float)bytes / get_timer());
+
+  start_timer();
+  segment_vlse(SRC, N);
+  stop_timer();
+  runtime = get_timer();
+  start_timer();
+  segment_vsse(DST, N);
+  stop_timer();
+  printf("strided    %f %f\n", (float)bytes / runtime,
+         (float)bytes / get_timer());
+
+  start_timer();
+  segment_vle(SRC, N);
+  stop_timer();
+  runtime = get_timer();
+  start_timer();
+  segment_vse(DST, N);
+  stop_timer();
+  printf("unit-stride %f %f\n", (float)bytes / runtime,
+         (float)bytes / get_timer());
+
+  if (CHECK) {
+    segment_deinterleave(X, Y, Z, SRC, N);
+    for (uint64_t i = 0; i < N; ++i) {
+      if (X[i] != SRC[3 * i] || Y[i] != SRC[3 * i + 1] ||
+          Z[i] != SRC[3 * i + 2]) {
+        printf("Error: segment load, segment %d\n", i);
+        return 1;
+      }
+    }
+    segment_interleave(DST, X, Y, Z, N);
+    for (uint64_t i = 0; i < 3 * N; ++i) {
+      if (DST[i] != SRC[i]) {
+        printf("Error: segment store, element %d\n", i);
+        return 1;
+      }
+    }
+  }
+
+  printf("Passed.\n");
+
+  return 0;
+}
@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+# Copyright 2021 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generate input data for the segment benchmark
+# arg1: #segments (three 32-bit fields each)
+
+import numpy as np
+import sys
+
+def emit(name, array, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  bs = array.tobytes()
+  for i in range(0, len(bs), 4):
+    s = ""
+    for n in range(4):
+      s += "%02x" % bs[i+3-n]
+    print("    .word 0x%s" % s)
+
+if len(sys.argv) == 2:
+  N = int(sys.argv[1])
+else:
+  print("Error. Give me one argument: the number of segments.")
+  sys.exit()
+
+# Create the file
+print(".section .data,\"aw\",@progbits")
+emit("N", np.array(N, dtype=np.uint64))
+emit("SRC", np.random.randint(-2**31, 2**31, size=3*N, dtype=np.int32), 'NR_LANES*4')
+emit("DST", np.zeros(3*N, dtype=np.int32), 'NR_LANES*4')
+emit("X", np.zeros(N, dtype=np.int32), 'NR_LANES*4')
+emit("Y", np.zeros(N, dtype=np.int32), 'NR_LANES*4')
+emit("Z", np.zeros(N, dtype=np.int32), 'NR_LANES*4')
@@ -0,0 +1,75 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "strided.h"
+
+// The strides are expressed in elements
+
+void vlse_v64b(int64_t *dst, const int64_t *src, uint64_t stride, uint64_t n) {
+  uint64_t vl;
+  uint64_t stride_b = stride * sizeof(int64_t);
+
+  while (n > 0) {
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(n));
+    asm volatile("vlse64.v v0, (%0), %1" ::"r"(src), "r"(stride_b));
+    asm volatile("vse64.v v0, (%0)" ::"r"(dst));
+    n -= vl;
+    src += vl * stride;
+    dst += vl;
+  }
+}
+
+void vlse_v32b(int32_t *dst, const int32_t *src, uint64_t stride, uint64_t n) {
+  uint64_t vl;
+  uint64_t stride_b = stride * sizeof(int32_t);
+
+  while (n > 0) {
+    asm volatile("vsetvli %0, %1, e32, m8, ta, ma" : "=r"(vl) : "r"(n));
+    asm volatile("vlse32.v v0, (%0), %1" ::"r"(src), "r"(stride_b));
+    asm volatile("vse32.v v0, (%0)" ::"r"(dst));
+    n -= vl;
+    src += vl * stride;
+    dst += vl;
+  }
+}
+
+void vsse_v64b(int64_t *dst, const int64_t *src, uint64_t stride, uint64_t n) {
+  uint64_t vl;
+  uint64_t stride_b = stride * sizeof(int64_t);
+
+  while (n > 0) {
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(n));
+    asm volatile("vle64.v v0, (%0)" ::"r"(src));
+    asm volatile("vsse64.v v0, (%0), %1" ::"r"(dst), "r"(stride_b));
+    n -= vl;
+    src += vl;
+    dst += vl * stride;
+  }
+}
+
+void vsse_v32b(int32_t *dst, const int32_t *src, uint64_t stride, uint64_t n) {
+  uint64_t vl;
+  uint64_t stride_b = stride * sizeof(int32_t);
+
+  while (n > 0) {
+    asm volatile("vsetvli %0, %1, e32, m8, ta, ma" : "=r"(vl) : "r"(n));
+    asm volatile("vle32.v v0, (%0)" ::"r"(src));
+    asm volatile("vsse32.v v0, (%0), %1" ::"r"(dst), "r"(stride_b));
+    n -= vl;
+    src += vl;
+    dst += vl * stride;
+  }
+}
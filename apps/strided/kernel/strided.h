@@ -0,0 +1,29 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _STRIDED_H_
+#define _STRIDED_H_
+
+#include <stdint.h>
+
+// dst[i] = src[i * stride], for elements of 64 and 32 bits
+void vlse_v64b(int64_t *dst, const int64_t *src, uint64_t stride, uint64_t n);
+void vlse_v32b(int32_t *dst, const int32_t *src, uint64_t stride, uint64_t n);
+// dst[i * stride] = src[i], for elements of 64 and 32 bits
+void vsse_v64b(int64_t *dst, const int64_t *src, uint64_t stride, uint64_t n);
+void vsse_v32b(int32_t *dst, const int32_t *src, uint64_t stride, uint64_t n);
+
+#endif
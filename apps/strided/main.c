@@ -0,0 +1,111 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Strided load/store throughput as a function of the stride
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#include "kernel/strided.h"
+
+#include "util.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Check the vector results against golden vectors
+#define CHECK 1
+
+extern uint64_t N;
+extern uint64_t MAX_STRIDE;
+
+extern int64_t SRC[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern int64_t DST[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern int64_t BUF[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+
+int main() {
+  printf("\n");
+  printf("=============\n");
+  printf("=  STRIDED  =\n");
+  printf("=============\n");
+  printf("\n");
+  printf("\n");
+
+  int32_t *src32 = (int32_t *)SRC;
+  int32_t *dst32 = (int32_t *)DST;
+  int32_t *buf32 = (int32_t *)BUF;
+
+  printf("Strided accesses of %d elements, elements/cycle:\n", N);
+  printf("stride vlse64   vsse64   vlse32   vsse32\n");
+
+  for (uint64_t stride = 1; stride <= MAX_STRIDE; ++stride) {
+    int64_t runtime[4];
+
+    start_timer();
+    vlse_v64b(BUF, SRC, stride, N);
+    stop_timer();
+    runtime[0] = get_timer();
+
+    start_timer();
+    vsse_v64b(DST, BUF, stride, N);
+    stop_timer();
+    runtime[1] = get_timer();
+
+    if (CHECK) {
+      for (uint64_t i = 0; i < N; ++i) {
+        if (BUF[i] != SRC[i * stride] || DST[i * stride] != SRC[i * stride]) {
+          printf("Error: 64b, stride %d, element %d\n", stride, i);
+          return 1;
+        }
+      }
+    }
+
+    start_timer();
+    vlse_v32b(buf32, src32, stride, N);
+    stop_timer();
+    runtime[2] = get_timer();
+
+    start_timer();
+    vsse_v32b(dst32, buf32, stride, N);
+    stop_timer();
+    runtime[3] = get_timer();
+
+    if (CHECK) {
+      for (uint64_t i = 0; i < N; ++i) {
+        if (buf32[i] != src32[i * stride] ||
+            dst32[i * stride] != src32[i * stride]) {
+          printf("Error: 32b, stride %d, element %d\n", stride, i);
+          return 1;
+        }
+      }
+    }
+
+    printf("%6d %f %f %f %f\n", stride, (float)N / runtime[0],
+           (float)N / runtime[1], (float)N / runtime[2],
+           (float)N / runtime[3]);
+  }
+
+  printf("Passed.\n");
+
+  return 0;
+}
@@ -19,7 +19,22 @@ package ara_pkg;
   localparam int unsigned ELENB = ELEN / 8;
 
   // Number of vector instructions that can run in parallel.
+  // It can be set at build time, e.g., with nr_vinsn=16 (see hardware/Makefile).
+`ifdef NR_VINSN
+  localparam int unsigned NrVInsn = `NR_VINSN;
+`else
   localparam int unsigned NrVInsn = 8;
+`endif
+
+  // Number of copies of each architectural vector register in the VRF. With more than one
+  // copy, the sequencer renames the destination registers of the instructions that would
+  // wait for a WAR/WAW hazard. Power of two, up to 8. It can be set at build time, e.g.,
+  // with nr_vreg_copies=2 (see hardware/Makefile).
+`ifdef NR_VREG_COPIES
+  localparam int unsigned NrVRegCopies = `NR_VREG_COPIES;
+`else
+  localparam int unsigned NrVRegCopies = 1;
+`endif
 
   // Maximum number of lanes that Ara can support.
   localparam int unsigned MaxNrLanes = 16;
@@ -38,6 +53,9 @@ package ara_pkg;
     SegSupportEnable  = 1'b1
   } seg_support_e;
 
+  // Maximum number of fields of a segment memory operation
+  localparam int unsigned MaxSegFields = 8;
+
   // FP support outside of the FPU (external)
   // vfrec7, vfrsqrt7, round-toward-odd
   typedef enum logic {
@@ -99,24 +117,50 @@ package ara_pkg;
   // Define the maximum FPU latency
   localparam int unsigned LatFMax = LatFCompEW64;
 
+  // Instruction queue depth of the ALU, the MFPU, and the memory units. They grow with the
+  // number of instructions in flight, so that a larger window does not stall on a full
+  // queue of the unit the kernel is bound by. The slide unit keeps two entries: it runs one
+  // instruction at a time over the whole vector, and the slides are rare in the kernels.
+  localparam int unsigned VfuInsnQueueDepth = NrVInsn / 2 > 4 ? NrVInsn / 2 : 4;
   // Define the maximum instruction queue depth
-  localparam MaxVInsnQueueDepth = 4;
+  localparam MaxVInsnQueueDepth = VfuInsnQueueDepth;
   // FUs instruction queue depth.
-  localparam int unsigned MfpuInsnQueueDepth = 4;
-  localparam int unsigned ValuInsnQueueDepth = 4;
-  localparam int unsigned VlduInsnQueueDepth = 4;
-  localparam int unsigned VstuInsnQueueDepth = 4;
-  localparam int unsigned VaddrgenInsnQueueDepth = 4;
+  localparam int unsigned MfpuInsnQueueDepth = VfuInsnQueueDepth;
+  localparam int unsigned ValuInsnQueueDepth = VfuInsnQueueDepth;
+  localparam int unsigned VlduInsnQueueDepth = VfuInsnQueueDepth;
+  localparam int unsigned VstuInsnQueueDepth = VfuInsnQueueDepth;
+  localparam int unsigned VaddrgenInsnQueueDepth = VfuInsnQueueDepth;
   localparam int unsigned SlduInsnQueueDepth = 2;
   localparam int unsigned NoneInsnQueueDepth = 1;
   // Ara supports MaskuInsnQueueDepth = 1 only.
   localparam int unsigned MaskuInsnQueueDepth = 1;
 
+  // Maximum number of indices of a scatter/gather that the address generator coalesces
+  // into a single AXI request, when they fall into the same AXI beat.
+  localparam int unsigned VaddrgenIdxCoalesceWidth = 4;
+  // Maximum number of elements of a strided memory operation that the address generator
+  // packs into a single AXI request, when they fall into the same AXI beat.
+  localparam int unsigned VaddrgenStrideCoalesceWidth = 8;
+  // Number of load bursts that the VLSU keeps in flight, each one with its own AXI ID. The
+  // responses are reordered before reaching the load unit, and the load bursts are capped to
+  // VlsuRobBurstBeats beats, the depth of the reorder buffer of each ID.
+  localparam int unsigned VlsuNrAxiIds = 4;
+  localparam int unsigned VlsuRobBurstBeats = 16;
+  // Stride prefetcher of the VLSU: number of buffered blocks, each one as long as the longest
+  // load burst, and number of load instructions tracked. No prefetcher if VlsuPfEntries is zero.
+  // The prefetcher is enabled at runtime through the control registers of the SoC.
+  localparam int unsigned VlsuPfEntries = 8;
+  localparam int unsigned VlsuPfStreams = 8;
+  // Number of store bursts in flight whose address range is tracked by the VLSU. A load burst
+  // only waits for the B responses of the store bursts it overlaps.
+  localparam int unsigned VlsuNrStBursts = 8;
+
   ///////////////////
   //  Definitions  //
   ///////////////////
 
   typedef logic [$clog2(NrVInsn)-1:0] vid_t;
+  typedef logic [cf_math_pkg::idx_width(NrVRegCopies)-1:0] vreg_copy_t;
   typedef logic [ELEN-1:0] elen_t;
 
   //////////////////
@@ -189,12 +233,6 @@ package ara_pkg;
     vd_scalar = op inside {[VCPOP:VFIRST]};
   endfunction : vd_scalar
 
-  typedef enum logic [1:0] {
-    NO_RED,
-    ALU_RED,
-    MFPU_RED
-  } sldu_mux_e;
-
   ////////////////////////
   //  Width conversion  //
   ////////////////////////
@@ -375,6 +413,24 @@ typedef struct packed {
     OffsetLoad, OffsetStore, OffsetMask, OffsetSlide
   } vfu_offset_e;
 
+  // Performance events of Ara, counted by the performance counters of the SoC
+  typedef struct packed {
+    // Instructions accepted by the sequencer, per target unit
+    logic [NrVFUs-1:0] vinsn_issued;
+    // Units running at least one instruction
+    logic [NrVFUs-1:0] vfu_active;
+    // Bytes requested on the AR channel and written on the W channel
+    logic [15:0] axi_rd_bytes;
+    logic [15:0] axi_wr_bytes;
+    // Lanes with a VRF bank conflict
+    logic [7:0] vrf_conflicts;
+    // Load bursts answered by the stride prefetcher, load bursts sent to the memory while the
+    // prefetcher is enabled, and prefetched blocks
+    logic pf_hit;
+    logic pf_miss;
+    logic pf_prefetch;
+  } ara_perf_t;
+
   /* The VRF data is stored into the lanes in a shuffled way, similar to how it was done
    * in version 0.9 of the RISC-V Vector Specification, when SLEN < VLEN. In fact, VRF
    * data is organized in lanes as in section 4.3 of the RVV Specification v0.9, with
@@ -991,10 +1047,17 @@ typedef struct packed {
   // The address generation unit makes requests on the AR/AW buses, while the load and
   // store unit handle the R, W, and B buses. The latter need some information about the
   // original request, namely the fields below.
+
+  // Maximum AXI data width supported by the load and store units, in bytes.
+  localparam int unsigned MaxAxiDataWidthB = ELENB * MaxNrLanes;
+
   typedef struct packed {
     axi_pkg::largest_addr_t addr;
     axi_pkg::size_t size;
     axi_pkg::len_t len;
+    // Bytes of the AXI beats that belong to the vector. All set, except for single-beat
+    // requests that coalesce several non-contiguous elements.
+    logic [MaxAxiDataWidthB-1:0] strb;
     logic is_load;
     logic is_exception;
   } addrgen_axi_req_t;
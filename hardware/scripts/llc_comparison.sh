@@ -0,0 +1,41 @@
+#!/usr/bin/env bash
+
+# Copyright 2021 ETH Zurich and University of Bologna.
+# Solderpad Hardware License, Version 0.51, see LICENSE for details.
+# SPDX-License-Identifier: SHL-0.51
+#
+# Verilate Ara with the DRAM timing model, without and with the last-level
+# cache, run the same applications on both models, and report the cycles
+# of every kernel and the speedup given by the cache.
+# Usage: llc_comparison.sh <app> [more apps]
+# Example: llc_bytes=131072 llc_ways=8 dram_args="+dram_latency=100" ./scripts/llc_comparison.sh fmatmul fconv2d spmv
+
+apps=${@}
+dram_args=${dram_args:-+dram_latency=100}
+
+[[ -z "${apps}" ]] && echo "Usage: $0 <app> [more apps]" && exit 1
+
+# Cycles of the kernels run by the application, as printed by the application
+cycles() {
+  grep -Poh -- '(?<=The execution took )[0-9]+(?= cycles)' $1 | paste -sd+ | bc
+}
+
+for llc in 0 1; do
+  lib=build/verilator_llc${llc}
+  make verilate veril_library=${lib} dram_model=1 llc=${llc} || exit 1
+  for app in ${apps}; do
+    make simv veril_library=${lib} dram_model=1 llc=${llc} dram_args="${dram_args}" app=${app} \
+      &> ${lib}/${app}.log || exit 1
+  done
+done
+
+report=""
+for app in ${apps}; do
+  base=$(cycles build/verilator_llc0/${app}.log)
+  cached=$(cycles build/verilator_llc1/${app}.log)
+  [[ -z "${base}" || -z "${cached}" ]] && echo "No cycles found for ${app}" && exit 1
+  report+="${app} ${base} ${cached} $(echo "scale=3; ${base} / ${cached}" | bc)\n"
+done
+
+echo "app cycles cycles_llc speedup"
+echo -e "${report}" | column -t
@@ -0,0 +1,88 @@
+#!/usr/bin/env bash
+
+# Copyright 2021 ETH Zurich and University of Bologna.
+# Solderpad Hardware License, Version 0.51, see LICENSE for details.
+# SPDX-License-Identifier: SHL-0.51
+#
+# Verify the inter-lane reduction network, on every configuration in ${configs}:
+# 1. Verilate Ara, and fail on any Verilator warning in rednet.sv
+# 2. Run the integer and FP reduction riscv-tests on the model
+# 3. Run the redlat microbenchmark on this tree and on the tree at ${base},
+#    and report the latency of every reduction [cycles] before and after
+# By default, the base is the last commit with the reductions through the SLDU.
+# The report is also written to build/rednet_verify/report.txt.
+# Usage: rednet_verify.sh
+# Example: configs="2_lanes 16_lanes" ./scripts/rednet_verify.sh
+
+configs=${configs:-2_lanes 4_lanes 8_lanes 16_lanes}
+base=${base:-$(git log -1 --format=%H --diff-filter=A -- src/rednet.sv)~1}
+root=$(git rev-parse --show-toplevel)
+out=${root}/hardware/build/rednet_verify
+
+red_tests=""
+for t in vredsum vredmaxu vredmax vredminu vredmin vredand vredor vredxor vwredsumu vwredsum \
+         vfredusum vfredosum vfredmin vfredmax vfwredusum vfwredosum; do
+  red_tests+="rv64uv-ara-${t} "
+done
+
+rm -rf ${out}
+mkdir -p ${out}
+
+# Run redlat on the tree $1, verilated with the configuration $2, and keep its
+# table (vl vredsum vfredusum vfredosum) in $3
+redlat() {
+  local tree=$1
+  local config=$2
+  local dst=$3
+  # Sweep up to the largest LMUL=8 group of 64-bit elements
+  local vlen=$(grep -Po '(?<=vlen \?= )[0-9]+' ${root}/config/${config}.mk)
+  make -C ${tree}/apps clean &> /dev/null
+  make -C ${tree}/apps redlat config=${config} def_args_redlat=$(( vlen / 8 )) || exit 1
+  make -C ${tree}/hardware simv app=redlat config=${config} &> ${dst}.log || exit 1
+  grep -q "Passed." ${dst}.log || { echo "redlat failed on ${tree} with ${config}"; exit 1; }
+  grep -E '^ *[0-9]+ +[0-9]+ +[0-9]+ +[0-9]+ *$' ${dst}.log > ${dst}
+}
+
+for config in ${configs}; do
+  # 1. Warning-clean build, with the warnings enabled in the Makefile
+  make verilate config=${config} &> ${out}/verilate_${config}.log || exit 1
+  if grep -E '^%Warning.*rednet\.sv' ${out}/verilate_${config}.log; then
+    echo "Verilator warnings in the reduction network with ${config}, see ${out}/verilate_${config}.log"
+    exit 1
+  fi
+
+  # 2. Reduction riscv-tests, compiled for this configuration
+  make -C ${root}/apps clean &> /dev/null
+  make -C ${root}/apps riscv_tests config=${config} || exit 1
+  make riscv_tests_simv_batch config=${config} tests="${red_tests}" || exit 1
+  cp build/riscv_tests.csv ${out}/riscv_tests_${config}.csv
+
+  # 3. Latency, after the change
+  redlat ${root} ${config} ${out}/after_${config}
+done
+
+# Build the base tree with the toolchain and the dependencies of this one, and
+# with the microbenchmark of this one
+git worktree add --detach ${out}/base ${base} || exit 1
+ln -s ${root}/install ${out}/base/install
+ln -s ${root}/hardware/deps ${out}/base/hardware/deps
+cp -r ${root}/apps/redlat ${out}/base/apps/redlat
+for config in ${configs}; do
+  make -C ${out}/base/hardware verilate config=${config} &> ${out}/verilate_base_${config}.log || exit 1
+  redlat ${out}/base ${config} ${out}/before_${config}
+done
+git worktree remove --force ${out}/base
+
+{
+  echo "Reduction riscv-tests:"
+  for config in ${configs}; do
+    echo "${config}: $(awk -F, 'NR > 1 && $2 == "1" && $4 == "0"' ${out}/riscv_tests_${config}.csv | wc -l)/$(echo ${red_tests} | wc -w) passed"
+  done
+  echo
+  echo "config vl vredsum_before vredsum_after vfredusum_before vfredusum_after vfredosum_before vfredosum_after"
+  for config in ${configs}; do
+    # Both runs sweep the same vector lengths
+    paste -d' ' ${out}/before_${config} ${out}/after_${config} |
+      awk -v c=${config} '{print c, $1, $2, $6, $3, $7, $4, $8}'
+  done | column -t
+} | tee ${out}/report.txt
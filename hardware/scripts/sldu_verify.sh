@@ -0,0 +1,85 @@
+#!/usr/bin/env bash
+
+# Copyright 2021 ETH Zurich and University of Bologna.
+# Solderpad Hardware License, Version 0.51, see LICENSE for details.
+# SPDX-License-Identifier: SHL-0.51
+#
+# Verify the single-pass slides of the SLDU, on every configuration in ${configs}:
+# 1. Verilate Ara, and fail on any Verilator warning in the SLDU sources
+# 2. Run the slide riscv-tests on the model
+# 3. Benchmark the kernels with scripts/benchmark.sh, on this tree and on the
+#    tree at ${base}, and report the performance of both [OP/cycle]. For a
+#    given size, the speedup is the ratio of the cycles before and after.
+# By default, the base is the last commit with the multi-pass NP2 slides.
+# The report is also written to build/sldu_verify/report.txt.
+# Usage: sldu_verify.sh [kernels]
+# Example: configs="2_lanes 4_lanes 8_lanes 16_lanes" ./scripts/sldu_verify.sh fconv2d jacobi2d pathfinder
+
+kernels=${@:-fconv2d jacobi2d pathfinder}
+configs=${configs:-2_lanes 4_lanes 8_lanes 16_lanes}
+base=${base:-$(git log -1 --format=%H --diff-filter=D -- src/sldu/p2_stride_gen.sv)~1}
+root=$(git rev-parse --show-toplevel)
+out=${root}/hardware/build/sldu_verify
+
+slide_tests="rv64uv-ara-vslideup rv64uv-ara-vslidedown rv64uv-ara-vslide1up \
+             rv64uv-ara-vslide1down rv64uv-ara-vfslide1up rv64uv-ara-vfslide1down"
+
+rm -rf ${out}
+mkdir -p ${out}
+
+# Benchmark the kernels on the tree $1, verilated with the configuration $2, into $3
+benchmark() {
+  local tree=$1
+  local config=$2
+  local dst=$3
+  mkdir -p ${dst}
+  for kernel in ${kernels}; do
+    (cd ${tree} && config=${config} ./scripts/benchmark.sh ci ${kernel}) &> ${dst}/${kernel}.log || exit 1
+    mv ${tree}/${kernel}_*.benchmark ${dst}
+  done
+}
+
+for config in ${configs}; do
+  # 1. Warning-clean build, with the warnings enabled in the Makefile
+  make verilate config=${config} &> ${out}/verilate_${config}.log || exit 1
+  if grep -E '^%Warning.*sldu(_rot_dp|_op_dp)?\.sv' ${out}/verilate_${config}.log; then
+    echo "Verilator warnings in the SLDU with ${config}, see ${out}/verilate_${config}.log"
+    exit 1
+  fi
+
+  # 2. Slide riscv-tests, compiled for this configuration
+  make -C ${root}/apps clean &> /dev/null
+  make -C ${root}/apps riscv_tests config=${config} || exit 1
+  make riscv_tests_simv_batch config=${config} tests="${slide_tests}" || exit 1
+  cp build/riscv_tests.csv ${out}/riscv_tests_${config}.csv
+
+  # 3. Benchmarks, after the change
+  benchmark ${root} ${config} ${out}/after/${config}
+done
+
+# Build the base tree with the toolchain and the dependencies of this one
+git worktree add --detach ${out}/base ${base} || exit 1
+ln -s ${root}/install ${out}/base/install
+ln -s ${root}/hardware/deps ${out}/base/hardware/deps
+for config in ${configs}; do
+  make -C ${out}/base/hardware verilate config=${config} &> ${out}/verilate_base_${config}.log || exit 1
+  benchmark ${out}/base ${config} ${out}/before/${config}
+done
+git worktree remove --force ${out}/base
+
+{
+  echo "Slide riscv-tests:"
+  for config in ${configs}; do
+    echo "${config}: $(awk -F, 'NR > 1 && $2 == "1" && $4 == "0"' ${out}/riscv_tests_${config}.csv | wc -l)/$(echo ${slide_tests} | wc -w) passed"
+  done
+  echo
+  echo "config kernel size perf_before perf_after speedup"
+  for config in ${configs}; do
+    nr_lanes=$(grep -Po '(?<=nr_lanes \?= )[0-9]+' ${root}/config/${config}.mk)
+    for kernel in ${kernels}; do
+      join <(sort ${out}/before/${config}/${kernel}_${nr_lanes}.benchmark) \
+           <(sort ${out}/after/${config}/${kernel}_${nr_lanes}.benchmark) |
+        awk -v c=${config} -v k=${kernel} '{printf "%s %s %s %s %s %.3f\n", c, k, $1, $2, $3, $3 / $2}'
+    done
+  done | column -t
+} | tee ${out}/report.txt
@@ -0,0 +1,55 @@
+#!/usr/bin/env bash
+
+# Copyright 2021 ETH Zurich and University of Bologna.
+# Solderpad Hardware License, Version 0.51, see LICENSE for details.
+# SPDX-License-Identifier: SHL-0.51
+#
+# Verilate Ara with different numbers of threads, run the same application on
+# every model, and report the build time and the simulation speed of each of
+# them. With pgo=1, every threaded model is verilated a second time with the
+# thread partitioning profiled on the first run of the application.
+# Usage: thread_scaling.sh <app> [thread counts]
+# Example: config=16_lanes pgo=1 ./scripts/thread_scaling.sh fmatmul 1 2 4 8 16
+
+app=$1
+shift
+thread_counts=${@:-1 2 4 8}
+
+[[ -z "${app}" ]] && echo "Usage: $0 <app> [thread counts]" && exit 1
+
+# Verilate and run the model in ${lib}, and append its results to the report
+run() {
+  local name=$1
+  shift
+  local begin=$(date +%s)
+  make verilate veril_library=${lib} "$@" || exit 1
+  local build_s=$(( $(date +%s) - begin ))
+  make simv veril_library=${lib} app=${app} simv_args="${simv_args}" &> ${lib}/${app}.log || exit 1
+  local speed=$(grep -Poh -- '(?<=\()[0-9.e+]+(?= kHz\))' ${lib}/${app}.log)
+  local util=$(grep -Poh -- '(?<=Average utilization: )[0-9.e+]+' ${lib}/${app}.log)
+  report+="${name} ${build_s} ${speed} ${util:-100}\n"
+}
+
+report=""
+for t in ${thread_counts}; do
+  lib=build/verilator_t${t}
+  simv_args=""
+  if [[ ${t} -gt 1 ]]; then
+    if [[ "${pgo}" == "1" ]]; then
+      # Profile the partitioning of the model, and keep the profile out of the
+      # library, which is wiped at every verilation
+      simv_args="+verilator+prof+vlt+file+build/profile_t${t}.vlt"
+      run ${t}-prof threads=${t} prof_pgo=1
+      simv_args=""
+      run ${t}-pgo threads=${t} pgo_profile=build/profile_t${t}.vlt
+    else
+      run ${t} threads=${t}
+    fi
+  else
+    # Single-threaded models are verilated without --threads
+    run ${t}
+  fi
+done
+
+echo "threads build[s] kHz avg_thread_utilization[%]"
+echo -e "${report}" | column -t
@@ -0,0 +1,29 @@
+#!/usr/bin/env bash
+
+# Copyright 2021 ETH Zurich and University of Bologna.
+# Solderpad Hardware License, Version 0.51, see LICENSE for details.
+# SPDX-License-Identifier: SHL-0.51
+#
+# Verilate Ara with different instruction windows (NrVInsn), run the same
+# applications on every model, and report the IPC and the fraction of the cycles
+# in which every unit has an instruction in flight, for each of them.
+# Usage: window_scaling.sh <app> [more apps]
+# Example: config=16_lanes windows="8 16 32" ./scripts/window_scaling.sh fmatmul spmv
+
+apps=${@}
+windows=${windows:-8 16 32}
+
+[[ -z "${apps}" ]] && echo "Usage: $0 <app> [more apps]" && exit 1
+
+report=""
+for w in ${windows}; do
+  lib=build/verilator_vinsn${w}
+  make verilate veril_library=${lib} nr_vinsn=${w} || exit 1
+  for app in ${apps}; do
+    make simv veril_library=${lib} nr_vinsn=${w} app=${app} &> ${lib}/${app}.log || exit 1
+    report+="${app} $(python3 ../scripts/performance.py --ipc ${lib}/${app}.log)\n" || exit 1
+  done
+done
+
+echo "app nr_vinsn cycles insns ipc inflight_alu inflight_mfpu inflight_sldu inflight_masku inflight_vldu inflight_vstu"
+echo -e "${report}" | column -t
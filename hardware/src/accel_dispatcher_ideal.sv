@@ -6,19 +6,16 @@
 // Description:
 // Perfect dispatcher to Ara: load instructions from an external file
 //
+// The vector instructions and their scalar operands are streamed at run time
+// from a binary trace (see tb/dpi/vtrace_reader.cc), passed with the
+// +vtrace=<file> plusarg. The same model can then replay the trace of any
+// application, of any length.
+//
 // Note: the module does not support answers from Ara,
 // it is just a blind dispatcher
 
-`define STRINGIFY(x) `"x`"
-`ifndef VTRACE
-`define VTRACE ./
-`endif
-
-// Dummy definition not to throw errors during compilation
-// If N_VINSN is not defined, this file will not be used anyway
-`ifndef N_VINSN
-`define N_VINSN 1
-`endif
+import "DPI-C" function int vtrace_open(input string path);
+import "DPI-C" function int vtrace_next(output int insn, output longint rs1, output longint rs2);
 
 module accel_dispatcher_ideal import axi_pkg::*; import ara_pkg::*; # (
   parameter  config_pkg::cva6_cfg_t CVA6Cfg = cva6_config_pkg::cva6_cfg,
@@ -33,76 +30,61 @@ module accel_dispatcher_ideal import axi_pkg::*; import ara_pkg::*; # (
   input  acc_to_cva6_t acc_resp_i
 );
 
-  localparam string vtrace = `STRINGIFY(`VTRACE);
-
   //////////
   // Data //
   //////////
 
-  // Width and number of vector instructions in the ideal dispatcher
-  localparam integer unsigned DATA_WIDTH  = 32 + 64 + 64; // vinsn + scalar reg + scalar reg
-  localparam integer unsigned N_VINSN   = `N_VINSN;
-
   typedef struct packed {
     riscv::instruction_t insn;
     xlen_t rs1;
     xlen_t rs2;
-  } fifo_payload_t;
-
-  logic [DATA_WIDTH-1:0] fifo_data_raw;
-  fifo_payload_t fifo_data;
-
-  // FIFO-like structure with no reset
-  // Instantiated here without hierarchy to please questasim
+  } vinsn_t;
 
-  // FIFO read pointer
-  logic [$clog2(N_VINSN):0] read_pointer_n, read_pointer_q;
-  // FIFO counter
-  logic [$clog2(N_VINSN):0] status_cnt_n, status_cnt_q;
-  // FIFO
-  logic [DATA_WIDTH-1:0] fifo_q [N_VINSN];
-  logic fifo_empty;
-
-  // read and write queue logic
-  always_comb begin : read_write_comb
-    // Default assignment
-    read_pointer_n = read_pointer_q;
-    status_cnt_n   = status_cnt_q;
-    fifo_data_raw  = fifo_q[read_pointer_q];
+  initial begin
+    string vtrace;
 
-    if (acc_resp_i.acc_resp.req_ready && ~fifo_empty) begin
-      // read from the queue is a default assignment
-      // but increment the read pointer...
-      if (read_pointer_n == N_VINSN - 1)
-        read_pointer_n = '0;
-      else
-        read_pointer_n = read_pointer_q + 1;
-      // ... and decrement the overall count
-      status_cnt_n = status_cnt_q - 1;
-    end
+    if (!$value$plusargs("vtrace=%s", vtrace))
+      $fatal(1, "[accel_dispatcher_ideal] Please specify the vector trace with +vtrace=<file>.");
+    if (!vtrace_open(vtrace))
+      $fatal(1, "[accel_dispatcher_ideal] Could not open the vector trace.");
   end
 
-  // sequential process
-  always_ff @(posedge clk_i or negedge rst_ni) begin
+  // Next instruction of the trace, held until Ara accepts it
+  vinsn_t vinsn_q;
+  logic   vinsn_valid_q;
+  // The trace is over
+  logic   vtrace_done_q;
+  // Useful if the reset is not asserted exactly when the simulation starts
+  logic   was_reset = 0;
+
+  // Do not consume the trace before the first reset, which would drop its first instructions
+  always_ff @(posedge clk_i or negedge rst_ni) begin : p_vtrace
     if (!rst_ni) begin
-      read_pointer_q  <= '0;
-      status_cnt_q    <= N_VINSN;
-    end else begin
-      read_pointer_q  <= read_pointer_n;
-      status_cnt_q    <= status_cnt_n;
+      vinsn_q       <= '0;
+      vinsn_valid_q <= 1'b0;
+      vtrace_done_q <= 1'b0;
+    end else if (was_reset && !vtrace_done_q && (!vinsn_valid_q || acc_resp_i.acc_resp.req_ready)) begin
+      int     insn;
+      longint rs1, rs2;
+
+      // Fetch the next instruction
+      if (vtrace_next(insn, rs1, rs2)) begin
+        vinsn_q       <= '{insn: insn, rs1: rs1, rs2: rs2};
+        vinsn_valid_q <= 1'b1;
+      end else begin
+        vinsn_valid_q <= 1'b0;
+        vtrace_done_q <= 1'b1;
+      end
     end
   end
 
-  assign fifo_empty = (status_cnt_q == 0);
-
   // Output assignment
-  assign fifo_data = fifo_payload_t'(fifo_data_raw);
   assign acc_req_o.acc_req = '{
-    insn    : fifo_data.insn,
-    rs1     : fifo_data.rs1,
-    rs2     : fifo_data.rs2,
-    // Always valid until empty
-    req_valid  : ~fifo_empty,
+    insn    : vinsn_q.insn,
+    rs1     : vinsn_q.rs1,
+    rs2     : vinsn_q.rs2,
+    // Always valid until the trace is over
+    req_valid  : vinsn_valid_q,
     // Flush the answer
     resp_ready : 1'b1,
     default : '0
@@ -110,17 +92,12 @@ module accel_dispatcher_ideal import axi_pkg::*; import ara_pkg::*; # (
   assign acc_req_o.acc_mmu_resp = '0;
   assign acc_req_o.acc_mmu_en = 1'b0;
 
-  // Initialize the perfect dispatcher
-  initial $readmemh(vtrace, fifo_q);
-
   /////////////
   // Control //
   /////////////
 
   // Ideal performance counter
   logic [63:0] perf_cnt_d, perf_cnt_q;
-  // Useful if the reset is not asserted exactly when the simulation starts
-  logic was_reset = 0;
 
   // Reset the counter and then always count-up until the end
   assign perf_cnt_d = rst_ni ? perf_cnt_q + 1 : '0;
@@ -136,7 +113,7 @@ module accel_dispatcher_ideal import axi_pkg::*; import ara_pkg::*; # (
   // Stop the computation when the instructions are over and ara has returned idle
   // Just check that we are after reset
   always_ff @(posedge clk_i) begin
-    if (rst_ni && was_reset && !acc_req_o.acc_req.req_valid && i_system.i_ara.ara_idle) begin
+    if (rst_ni && was_reset && vtrace_done_q && i_system.i_ara.ara_idle) begin
       $display("[hw-cycles]: %d", int'(perf_cnt_q));
       $display("[cva6-d$-stalls]: %d", int'(dut.dcache_stall_buf_q));
       $display("[cva6-i$-stalls]: %d", int'(dut.icache_stall_buf_q));
@@ -146,87 +123,3 @@ module accel_dispatcher_ideal import axi_pkg::*; import ara_pkg::*; # (
     end
   end
 endmodule
-
-// The following is another definition of the module, possibly more flexible
-// but not compatible with Verilator
-/*
-  //////////
-  // Data //
-  //////////
-
-    // Reading process
-    initial begin
-    int fd;
-    int status;
-
-    typedef struct packed {
-      riscv::instruction_t insn;
-      xlen_t rs1;
-    } fifo_payload_t;
-    fifo_payload_t payload;
-
-    acc_req_o = '0;
-    acc_req_o.req_valid = 1'b0;
-
-    // Flush the answer
-	acc_req_o.resp_ready = 1'b1;
-
-    acc_req_o     = '0;
-    acc_req_o.frm = fpnew_pkg::RNE;
-
-    fd = $fopen(vtrace, "r");
-    if (!fd) $display("Error: vector instructions list did not open correctly.");
-
-    @(posedge rst_ni);
-    @(negedge clk_i);
-
-    while ($fscanf(fd, "%h", payload) == 1) begin
-      // Always valid
-      acc_req_o.req_valid = 1'b1;
-      acc_req_o.insn  = payload.insn;
-      acc_req_o.rs1   = payload.rs1;
-      // Wait for the handshake
-      wait(acc_resp_i.req_ready);
-      @(posedge clk_i);
-      @(negedge clk_i);
-    end
-
-    // Stop dispatching
-    acc_req_o.req_valid = 1'b0;
-
-    $fclose(fd);
-  end
-
-  /////////////
-  // Control //
-  /////////////
-
-  // Ideal performance counter
-  logic [63:0] perf_cnt_d, perf_cnt_q;
-
-  initial begin
-    $display("Ideal performance counter is initialized.");
-    perf_cnt_d = '0;
-    // Start the counter when the first instruction is dispatched
-    @(posedge i_system.acc_req_valid);
-    $display("Start counting...");
-    // Loop until the last instruction is dispatched and until ara is idle again
-    while (i_system.acc_req_valid || !i_system.i_ara.ara_idle) begin
-	  perf_cnt_d = perf_cnt_q + 1;
-      @(negedge clk_i);
-	end
-    $display("Stop counting.");
-    perf_cnt_d = perf_cnt_q;
-    $display("[cycles]: %d", int'(perf_cnt_q));
-    $info("Core Test ", $sformatf("*** SUCCESS *** (tohost = %0d)", 0));
-    $finish(0);
-  end
-
-  always_ff @(posedge clk_i, negedge rst_ni) begin : p_perf_cnt_ideal
-    if (!rst_ni) begin
-      perf_cnt_q <= '0;
-	end else begin
-      perf_cnt_q <= perf_cnt_d;
-    end
-  end
- */
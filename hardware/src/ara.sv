@@ -59,7 +59,11 @@ module ara import ara_pkg::*; #(
     output acc_to_cva6_t      acc_resp_o,
     // AXI interface
     output axi_req_t          axi_req_o,
-    input  axi_resp_t         axi_resp_i
+    input  axi_resp_t         axi_resp_i,
+    // Stride prefetcher enable
+    input  logic              pf_en_i,
+    // Performance counters
+    output ara_perf_t         perf_o
   );
 
   `include "common_cells/registers.svh"
@@ -197,6 +201,8 @@ module ara import ara_pkg::*; #(
   // Flush support for store exceptions
   logic lsu_ex_flush_lane, lsu_ex_flush_done;
   logic [NrLanes-1:0] lsu_ex_flush_stu;
+  // Address translation is enabled
+  logic acc_mmu_en, acc_mmu_en_q;
 
   ara_dispatcher #(
     .CVA6Cfg           (CVA6Cfg           ),
@@ -229,6 +235,7 @@ module ara import ara_pkg::*; #(
     // Flush support
     .lsu_ex_flush_o     (lsu_ex_flush_lane),
     .lsu_ex_flush_done_i(lsu_ex_flush_done),
+    .en_ld_st_translation_i(acc_mmu_en_q),
     // Interface with the Vector Store Unit
     .core_st_pending_o (core_st_pending ),
     .load_complete_i   (load_complete   ),
@@ -309,7 +316,10 @@ module ara import ara_pkg::*; #(
     .addrgen_exception_i   (addrgen_exception        ),
     .addrgen_exception_vstart_i(addrgen_exception_vstart),
     .addrgen_fof_exception_i(addrgen_fof_exception),
-    .lsu_current_burst_exception_i(lsu_current_burst_exception)
+    .lsu_current_burst_exception_i(lsu_current_burst_exception),
+    // Performance counters
+    .perf_vinsn_issued_o   (perf_o.vinsn_issued      ),
+    .perf_vfu_active_o     (perf_o.vfu_active        )
   );
 
   // Scalar move support
@@ -333,9 +343,21 @@ module ara import ara_pkg::*; #(
   logic      [NrLanes-1:0]                     sldu_operand_valid;
   logic      [NrLanes-1:0]                     addrgen_operand_valid;
   logic      [NrLanes-1:0]                     sldu_operand_ready;
-  sldu_mux_e                                   sldu_mux_sel;
   logic                                        addrgen_operand_ready;
   logic      [NrLanes-1:0]                     sldu_red_valid;
+  // Reduction networks
+  elen_t     [NrLanes-1:0]                     alu_red_operand;
+  logic      [NrLanes-1:0]                     alu_red_valid;
+  logic      [NrLanes-1:0]                     alu_red_ready;
+  elen_t     [NrLanes-1:0]                     alu_red_result;
+  logic      [NrLanes-1:0]                     alu_red_result_valid;
+  logic      [NrLanes-1:0]                     alu_red_result_ready;
+  elen_t     [NrLanes-1:0]                     mfpu_red_operand;
+  logic      [NrLanes-1:0]                     mfpu_red_valid;
+  logic      [NrLanes-1:0]                     mfpu_red_ready;
+  elen_t     [NrLanes-1:0]                     mfpu_red_result;
+  logic      [NrLanes-1:0]                     mfpu_red_result_valid;
+  logic      [NrLanes-1:0]                     mfpu_red_result_ready;
 
   // Results
   // Load Unit
@@ -364,7 +386,11 @@ module ara import ara_pkg::*; #(
   logic      [NrLanes-1:0]                     masku_result_final_gnt;
   logic      [NrLanes-1:0]                     masku_vrgat_req_valid;
   logic      [NrLanes-1:0]                     masku_vrgat_req_ready;
-  vrgat_req_t                                  masku_vrgat_req;
+  vrgat_req_t [NrLanes-1:0]                    masku_vrgat_req;
+  // Stall events, read by the performance counters of the testbench
+  logic      [NrLanes-1:0]                     lane_hazard_stall;
+  logic      [NrLanes-1:0]                     lane_vrf_conflict;
+  logic      [NrLanes-1:0]                     lane_fpu_latency_stall;
 
   for (genvar lane = 0; lane < NrLanes; lane++) begin: gen_lanes
     lane #(
@@ -408,6 +434,19 @@ module ara import ara_pkg::*; #(
       .sldu_result_be_i                (sldu_result_be[lane]                ),
       .sldu_result_gnt_o               (sldu_result_gnt[lane]               ),
       .sldu_result_final_gnt_o         (sldu_result_final_gnt[lane]         ),
+      // Interface with the reduction networks
+      .alu_red_operand_o               (alu_red_operand[lane]               ),
+      .alu_red_valid_o                 (alu_red_valid[lane]                 ),
+      .alu_red_ready_i                 (alu_red_ready[lane]                 ),
+      .alu_red_result_i                (alu_red_result[lane]                ),
+      .alu_red_result_valid_i          (alu_red_result_valid[lane]          ),
+      .alu_red_result_ready_o          (alu_red_result_ready[lane]          ),
+      .mfpu_red_operand_o              (mfpu_red_operand[lane]              ),
+      .mfpu_red_valid_o                (mfpu_red_valid[lane]                ),
+      .mfpu_red_ready_i                (mfpu_red_ready[lane]                ),
+      .mfpu_red_result_i               (mfpu_red_result[lane]               ),
+      .mfpu_red_result_valid_i         (mfpu_red_result_valid[lane]         ),
+      .mfpu_red_result_ready_o         (mfpu_red_result_ready[lane]         ),
       // Interface with the load unit
       .ldu_result_req_i                (ldu_result_req[lane]                ),
       .ldu_result_addr_i               (ldu_result_addr[lane]               ),
@@ -425,7 +464,6 @@ module ara import ara_pkg::*; #(
       .sldu_operand_valid_o            (sldu_operand_valid[lane]            ),
       .addrgen_operand_valid_o         (addrgen_operand_valid[lane]         ),
       .addrgen_operand_ready_i         (addrgen_operand_ready               ),
-      .sldu_mux_sel_i                  (sldu_mux_sel                        ),
       .sldu_operand_ready_i            (sldu_operand_ready[lane]            ),
       .sldu_red_valid_i                (sldu_red_valid[lane]                ),
       // Interface with the mask unit
@@ -441,10 +479,14 @@ module ara import ara_pkg::*; #(
       .masku_result_final_gnt_o        (masku_result_final_gnt[lane]        ),
       .masku_vrgat_req_valid_i         (masku_vrgat_req_valid[lane]         ),
       .masku_vrgat_req_ready_o         (masku_vrgat_req_ready[lane]         ),
-      .masku_vrgat_req_i               (masku_vrgat_req                     ),
+      .masku_vrgat_req_i               (masku_vrgat_req[lane]               ),
       .mask_i                          (mask[lane]                          ),
       .mask_valid_i                    (mask_valid[lane] & mask_valid_lane  ),
-      .mask_ready_o                    (lane_mask_ready[lane]               )
+      .mask_ready_o                    (lane_mask_ready[lane]               ),
+      // Performance counters
+      .hazard_stall_o                  (lane_hazard_stall[lane]             ),
+      .vrf_conflict_o                  (lane_vrf_conflict[lane]             ),
+      .fpu_latency_stall_o             (lane_fpu_latency_stall[lane]        )
     );
   end: gen_lanes
 
@@ -459,7 +501,6 @@ module ara import ara_pkg::*; #(
 
   // Optional OS support
   logic acc_mmu_misaligned_ex, acc_mmu_req, acc_mmu_is_store, acc_mmu_dtlb_hit, acc_mmu_valid;
-  logic acc_mmu_en, acc_mmu_en_q;
   logic [CVA6Cfg.VLEN-1:0] acc_mmu_vaddr;
   logic [CVA6Cfg.PLEN-1:0] acc_mmu_paddr;
   logic [CVA6Cfg.PPNW-1:0] acc_mmu_dtlb_ppn;
@@ -509,7 +550,8 @@ module ara import ara_pkg::*; #(
     .pe_req_t    (pe_req_t    ),
     .pe_resp_t   (pe_resp_t   ),
     .CVA6Cfg     (CVA6Cfg     ),
-    .exception_t (exception_t )
+    .exception_t (exception_t ),
+    .SegSupport  (SegSupport  )
   ) i_vlsu (
     .clk_i                      (clk_i                                                 ),
     .rst_ni                     (rst_ni                                                ),
@@ -551,6 +593,7 @@ module ara import ara_pkg::*; #(
     .addrgen_operand_ready_o    (addrgen_operand_ready                                 ),
     // CSR input
     .en_ld_st_translation_i     (acc_mmu_en_q                                          ),
+    .pf_en_i                    (pf_en_i                                               ),
     // Interface with CVA6's sv39 MMU
     .mmu_misaligned_ex_o        (acc_mmu_misaligned_ex                                 ),
     .mmu_req_o                  (acc_mmu_req                                           ),
@@ -568,7 +611,11 @@ module ara import ara_pkg::*; #(
     .ldu_result_wdata_o         (ldu_result_wdata                                      ),
     .ldu_result_be_o            (ldu_result_be                                         ),
     .ldu_result_gnt_i           (ldu_result_gnt                                        ),
-    .ldu_result_final_gnt_i     (ldu_result_final_gnt                                  )
+    .ldu_result_final_gnt_i     (ldu_result_final_gnt                                  ),
+    // Performance counters
+    .perf_pf_hit_o              (perf_o.pf_hit                                         ),
+    .perf_pf_miss_o             (perf_o.pf_miss                                        ),
+    .perf_pf_prefetch_o         (perf_o.pf_prefetch                                    )
   );
 
   //////////////////
@@ -603,7 +650,6 @@ module ara import ara_pkg::*; #(
     .sldu_result_be_o        (sldu_result_be                   ),
     .sldu_result_wdata_o     (sldu_result_wdata                ),
     .sldu_result_gnt_i       (sldu_result_gnt                  ),
-    .sldu_mux_sel_o          (sldu_mux_sel                     ),
     .sldu_red_valid_o        (sldu_red_valid                   ),
     .sldu_result_final_gnt_i (sldu_result_final_gnt            ),
     // Interface with the Mask unit
@@ -612,6 +658,39 @@ module ara import ara_pkg::*; #(
     .mask_ready_o            (sldu_mask_ready                  )
   );
 
+  //////////////////////////
+  //  Reduction networks  //
+  //////////////////////////
+
+  // The inter-lane phase of the unordered reductions does not go through the slide unit.
+  // The ALU and the MFPU have their own network, since their reductions can overlap.
+
+  rednet #(
+    .NrLanes(NrLanes)
+  ) i_alu_rednet (
+    .clk_i              (clk_i               ),
+    .rst_ni             (rst_ni              ),
+    .red_operand_i      (alu_red_operand     ),
+    .red_operand_valid_i(alu_red_valid       ),
+    .red_operand_ready_o(alu_red_ready       ),
+    .red_result_o       (alu_red_result      ),
+    .red_result_valid_o (alu_red_result_valid),
+    .red_result_ready_i (alu_red_result_ready)
+  );
+
+  rednet #(
+    .NrLanes(NrLanes)
+  ) i_mfpu_rednet (
+    .clk_i              (clk_i                ),
+    .rst_ni             (rst_ni               ),
+    .red_operand_i      (mfpu_red_operand     ),
+    .red_operand_valid_i(mfpu_red_valid       ),
+    .red_operand_ready_o(mfpu_red_ready       ),
+    .red_result_o       (mfpu_red_result      ),
+    .red_result_valid_o (mfpu_red_result_valid),
+    .red_result_ready_i (mfpu_red_result_ready)
+  );
+
   /////////////////
   //  Mask unit  //
   /////////////////
@@ -657,6 +736,40 @@ module ara import ara_pkg::*; #(
     .sldu_mask_ready_i       (sldu_mask_ready                 )
   );
 
+  ////////////////////////////
+  //  Performance counters  //
+  ////////////////////////////
+
+  logic [idx_width(AxiDataWidth/8):0] axi_w_popc;
+  logic [idx_width(NrLanes):0]        vrf_conflict_popc;
+
+  popcount #(
+    .INPUT_WIDTH (AxiDataWidth/8)
+  ) i_axi_w_popc (
+    .data_i    (axi_req_o.w.strb),
+    .popcount_o(axi_w_popc      )
+  );
+
+  popcount #(
+    .INPUT_WIDTH (NrLanes)
+  ) i_vrf_conflict_popc (
+    .data_i    (lane_vrf_conflict),
+    .popcount_o(vrf_conflict_popc)
+  );
+
+  always_comb begin: p_perf
+    perf_o.axi_rd_bytes  = '0;
+    perf_o.axi_wr_bytes  = '0;
+    perf_o.vrf_conflicts = vrf_conflict_popc;
+
+    // Requested bytes, counted once per burst
+    if (axi_req_o.ar_valid && axi_resp_i.ar_ready)
+      perf_o.axi_rd_bytes = (axi_req_o.ar.len + 1) << axi_req_o.ar.size;
+    // Written bytes, counted per beat
+    if (axi_req_o.w_valid && axi_resp_i.w_ready)
+      perf_o.axi_wr_bytes = axi_w_popc;
+  end: p_perf
+
   //////////////////
   //  Assertions  //
   //////////////////
@@ -681,4 +794,10 @@ module ara import ara_pkg::*; #(
   if (VLEN != 2**$clog2(VLEN))
     $error("[ara] The vector length must be a power of two.");
 
+  if (NrVRegCopies != 2**$clog2(NrVRegCopies) || NrVRegCopies > 8)
+    $error("[ara] The number of copies of the vector registers must be a power of two, at most 8.");
+
+  if (NrVInsn < 2 || NrVInsn != 2**$clog2(NrVInsn))
+    $error("[ara] The number of vector instructions in flight must be a power of two, at least two.");
+
 endmodule : ara
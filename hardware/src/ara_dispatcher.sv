@@ -49,6 +49,8 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
     // LSU exception-related flush support
     output logic                                 lsu_ex_flush_o,
     input  logic                                 lsu_ex_flush_done_i,
+    // Address translation is enabled
+    input  logic                                 en_ld_st_translation_i,
     // Rounding mode is shared between all lanes
     input  logic              [NrLanes-1:0]      vxsat_flag_i,
     output vxrm_t             [NrLanes-1:0]      alu_vxrm_o,
@@ -280,8 +282,8 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
   assign is_stride_np2 = sldu_popc > 1;
 
   // Segment-memory instruction sequencer
-  // Decompose the segment memory operations into non-segment memory operations
-  // This is a low-impact and low-performance implementation
+  // Decompose the segment memory operations into non-segment memory operations,
+  // one strided operation per field whenever possible
   logic is_segment_mem_op;
   logic illegal_insn;
 
@@ -300,6 +302,7 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
     .is_segment_mem_op_i(is_segment_mem_op),
     .illegal_insn_i(illegal_insn),
     .is_vload_i(is_vload),
+    .en_ld_st_translation_i(en_ld_st_translation_i),
     .seg_mem_op_end_o(seg_mem_op_end),
     .load_complete_i(load_complete_i),
     .load_complete_o(load_complete),
@@ -3074,6 +3077,8 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
 
               // Maximum vector length. VLMAX = nf * VLEN / EW8.
               ara_req.vtype.vsew = EW8;
+              // Here, nf is the number of registers, not of segment fields
+              ara_req.nf         = '0;
               unique case (insn.vmem_type.nf)
                 3'd0: begin
                   ara_req.vl = VLENB << 0;
@@ -3317,6 +3322,8 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
 
               // Maximum vector length. VLMAX = nf * VLEN / EW8.
               ara_req.vtype.vsew = EW8;
+              // Here, nf is the number of registers, not of segment fields
+              ara_req.nf         = '0;
               unique case (insn.vmem_type.nf)
                 3'd0: begin
                   ara_req.vl = VLENB << 0;
@@ -51,7 +51,10 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     input  vlen_t                           addrgen_exception_vstart_i,
     input  logic                            addrgen_fof_exception_i,
     // Interface with the store unit
-    input  logic                            lsu_current_burst_exception_i
+    input  logic                            lsu_current_burst_exception_i,
+    // Performance counters
+    output logic               [NrVFUs-1:0] perf_vinsn_issued_o,
+    output logic               [NrVFUs-1:0] perf_vfu_active_o
   );
 
   `include "common_cells/registers.svh"
@@ -259,10 +262,15 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
       [VADD:VFMVSF]:
         for (int i = 0; i < NrVFUs; i++)
           if (i == VFU_Alu) target_vfus[i] = 1'b1;
+      // The unordered reductions exchange their partial results through the reduction networks
       [VREDSUM:VWREDSUM]:
         for (int i = 0; i < NrVFUs; i++)
-          if (i == VFU_Alu || i == VFU_SlideUnit) target_vfus[i] = 1'b1;
-      [VFREDUSUM:VFWREDOSUM]:
+          if (i == VFU_Alu) target_vfus[i] = 1'b1;
+      VFREDUSUM, VFREDMIN, VFREDMAX, VFWREDUSUM:
+        for (int i = 0; i < NrVFUs; i++)
+          if (i == VFU_MFpu) target_vfus[i] = 1'b1;
+      // The ordered reductions pass their partial result from lane to lane through the slide unit
+      VFREDOSUM, VFWREDOSUM:
         for (int i = 0; i < NrVFUs; i++)
           if (i == VFU_MFpu || i == VFU_SlideUnit) target_vfus[i] = 1'b1;
       [VMUL:VFCVTFF]:
@@ -297,6 +305,110 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     no_src_vrf = ((pe_req.op == VLE || pe_req.op == VLSE) && pe_req.vm);
   endfunction
 
+  //////////////////////////////////
+  //  Vector register renaming  //
+  //////////////////////////////////
+
+  // The VRF holds NrVRegCopies copies of each architectural vector register. Every instruction
+  // carries its view of the registers, i.e., which copy of each register it accesses, and the
+  // lanes translate its VRF addresses accordingly.
+  //
+  // An instruction that would wait for a WAR or WAW hazard on its destination writes to a free
+  // copy of the destination registers instead, so that only its RAW hazards order it.
+  // Ara does not write the tail and the inactive elements, so this is only possible if the
+  // instruction overwrites the whole destination group without reading it.
+
+  // The incoming instruction is issued
+  logic              vreg_issue;
+  // The incoming instruction writes to new copies of its destination registers
+  logic              vd_rename;
+  // View of the vector registers of the incoming instruction
+  vreg_copy_t [31:0] vreg_view;
+
+  if (NrVRegCopies > 1) begin : gen_vreg_renaming
+    localparam int unsigned VLENB = VLEN / 8;
+
+    // Current copy of each vector register
+    vreg_copy_t [31:0] vreg_copy_d, vreg_copy_q;
+    // Running instructions that access each copy of each vector register
+    logic [31:0][NrVRegCopies-1:0][NrVInsn-1:0] vreg_users_d, vreg_users_q;
+    // Vector registers read and written by the incoming instruction
+    logic [31:0] vreg_rd, vreg_wr;
+    // The next copies of the destination registers are free
+    logic        vd_copy_free;
+    // The destination has a WAR or WAW hazard
+    logic        vd_hazard;
+
+    // Vector registers of the group starting at vreg that hold the first nbytes bytes
+    function automatic logic [31:0] vreg_group(logic [4:0] vreg, int unsigned nbytes);
+      vreg_group = '0;
+      for (int unsigned r = 0; r < 8; r++)
+        if (r == 0 || r * VLENB < nbytes) vreg_group[5'(vreg + r)] = 1'b1;
+    endfunction : vreg_group
+
+    // The instruction overwrites all the elements of its destination group
+    function automatic logic vd_overwritten(ara_req_t req);
+      vd_overwritten = req.use_vd && req.vm && !req.use_vd_op && req.vstart == '0 &&
+        !req.fault_only_first && !req.scale_vl && req.nf == '0 &&
+        req.op inside {[VADD:VMERGE], [VMUL:VFCVTFF], [VLE:VLXE]} &&
+        !req.emul[2] && (int'(req.vl) << req.vtype.vsew) == (VLENB << req.emul[1:0]);
+    endfunction : vd_overwritten
+
+    always_comb begin
+      // Registers accessed by the incoming instruction. The source groups are overestimated.
+      vreg_rd = '0;
+      if (ara_req_i.use_vs1)
+        vreg_rd |= vreg_group(ara_req_i.vs1, int'(ara_req_i.vl) << (ara_req_i.eew_vs1 > ara_req_i.vtype.vsew
+                 ? ara_req_i.eew_vs1 : ara_req_i.vtype.vsew));
+      if (ara_req_i.use_vs2)
+        vreg_rd |= vreg_group(ara_req_i.vs2, int'(ara_req_i.vl) << (ara_req_i.eew_vs2 > ara_req_i.vtype.vsew
+                 ? ara_req_i.eew_vs2 : ara_req_i.vtype.vsew));
+      if (ara_req_i.use_vd_op)
+        vreg_rd |= vreg_group(ara_req_i.vd, int'(ara_req_i.vl) << (ara_req_i.eew_vd_op > ara_req_i.vtype.vsew
+                 ? ara_req_i.eew_vd_op : ara_req_i.vtype.vsew));
+      if (!ara_req_i.vm)
+        vreg_rd[VMASK] = 1'b1;
+      vreg_wr = '0;
+      if (ara_req_i.use_vd)
+        vreg_wr = vreg_group(ara_req_i.vd, ara_req_i.emul[2]
+                ? int'(ara_req_i.vl) << ara_req_i.vtype.vsew
+                : VLENB << ara_req_i.emul[1:0]);
+
+      // Rename only to avoid a hazard, and only if the next copy of every destination
+      // register is free
+      vd_hazard = (write_list_q[ara_req_i.vd].valid && vinsn_running_q[write_list_q[ara_req_i.vd].vid]) ||
+                  (read_list_q[ara_req_i.vd].valid && vinsn_running_q[read_list_q[ara_req_i.vd].vid]);
+      vd_copy_free = 1'b1;
+      for (int unsigned r = 0; r < 32; r++)
+        if (vreg_wr[r] && |(vreg_users_q[r][vreg_copy_t'(vreg_copy_q[r] + 1)] & vinsn_running_q))
+          vd_copy_free = 1'b0;
+      vd_rename = vd_overwritten(ara_req_i) && !(|(vreg_wr & vreg_rd)) && vd_hazard && vd_copy_free;
+
+      // View of the incoming instruction
+      vreg_view = vreg_copy_q;
+      for (int unsigned r = 0; r < 32; r++)
+        if (vd_rename && vreg_wr[r]) vreg_view[r] = vreg_copy_q[r] + 1;
+
+      // Track the copies accessed by the running instructions
+      vreg_copy_d  = vreg_copy_q;
+      vreg_users_d = vreg_users_q;
+      for (int unsigned r = 0; r < 32; r++)
+        for (int unsigned c = 0; c < NrVRegCopies; c++)
+          vreg_users_d[r][c] &= vinsn_running_d;
+      if (vreg_issue) begin
+        vreg_copy_d = vreg_view;
+        for (int unsigned r = 0; r < 32; r++)
+          vreg_users_d[r][vreg_view[r]][vinsn_id_n] = vreg_rd[r] | vreg_wr[r];
+      end
+    end
+
+    `FF(vreg_copy_q, vreg_copy_d, '0)
+    `FF(vreg_users_q, vreg_users_d, '0)
+  end : gen_vreg_renaming else begin : gen_no_vreg_renaming
+    assign vd_rename = 1'b0;
+    assign vreg_view = '0;
+  end : gen_no_vreg_renaming
+
   localparam int unsigned InsnQueueDepth [NrVFUs] = '{
     ValuInsnQueueDepth,
     MfpuInsnQueueDepth,
@@ -374,6 +486,9 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     // Not ready by default
     pe_scalar_resp_ready_o = 1'b0;
 
+    // No instruction issued
+    vreg_issue = 1'b0;
+
     // Update vector register's access list
     for (int unsigned v = 0; v < 32; v++) begin
       read_list_d[v].valid &= vinsn_running_q[read_list_q[v].vid] ;
@@ -416,15 +531,15 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
             if (!ara_req_i.vm) pe_req_d.hazard_vm[write_list_d[VMASK].vid] |=
               write_list_d[VMASK].valid;
 
-            // WAR
-            if (ara_req_i.use_vd) begin
+            // WAR. A renamed destination does not overwrite the registers being read.
+            if (ara_req_i.use_vd && !vd_rename) begin
               pe_req_d.hazard_vs1[read_list_d[ara_req_i.vd].vid] |= read_list_d[ara_req_i.vd].valid;
               pe_req_d.hazard_vs2[read_list_d[ara_req_i.vd].vid] |= read_list_d[ara_req_i.vd].valid;
               pe_req_d.hazard_vm[read_list_d[ara_req_i.vd].vid] |= read_list_d[ara_req_i.vd].valid;
             end
 
             // WAW
-            if (ara_req_i.use_vd) pe_req_d.hazard_vd[write_list_d[ara_req_i.vd].vid] |=
+            if (ara_req_i.use_vd && !vd_rename) pe_req_d.hazard_vd[write_list_d[ara_req_i.vd].vid] |=
               write_list_d[ara_req_i.vd].valid;
 
             /////////////
@@ -457,6 +572,7 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
               vd            : ara_req_i.vd,
               use_vd        : ara_req_i.use_vd,
               emul          : ara_req_i.emul,
+              nf            : ara_req_i.nf,
               fp_rm         : ara_req_i.fp_rm,
               wide_fp_imm   : ara_req_i.wide_fp_imm,
               cvt_resize    : ara_req_i.cvt_resize,
@@ -472,6 +588,9 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
               hazard_vs2    : pe_req_d.hazard_vs2,
               default       : '0
             };
+`ifdef NR_VREG_COPIES
+            pe_req_d.vreg_copy = vreg_view;
+`endif
 
             // Populate the global hazard table
             global_hazard_table_d[vinsn_id_n] = pe_req_d.hazard_vd  | pe_req_d.hazard_vm |
@@ -515,6 +634,7 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
 
               // Issue the instruction
               pe_req_valid_d = 1'b1;
+              vreg_issue     = 1'b1;
 
               // Mark that this vector instruction is writing to vector vd
               if (ara_req_i.use_vd) write_list_d[ara_req_i.vd] = '{vid: vinsn_id_n, valid: 1'b1};
@@ -705,4 +825,10 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     assign vinsn_queue_issue[i] = ~target_vfus_vec[i] | (vinsn_queue_ready[i] | priority_pass[i]);
   end
 
+  // Each instruction is counted once, when it enters the insn queue counters
+  assign perf_vinsn_issued_o = insn_queue_cnt_up;
+  for (genvar i = 0; i < NrVFUs; i++) begin : gen_perf_vfu_active
+    assign perf_vfu_active_o[i] = insn_queue_cnt_q[i] != '0;
+  end
+
 endmodule : ara_sequencer
@@ -28,6 +28,11 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     parameter  int           unsigned AxiRespDelay = 200,
     // Main memory
     parameter  int           unsigned L2NumWords   = (2**22) / NrLanes,
+    // Number of interleaved banks of the main memory
+    parameter  int           unsigned L2NumBanks   = 4,
+    // Last-level cache in front of the main memory [B]. No cache if zero.
+    parameter  int           unsigned LlcNumBytes  = 0,
+    parameter  int           unsigned LlcNumWays   = 4,
     // Dependant parameters. DO NOT CHANGE!
     localparam type                   axi_data_t   = logic [AxiDataWidth-1:0],
     localparam type                   axi_strb_t   = logic [AxiDataWidth/8-1:0],
@@ -206,61 +211,152 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     .mst_resp_i(l2mem_wide_axi_resp_wo_atomics)
   );
 
-  logic                      l2_req;
-  logic                      l2_we;
-  logic [AxiAddrWidth-1:0]   l2_addr;
-  logic [AxiDataWidth/8-1:0] l2_be;
-  logic [AxiDataWidth-1:0]   l2_wdata;
-  logic [AxiDataWidth-1:0]   l2_rdata;
-  logic                      l2_rvalid;
-
-  axi_to_mem #(
-    .AddrWidth (AxiAddrWidth   ),
-    .DataWidth (AxiDataWidth   ),
-    .IdWidth   (AxiSocIdWidth  ),
-    .NumBanks  (1              ),
-    .axi_req_t (soc_wide_req_t ),
-    .axi_resp_t(soc_wide_resp_t)
+  // Optionally, cache the L2 memory in a last-level cache. Its lines are as long as the
+  // load bursts of the VLSU.
+  soc_wide_req_t  l2mem_wide_axi_req_cached;
+  soc_wide_resp_t l2mem_wide_axi_resp_cached;
+  logic           llc_hit, llc_miss;
+
+  if (LlcNumBytes != 0) begin: gen_llc
+    llc #(
+      .NumBytes    (LlcNumBytes       ),
+      .NumWays     (LlcNumWays        ),
+      .LineBeats   (VlsuRobBurstBeats ),
+      .AxiDataWidth(AxiDataWidth      ),
+      .AxiAddrWidth(AxiAddrWidth      ),
+      .axi_ar_t    (soc_wide_ar_chan_t),
+      .axi_aw_t    (soc_wide_aw_chan_t),
+      .axi_r_t     (soc_wide_r_chan_t ),
+      .axi_req_t   (soc_wide_req_t    ),
+      .axi_resp_t  (soc_wide_resp_t   )
+    ) i_llc (
+      .clk_i     (clk_i                         ),
+      .rst_ni    (rst_ni                        ),
+      .slv_req_i (l2mem_wide_axi_req_wo_atomics ),
+      .slv_resp_o(l2mem_wide_axi_resp_wo_atomics),
+      .mst_req_o (l2mem_wide_axi_req_cached     ),
+      .mst_resp_i(l2mem_wide_axi_resp_cached    ),
+      .hit_o     (llc_hit                       ),
+      .miss_o    (llc_miss                      )
+    );
+  end: gen_llc else begin: gen_no_llc
+    assign l2mem_wide_axi_req_cached      = l2mem_wide_axi_req_wo_atomics;
+    assign l2mem_wide_axi_resp_wo_atomics = l2mem_wide_axi_resp_cached;
+    assign llc_hit                        = 1'b0;
+    assign llc_miss                       = 1'b0;
+  end: gen_no_llc
+
+  // Optionally, model the timing of a DRAM in front of the L2 memory
+  soc_wide_req_t  l2mem_wide_axi_req_timed;
+  soc_wide_resp_t l2mem_wide_axi_resp_timed;
+
+`ifdef DRAM_MODEL
+  dram_timing_model #(
+    .BytesPerCycle(AxiDataWidth/8    ),
+    .axi_ar_t     (soc_wide_ar_chan_t),
+    .axi_aw_t     (soc_wide_aw_chan_t),
+    .axi_req_t    (soc_wide_req_t    ),
+    .axi_resp_t   (soc_wide_resp_t   )
+  ) i_dram_timing_model (
+    .clk_i     (clk_i                         ),
+    .rst_ni    (rst_ni                        ),
+    .slv_req_i (l2mem_wide_axi_req_cached     ),
+    .slv_resp_o(l2mem_wide_axi_resp_cached    ),
+    .mst_req_o (l2mem_wide_axi_req_timed      ),
+    .mst_resp_i(l2mem_wide_axi_resp_timed     )
+  );
+`else
+  assign l2mem_wide_axi_req_timed   = l2mem_wide_axi_req_cached;
+  assign l2mem_wide_axi_resp_cached = l2mem_wide_axi_resp_timed;
+`endif
+
+  // The L2 memory is split into L2NumBanks banks, interleaved every AXI beat. Its front end
+  // serves a read and a write burst at the same time, as long as they access different banks.
+  localparam int unsigned L2BankSelWidth = $clog2(L2NumBanks);
+  localparam int unsigned L2BankWords    = L2NumWords / L2NumBanks;
+
+  logic [L2NumBanks-1:0]                             l2_req;
+  logic [L2NumBanks-1:0]                             l2_we;
+  logic [L2NumBanks-1:0][$clog2(L2BankWords)-1:0]    l2_bank_addr;
+  logic [L2NumBanks-1:0][$clog2(L2NumWords)-1:0]     l2_addr;
+  logic [L2NumBanks-1:0][AxiDataWidth/8-1:0]         l2_be;
+  logic [L2NumBanks-1:0][AxiDataWidth-1:0]           l2_wdata;
+  logic [L2NumBanks-1:0][AxiDataWidth-1:0]           l2_rdata;
+
+  axi_to_mem_banked #(
+    .AxiIdWidth   (AxiSocIdWidth       ),
+    .AxiAddrWidth (AxiAddrWidth        ),
+    .AxiDataWidth (AxiDataWidth        ),
+    .axi_aw_chan_t(soc_wide_aw_chan_t  ),
+    .axi_w_chan_t (soc_wide_w_chan_t   ),
+    .axi_b_chan_t (soc_wide_b_chan_t   ),
+    .axi_ar_chan_t(soc_wide_ar_chan_t  ),
+    .axi_r_chan_t (soc_wide_r_chan_t   ),
+    .axi_req_t    (soc_wide_req_t      ),
+    .axi_resp_t   (soc_wide_resp_t     ),
+    .MemNumBanks  (L2NumBanks          ),
+    .MemAddrWidth ($clog2(L2BankWords) ),
+    .MemDataWidth (AxiDataWidth        ),
+    .MemLatency   (1                   )
   ) i_axi_to_mem (
-    .clk_i       (clk_i                         ),
-    .rst_ni      (rst_ni                        ),
-    .axi_req_i   (l2mem_wide_axi_req_wo_atomics ),
-    .axi_resp_o  (l2mem_wide_axi_resp_wo_atomics),
-    .mem_req_o   (l2_req                        ),
-    .mem_gnt_i   (l2_req                        ), // Always available
-    .mem_we_o    (l2_we                         ),
-    .mem_addr_o  (l2_addr                       ),
-    .mem_strb_o  (l2_be                         ),
-    .mem_wdata_o (l2_wdata                      ),
-    .mem_rdata_i (l2_rdata                      ),
-    .mem_rvalid_i(l2_rvalid                     ),
-    .mem_atop_o  (/* Unused */                  ),
-    .busy_o      (/* Unused */                  )
+    .clk_i            (clk_i                    ),
+    .rst_ni           (rst_ni                   ),
+    .test_i           (1'b0                     ),
+    .axi_req_i        (l2mem_wide_axi_req_timed ),
+    .axi_resp_o       (l2mem_wide_axi_resp_timed),
+    .mem_req_o        (l2_req                   ),
+    .mem_gnt_i        (l2_req                   ), // Always available
+    .mem_add_o        (l2_bank_addr             ),
+    .mem_we_o         (l2_we                    ),
+    .mem_wdata_o      (l2_wdata                 ),
+    .mem_be_o         (l2_be                    ),
+    .mem_atop_o       (/* Unused */             ),
+    .mem_rdata_i      (l2_rdata                 ),
+    .axi_to_mem_busy_o(/* Unused */             )
   );
 
-`ifndef SPYGLASS
+  // The banks are the ports of a single memory, so that the L2 can still be preloaded as
+  // one array. Each port only accesses the words of its own bank.
+  for (genvar b = 0; b < L2NumBanks; b++) begin: gen_l2_bank_addr
+    assign l2_addr[b] = {l2_bank_addr[b], L2BankSelWidth'(b)};
+  end: gen_l2_bank_addr
+
+`ifdef VERILATOR
+  // Same memory, with an array that the testbench can access directly
+  l2_sram #(
+    .NumWords (L2NumWords  ),
+    .NumPorts (L2NumBanks  ),
+    .DataWidth(AxiDataWidth)
+  ) i_dram (
+    .clk_i  (clk_i   ),
+    .rst_ni (rst_ni  ),
+    .req_i  (l2_req  ),
+    .we_i   (l2_we   ),
+    .addr_i (l2_addr ),
+    .wdata_i(l2_wdata),
+    .be_i   (l2_be   ),
+    .rdata_o(l2_rdata)
+  );
+`elsif SPYGLASS
+  assign l2_rdata = '0;
+`else
   tc_sram #(
     .NumWords (L2NumWords  ),
-    .NumPorts (1           ),
+    .NumPorts (L2NumBanks  ),
     .DataWidth(AxiDataWidth),
     .SimInit("random")
   ) i_dram (
-    .clk_i  (clk_i                                                                      ),
-    .rst_ni (rst_ni                                                                     ),
-    .req_i  (l2_req                                                                     ),
-    .we_i   (l2_we                                                                      ),
-    .addr_i (l2_addr[$clog2(L2NumWords)-1+$clog2(AxiDataWidth/8):$clog2(AxiDataWidth/8)]),
-    .wdata_i(l2_wdata                                                                   ),
-    .be_i   (l2_be                                                                      ),
-    .rdata_o(l2_rdata                                                                   )
+    .clk_i  (clk_i   ),
+    .rst_ni (rst_ni  ),
+    .req_i  (l2_req  ),
+    .we_i   (l2_we   ),
+    .addr_i (l2_addr ),
+    .wdata_i(l2_wdata),
+    .be_i   (l2_be   ),
+    .rdata_o(l2_rdata)
   );
-`else
-  assign l2_rdata = '0;
 `endif
 
-  // One-cycle latency
-  `FF(l2_rvalid, l2_req, 1'b0);
-
   ////////////
   //  UART  //
   ////////////
@@ -371,6 +467,52 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   soc_narrow_lite_resp_t axi_lite_ctrl_registers_resp;
 
   logic [63:0] event_trigger;
+  // Stride prefetcher control, bit 0 enables it
+  logic [63:0] pf_ctrl;
+
+  // Performance counters of the SoC, in the order of their registers
+  // (see apps/common/runtime.h):
+  // - cycles
+  // - vector instructions issued to each VFU
+  // - active cycles of each VFU, but VFU_None
+  // - AXI bytes read and written by Ara
+  // - VRF bank conflicts, summed over the lanes
+  // - load bursts answered by the stride prefetcher, sent to the memory, and
+  //   prefetched blocks
+  // - read hits and misses of the last-level cache
+  localparam int unsigned PerfCntCycles    = 0;
+  localparam int unsigned PerfCntIssued    = PerfCntCycles + 1;
+  localparam int unsigned PerfCntActive    = PerfCntIssued + NrVFUs;
+  localparam int unsigned PerfCntAxiRd     = PerfCntActive + NrVFUs - 1;
+  localparam int unsigned PerfCntAxiWr     = PerfCntAxiRd + 1;
+  localparam int unsigned PerfCntVrfConfl  = PerfCntAxiWr + 1;
+  localparam int unsigned PerfCntPfHit     = PerfCntVrfConfl + 1;
+  localparam int unsigned PerfCntPfMiss    = PerfCntPfHit + 1;
+  localparam int unsigned PerfCntPfIssued  = PerfCntPfMiss + 1;
+  localparam int unsigned PerfCntLlcHit    = PerfCntPfIssued + 1;
+  localparam int unsigned PerfCntLlcMiss   = PerfCntLlcHit + 1;
+  localparam int unsigned NrPerfCounters   = PerfCntLlcMiss + 1;
+  localparam int unsigned PerfIncWidth     = 16;
+
+  ara_perf_t                                          ara_perf;
+  logic      [NrPerfCounters-1:0][PerfIncWidth-1:0] perf_inc;
+
+  always_comb begin: p_perf_inc
+    perf_inc                = '0;
+    perf_inc[PerfCntCycles] = 1;
+    for (int unsigned vfu = 0; vfu < NrVFUs; vfu++)
+      perf_inc[PerfCntIssued + vfu] = ara_perf.vinsn_issued[vfu];
+    for (int unsigned vfu = 0; vfu < NrVFUs - 1; vfu++)
+      perf_inc[PerfCntActive + vfu] = ara_perf.vfu_active[vfu];
+    perf_inc[PerfCntAxiRd]    = ara_perf.axi_rd_bytes;
+    perf_inc[PerfCntAxiWr]    = ara_perf.axi_wr_bytes;
+    perf_inc[PerfCntVrfConfl] = ara_perf.vrf_conflicts;
+    perf_inc[PerfCntPfHit]    = ara_perf.pf_hit;
+    perf_inc[PerfCntPfMiss]   = ara_perf.pf_miss;
+    perf_inc[PerfCntPfIssued] = ara_perf.pf_prefetch;
+    perf_inc[PerfCntLlcHit]   = llc_hit;
+    perf_inc[PerfCntLlcMiss]  = llc_miss;
+  end: p_perf_inc
 
   axi_to_axi_lite #(
     .AxiAddrWidth   (AxiAddrWidth          ),
@@ -397,6 +539,8 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   ctrl_registers #(
     .DRAMBaseAddr   (DRAMBase              ),
     .DRAMLength     (DRAMLength            ),
+    .NrPerfCounters (NrPerfCounters        ),
+    .PerfIncWidth   (PerfIncWidth          ),
     .DataWidth      (AxiNarrowDataWidth    ),
     .AddrWidth      (AxiAddrWidth          ),
     .axi_lite_req_t (soc_narrow_lite_req_t ),
@@ -410,7 +554,9 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     .dram_base_addr_o     (/* Unused */                ),
     .dram_end_addr_o      (/* Unused */                ),
     .exit_o               (exit_o                      ),
-    .event_trigger_o      (event_trigger)
+    .event_trigger_o      (event_trigger               ),
+    .pf_ctrl_o            (pf_ctrl                     ),
+    .perf_inc_i           (perf_inc                    )
   );
 
   axi_dw_converter #(
@@ -547,6 +693,8 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     .scan_enable_i(1'b0                     ),
     .scan_data_i  (1'b0                     ),
     .scan_data_o  (/* Unconnected */        ),
+    .pf_en_i      (pf_ctrl[0]               ),
+    .perf_o       (ara_perf                 ),
 `ifndef TARGET_GATESIM
     .axi_req_o    (system_axi_req           ),
     .axi_resp_i   (system_axi_resp          )
@@ -598,6 +746,9 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   if (AxiIdWidth == 0)
     $error("[ara_soc] The AXI ID width must be greater than zero.");
 
+  if (L2NumBanks < 2 || 2**$clog2(L2NumBanks) != L2NumBanks)
+    $error("[ara_soc] The number of L2 banks must be a power of two, and at least two.");
+
   if (RVVD(FPUSupport) && !CVA6AraConfig.RVD)
     $error(
       "[ara] Cannot support double-precision floating-point on Ara if CVA6 does not support it.");
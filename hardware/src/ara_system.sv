@@ -65,7 +65,11 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     output logic                    scan_data_o,
     // AXI Interface
     output system_axi_req_t         axi_req_o,
-    input  system_axi_resp_t        axi_resp_i
+    input  system_axi_resp_t        axi_resp_i,
+    // Stride prefetcher enable
+    input  logic                    pf_en_i,
+    // Performance counters
+    output ara_perf_t               perf_o
   );
 
   `include "axi/assign.svh"
@@ -254,7 +258,9 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     .acc_req_i       (acc_req       ),
     .acc_resp_o      (acc_resp      ),
     .axi_req_o       (ara_axi_req   ),
-    .axi_resp_i      (ara_axi_resp  )
+    .axi_resp_i      (ara_axi_resp  ),
+    .pf_en_i         (pf_en_i       ),
+    .perf_o          (perf_o        )
   );
 
   axi_mux #(
@@ -4,7 +4,13 @@
 //
 // Author: Matheus Cavalcante <matheusd@iis.ee.ethz.ch>
 // Description: AXI-LITE accessible control registers, holding
-// static information about Ara's SoC.
+// static information about Ara's SoC, its performance counters, and the
+// enable of the stride prefetcher of Ara's VLSU.
+//
+// The performance counters add up their perf_inc_i input every cycle
+// while enabled. They are not directly readable: a snapshot copies all
+// of them at once into read-only registers, so that software reads a
+// consistent set while the counters keep running.
 
 module ctrl_registers #(
     parameter int   unsigned                 DataWidth       = 32,
@@ -12,6 +18,8 @@ module ctrl_registers #(
     // Parameters
     parameter logic          [DataWidth-1:0] DRAMBaseAddr    = 0,
     parameter logic          [DataWidth-1:0] DRAMLength      = 0,
+    parameter int   unsigned                 NrPerfCounters  = 1,
+    parameter int   unsigned                 PerfIncWidth    = 16,
     // AXI Structs
     parameter type                           axi_lite_req_t  = logic,
     parameter type                           axi_lite_resp_t = logic
@@ -26,7 +34,10 @@ module ctrl_registers #(
     output logic           [DataWidth-1:0] dram_base_addr_o,
     output logic           [DataWidth-1:0] dram_end_addr_o,
     output logic           [DataWidth-1:0] event_trigger_o,
-    output logic           [DataWidth-1:0] hw_cnt_en_o
+    output logic           [DataWidth-1:0] hw_cnt_en_o,
+    output logic           [DataWidth-1:0] pf_ctrl_o,
+    // Performance counters
+    input  logic [NrPerfCounters-1:0][PerfIncWidth-1:0] perf_inc_i
   );
 
   `include "common_cells/registers.svh"
@@ -35,7 +46,9 @@ module ctrl_registers #(
   //  Definitions  //
   ///////////////////
 
-  localparam int unsigned NumRegs          = 5;
+  localparam int unsigned NumCtrlRegs      = 7;
+  localparam int unsigned PerfCtrlReg      = 5;
+  localparam int unsigned NumRegs          = NumCtrlRegs + NrPerfCounters;
   localparam int unsigned DataWidthInBytes = (DataWidth + 7) / 8;
   localparam int unsigned RegNumBytes      = NumRegs * DataWidthInBytes;
 
@@ -43,19 +56,28 @@ module ctrl_registers #(
   localparam logic [DataWidthInBytes-1:0] ReadWriteReg = {DataWidthInBytes{1'b0}};
 
   // Memory map
-  // [39:32]: hw_cnt_en      (rw)
-  // [25:31]: event_trigger  (rw)
-  // [23:16]: dram_end_addr  (ro)
-  // [15:8]:  dram_base_addr (ro)
-  // [7:0]:   exit           (rw)
-  localparam logic [NumRegs-1:0][DataWidth-1:0] RegRstVal = '{
-    0,
-    0,
+  // [..:56]:  perf_cnt       (ro)
+  // [55:48]:  pf_ctrl        (rw)
+  // [47:40]:  perf_ctrl      (rw)
+  // [39:32]:  hw_cnt_en      (rw)
+  // [31:24]:  event_trigger  (rw)
+  // [23:16]:  dram_end_addr  (ro)
+  // [15:8]:   dram_base_addr (ro)
+  // [7:0]:    exit           (rw)
+  localparam logic [NumRegs-1:0][DataWidth-1:0] RegRstVal = {
+    {NrPerfCounters{DataWidth'(0)}},
+    DataWidth'(0),
+    DataWidth'(0),
+    DataWidth'(0),
+    DataWidth'(0),
     DRAMBaseAddr + DRAMLength,
     DRAMBaseAddr,
-    0
+    DataWidth'(0)
   };
-  localparam logic [NumRegs-1:0][DataWidthInBytes-1:0] AxiReadOnly = '{
+  localparam logic [NumRegs-1:0][DataWidthInBytes-1:0] AxiReadOnly = {
+    {NrPerfCounters{ReadOnlyReg}},
+    ReadWriteReg,
+    ReadWriteReg,
     ReadWriteReg,
     ReadWriteReg,
     ReadOnlyReg,
@@ -63,18 +85,33 @@ module ctrl_registers #(
     ReadWriteReg
   };
 
+  // Bits of the perf_ctrl register. Clear and snapshot are cleared by the
+  // hardware once executed. Both at once take a snapshot, then clear.
+  typedef enum int unsigned {
+    PerfCtrlEnable   = 0,
+    PerfCtrlClear    = 1,
+    PerfCtrlSnapshot = 2
+  } perf_ctrl_e;
+
   /////////////////
   //  Registers  //
   /////////////////
 
   logic [RegNumBytes-1:0] wr_active_d, wr_active_q;
 
+  logic [NrPerfCounters-1:0][DataWidth-1:0] perf_snapshot;
+  logic [DataWidth-1:0] pf_ctrl;
+  logic [DataWidth-1:0] perf_ctrl;
   logic [DataWidth-1:0] hw_cnt_en;
   logic [DataWidth-1:0] event_trigger;
   logic [DataWidth-1:0] dram_base_address;
   logic [DataWidth-1:0] dram_end_address;
   logic [DataWidth-1:0] exit;
 
+  // Hardware updates
+  logic [NumRegs-1:0][DataWidth-1:0]        reg_d;
+  logic [NumRegs-1:0][DataWidthInBytes-1:0] reg_load;
+
   axi_lite_regs #(
     .RegNumBytes (RegNumBytes    ),
     .AxiAddrWidth(AddrWidth      ),
@@ -90,18 +127,55 @@ module ctrl_registers #(
     .axi_resp_o (axi_lite_slave_resp_o                      ),
     .wr_active_o(wr_active_d                                ),
     .rd_active_o(/* Unused */                               ),
-    .reg_d_i    ('0                                         ),
-    .reg_load_i ('0                                         ),
-    .reg_q_o    ({hw_cnt_en, event_trigger, dram_end_address, dram_base_address, exit})
+    .reg_d_i    (reg_d                                      ),
+    .reg_load_i (reg_load                                   ),
+    .reg_q_o    ({perf_snapshot, pf_ctrl, perf_ctrl, hw_cnt_en, event_trigger, dram_end_address,
+        dram_base_address, exit})
   );
 
   `FF(wr_active_q, wr_active_d, '0);
 
+  ////////////////////////////
+  //  Performance counters  //
+  ////////////////////////////
+
+  logic [NrPerfCounters-1:0][DataWidth-1:0] perf_cnt_d, perf_cnt_q;
+
+  always_comb begin: p_perf_cnt
+    perf_cnt_d = perf_cnt_q;
+    reg_d      = '0;
+    reg_load   = '0;
+
+    if (perf_ctrl[PerfCtrlEnable])
+      for (int unsigned cnt = 0; cnt < NrPerfCounters; cnt++)
+        perf_cnt_d[cnt] = perf_cnt_q[cnt] + perf_inc_i[cnt];
+
+    if (perf_ctrl[PerfCtrlSnapshot])
+      for (int unsigned cnt = 0; cnt < NrPerfCounters; cnt++) begin
+        reg_d[NumCtrlRegs + cnt]    = perf_cnt_q[cnt];
+        reg_load[NumCtrlRegs + cnt] = '1;
+      end
+
+    if (perf_ctrl[PerfCtrlClear])
+      perf_cnt_d = '0;
+
+    // Acknowledge the commands
+    if (perf_ctrl[PerfCtrlClear] || perf_ctrl[PerfCtrlSnapshot]) begin
+      reg_d[PerfCtrlReg]                   = perf_ctrl;
+      reg_d[PerfCtrlReg][PerfCtrlClear]    = 1'b0;
+      reg_d[PerfCtrlReg][PerfCtrlSnapshot] = 1'b0;
+      reg_load[PerfCtrlReg]                = '1;
+    end
+  end: p_perf_cnt
+
+  `FF(perf_cnt_q, perf_cnt_d, '0);
+
   /////////////////
   //   Signals   //
   /////////////////
 
   assign hw_cnt_en_o      = hw_cnt_en;
+  assign pf_ctrl_o        = pf_ctrl;
   assign event_trigger_o  = event_trigger;
   assign dram_base_addr_o = dram_base_address;
   assign dram_end_addr_o  = dram_end_address;
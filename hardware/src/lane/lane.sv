@@ -70,7 +70,6 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     output logic                                           sldu_operand_valid_o,
     output logic                                           addrgen_operand_valid_o,
     input  logic                                           sldu_operand_ready_i,
-    input  sldu_mux_e                                      sldu_mux_sel_i,
     input  logic                                           addrgen_operand_ready_i,
     // Interface with the Slide unit
     input  logic                                           sldu_result_req_i,
@@ -81,6 +80,19 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     output logic                                           sldu_result_gnt_o,
     input  logic                                           sldu_red_valid_i,
     output logic                                           sldu_result_final_gnt_o,
+    // Interface with the reduction networks
+    output elen_t                                          alu_red_operand_o,
+    output logic                                           alu_red_valid_o,
+    input  logic                                           alu_red_ready_i,
+    input  elen_t                                          alu_red_result_i,
+    input  logic                                           alu_red_result_valid_i,
+    output logic                                           alu_red_result_ready_o,
+    output elen_t                                          mfpu_red_operand_o,
+    output logic                                           mfpu_red_valid_o,
+    input  logic                                           mfpu_red_ready_i,
+    input  elen_t                                          mfpu_red_result_i,
+    input  logic                                           mfpu_red_result_valid_i,
+    output logic                                           mfpu_red_result_ready_o,
     // Interface with the Load unit
     input  logic                                           ldu_result_req_i,
     input  vid_t                                           ldu_result_id_i,
@@ -106,7 +118,11 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     // Interface between the Mask unit and the VFUs
     input  strb_t                                          mask_i,
     input  logic                                           mask_valid_i,
-    output logic                                           mask_ready_o
+    output logic                                           mask_ready_o,
+    // Performance counters
+    output logic                                           hazard_stall_o,
+    output logic                                           vrf_conflict_o,
+    output logic                                           fpu_latency_stall_o
   );
 
   `include "common_cells/registers.svh"
@@ -130,6 +146,10 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     logic is_reduct; // Is this a reduction?
     logic is_slide; // Is this a slide?
 
+    // Unit-stride segment stores read the same word of all the nf + 1 fields in a row
+    logic [2:0] nf;            // Number of fields minus one
+    rvv_pkg::vlmul_e emul;     // Length multiplier of each field
+
     rvv_pkg::vew_e eew;        // Effective element width
     opqueue_conversion_e conv; // Type conversion
 
@@ -311,6 +331,13 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
   // Support for store exception flush
   logic                                       lsu_ex_flush_op_queues_d, lsu_ex_flush_op_queues_q;
   `FF(lsu_ex_flush_op_queues_q, lsu_ex_flush_op_queues_d, 1'b0, clk_i, rst_ni);
+  // View of the vector registers of the incoming instruction (register renaming)
+  vreg_copy_t                          [31:0] pe_req_vreg_copy;
+`ifdef NR_VREG_COPIES
+  assign pe_req_vreg_copy = pe_req.vreg_copy;
+`else
+  assign pe_req_vreg_copy = '0;
+`endif
 
   operand_requester #(
     .NrLanes              (NrLanes              ),
@@ -324,6 +351,9 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     .rst_ni                   (rst_ni                  ),
     // Interface with the main sequencer
     .global_hazard_table_i    (global_hazard_table_i   ),
+    .vreg_copy_id_i           (pe_req.id               ),
+    .vreg_copy_i              (pe_req_vreg_copy        ),
+    .vreg_copy_valid_i        (pe_req_valid_i          ),
     // Interface with the lane sequencer
     .operand_request_i        (operand_request         ),
     .operand_request_valid_i  (operand_request_valid   ),
@@ -381,7 +411,10 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     .ldu_result_wdata_i       (ldu_result_wdata_i      ),
     .ldu_result_be_i          (ldu_result_be_i         ),
     .ldu_result_gnt_o         (ldu_result_gnt_o        ),
-    .ldu_result_final_gnt_o   (ldu_result_final_gnt_o  )
+    .ldu_result_final_gnt_o   (ldu_result_final_gnt_o  ),
+    // Performance counters
+    .hazard_stall_o           (hazard_stall_o          ),
+    .bank_conflict_o          (vrf_conflict_o          )
   );
 
   ////////////////////////////
@@ -393,9 +426,9 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
   logic  [NrOperandQueues-1:0] vrf_operand_valid;
 
   vector_regfile #(
-    .VRFSize(VRFSizePerLane   ),
-    .NrBanks(NrVRFBanksPerLane),
-    .vaddr_t(vaddr_t          )
+    .VRFSize(VRFSizePerLane * NrVRegCopies),
+    .NrBanks(NrVRFBanksPerLane            ),
+    .vaddr_t(vaddr_t                      )
   ) i_vrf (
     .clk_i          (clk_i            ),
     .rst_ni         (rst_ni           ),
@@ -484,12 +517,16 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
   //  Vector Functional Units  //
   ///////////////////////////////
 
-  // Reductions
-  logic sldu_alu_gnt, sldu_mfpu_gnt;
-  logic sldu_alu_valid, sldu_mfpu_valid;
-  logic sldu_alu_req_valid_o, sldu_mfpu_req_valid_o;
-  logic sldu_alu_ready, sldu_mfpu_ready;
-  logic alu_red_complete, fpu_red_complete;
+  // Ordered reductions
+  logic sldu_mfpu_gnt;
+  logic sldu_mfpu_valid;
+  logic sldu_mfpu_req_valid_o;
+  logic sldu_mfpu_ready;
+  logic fpu_red_complete;
+
+  // The partial results of the unordered reductions are sent from the result queues
+  assign alu_red_operand_o  = alu_result_wdata;
+  assign mfpu_red_operand_o = mfpu_result_wdata;
 
   vector_fus_stage #(
     .NrLanes        (NrLanes        ),
@@ -518,7 +555,6 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     .mfpu_ready_o         (mfpu_ready                             ),
     .mfpu_vinsn_done_o    (mfpu_vinsn_done                        ),
     // Interface with the SLDU/ADDRGEN arbiter
-    .alu_red_complete_o   (alu_red_complete                       ),
     .fpu_red_complete_o   (fpu_red_complete                       ),
     // Interface with the operand requester
     // ALU
@@ -535,11 +571,18 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     .mfpu_result_wdata_o  (mfpu_result_wdata                      ),
     .mfpu_result_be_o     (mfpu_result_be                         ),
     .mfpu_result_gnt_i    (mfpu_result_gnt                        ),
+    // Interface with the reduction networks
+    .alu_red_valid_o      (alu_red_valid_o                        ),
+    .alu_red_ready_i      (alu_red_ready_i                        ),
+    .alu_red_result_i     (alu_red_result_i                       ),
+    .alu_red_result_valid_i(alu_red_result_valid_i                 ),
+    .alu_red_result_ready_o(alu_red_result_ready_o                 ),
+    .mfpu_red_valid_o     (mfpu_red_valid_o                       ),
+    .mfpu_red_ready_i     (mfpu_red_ready_i                       ),
+    .mfpu_red_result_i    (mfpu_red_result_i                      ),
+    .mfpu_red_result_valid_i(mfpu_red_result_valid_i                ),
+    .mfpu_red_result_ready_o(mfpu_red_result_ready_o                ),
     // Interface with the Slide Unit
-    .sldu_alu_req_valid_o (sldu_alu_req_valid_o                   ),
-    .sldu_alu_valid_i     (sldu_alu_valid                         ),
-    .sldu_alu_ready_o     (sldu_alu_ready                         ),
-    .sldu_alu_gnt_i       (sldu_alu_gnt                           ),
     .sldu_mfpu_req_valid_o(sldu_mfpu_req_valid_o                  ),
     .sldu_mfpu_valid_i    (sldu_mfpu_valid                        ),
     .sldu_mfpu_ready_o    (sldu_mfpu_ready                        ),
@@ -560,7 +603,9 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     .mask_operand_ready_i (mask_operand_ready_i[2 +: NrMaskFUnits]),
     .mask_i               (mask                                   ),
     .mask_valid_i         (mask_valid                             ),
-    .mask_ready_o         (mask_ready                             )
+    .mask_ready_o         (mask_ready                             ),
+    // Performance counters
+    .fpu_latency_stall_o  (fpu_latency_stall_o                    )
   );
 
   /******************************
@@ -568,19 +613,18 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
    *****************************/
 
   // The SLDU and the ADDRGEN share the same data bus from the lanes.
-  // This bus is connected to ALU, FPU, and one operand queue.
+  // This bus is connected to the FPU (ordered reductions) and one operand queue.
+  // The unordered reductions use the reduction networks instead.
   // Arbitration is necessary due to the serialization on the unique databus.
   // The easiest form of arbitration is to follow instruction order.
   typedef enum logic [1:0] {
     SLDU_SEL    = 2'd0,
     ADDRGEN_SEL = 2'd1,
-    ALU_RED_SEL = 2'd2,
-    FPU_RED_SEL = 2'd3
+    FPU_RED_SEL = 2'd2
   } sldu_addrgen_sel_e;
-  typedef enum logic [1:0] {
-    MUX_OPQUEUE_SEL = 2'd0,
-    MUX_ALU_SEL     = 2'd1,
-    MUX_FPU_SEL     = 2'd2
+  typedef enum logic {
+    MUX_OPQUEUE_SEL = 1'b0,
+    MUX_FPU_SEL     = 1'b1
   } sldu_addrgen_mux_sel_e;
   sldu_addrgen_sel_e sldu_addrgen_sel_d, sldu_addrgen_sel_q;
   sldu_addrgen_mux_sel_e sldu_addrgen_mux_sel;
@@ -629,11 +673,7 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
           sldu_addrgen_sel_d = ADDRGEN_SEL;
           sldu_addrgen_arbiter_push = 1'b1;
         end
-        [VREDSUM:VWREDSUM]: begin
-          sldu_addrgen_sel_d = ALU_RED_SEL;
-          sldu_addrgen_arbiter_push = 1'b1;
-        end
-        [VFREDUSUM:VFWREDOSUM]: begin
+        VFREDOSUM, VFWREDOSUM: begin
           sldu_addrgen_sel_d = FPU_RED_SEL;
           sldu_addrgen_arbiter_push = 1'b1;
         end
@@ -650,9 +690,6 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
         ADDRGEN_SEL: begin
           sldu_addrgen_arbiter_pop = sldu_addrgen_cmd_pop;
         end
-        ALU_RED_SEL: begin
-          sldu_addrgen_arbiter_pop = alu_red_complete;
-        end
         FPU_RED_SEL: begin
           sldu_addrgen_arbiter_pop = fpu_red_complete;
         end
@@ -660,9 +697,8 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
       endcase
     end
 
-    // MUX the alu, fpu, and opqueue stream
+    // MUX the fpu and opqueue stream
     unique case (sldu_addrgen_sel_q)
-      ALU_RED_SEL: sldu_addrgen_mux_sel = MUX_ALU_SEL;
       FPU_RED_SEL: sldu_addrgen_mux_sel = MUX_FPU_SEL;
       default: sldu_addrgen_mux_sel = MUX_OPQUEUE_SEL;
     endcase
@@ -671,11 +707,11 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
   // Stream MUX to select the transmitter
   stream_mux #(
     .DATA_T(elen_t),
-    .N_INP (3) // ALU, FPU, OpQueue
+    .N_INP (2) // FPU, OpQueue
   ) i_sldu_addrgen_stream_mux (
-    .inp_data_i ({mfpu_result_wdata, alu_result_wdata, sldu_addrgen_operand_opqueues}),
-    .inp_valid_i({sldu_mfpu_req_valid_o, sldu_alu_req_valid_o, sldu_operand_opqueues_valid}),
-    .inp_ready_o({sldu_mfpu_gnt, sldu_alu_gnt, sldu_operand_opqueues_ready}),
+    .inp_data_i ({mfpu_result_wdata, sldu_addrgen_operand_opqueues}),
+    .inp_valid_i({sldu_mfpu_req_valid_o, sldu_operand_opqueues_valid}),
+    .inp_ready_o({sldu_mfpu_gnt, sldu_operand_opqueues_ready}),
     .inp_sel_i  (sldu_addrgen_mux_sel),
     .oup_data_o (sldu_addrgen_operand_o),
     .oup_valid_o(sldu_operand_valid_o),
@@ -703,12 +739,9 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
       sldu_addrgen_opqueue_ready = addrgen_operand_ready_i;
   end
 
-  // During a reduction, the slide unit is directly connected to the functional units.
-  // The selectors are controlled by the slide unit itself, which must know what it will receive next.
-  assign sldu_alu_valid    = sldu_red_valid_i & (sldu_addrgen_sel_q == ALU_RED_SEL);
+  // During an ordered reduction, the slide unit is directly connected to the FPU.
   assign sldu_mfpu_valid   = sldu_red_valid_i & (sldu_addrgen_sel_q == FPU_RED_SEL);
-  assign sldu_result_gnt_o = sldu_addrgen_sel_q == SLDU_SEL ? sldu_result_gnt_opqueues :
-                            (sldu_addrgen_sel_q == ALU_RED_SEL ? sldu_alu_ready : sldu_mfpu_ready);
+  assign sldu_result_gnt_o = sldu_addrgen_sel_q == FPU_RED_SEL ? sldu_mfpu_ready : sldu_result_gnt_opqueues;
 
   //////////////////
   //  Assertions  //
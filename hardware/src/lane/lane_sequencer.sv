@@ -582,6 +582,8 @@ module lane_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::
             hazard  : pe_req.hazard_vs1 | pe_req.hazard_vd,
             target_fu : ALU_SLDU,
             cvt_resize: CVT_SAME,
+            nf      : pe_req.nf,
+            emul    : pe_req.emul,
             default : '0
           };
           // Since this request goes outside of the lane, we might need to request an
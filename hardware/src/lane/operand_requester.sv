@@ -23,6 +23,10 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
     input  logic                                       rst_ni,
     // Interface with the main sequencer
     input  logic            [NrVInsn-1:0][NrVInsn-1:0] global_hazard_table_i,
+    // Copies of the vector registers accessed by each instruction
+    input  vid_t                                       vreg_copy_id_i,
+    input  vreg_copy_t                          [31:0] vreg_copy_i,
+    input  logic                                       vreg_copy_valid_i,
     // Interface with the lane sequencer
     input  operand_request_cmd_t [NrOperandQueues-1:0] operand_request_i,
     input  logic                 [NrOperandQueues-1:0] operand_request_valid_i,
@@ -80,11 +84,44 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
     input  elen_t                                      ldu_result_wdata_i,
     input  strb_t                                      ldu_result_be_i,
     output logic                                       ldu_result_gnt_o,
-    output logic                                       ldu_result_final_gnt_o
+    output logic                                       ldu_result_final_gnt_o,
+    // Performance counters
+    output logic                                       hazard_stall_o,
+    output logic                                       bank_conflict_o
   );
 
   import cf_math_pkg::idx_width;
 
+  //////////////////////////////////
+  //  Vector register renaming  //
+  //////////////////////////////////
+
+  // Number of 64-bit words of a vector register, and of all the vector registers, in this lane
+  localparam int unsigned VRegWords = VLEN / NrLanes / $bits(elen_t);
+  localparam int unsigned VRFWords  = 32 * VRegWords;
+
+  // Copy of each vector register accessed by the instructions in flight
+  vreg_copy_t [NrVInsn-1:0][31:0] vreg_copy_q;
+
+  if (NrVRegCopies > 1) begin: gen_vreg_copy
+    always_ff @(posedge clk_i or negedge rst_ni) begin
+      if (!rst_ni) begin
+        vreg_copy_q <= '0;
+      end else if (vreg_copy_valid_i) begin
+        vreg_copy_q[vreg_copy_id_i] <= vreg_copy_i;
+      end
+    end
+  end: gen_vreg_copy else begin: gen_no_vreg_copy
+    assign vreg_copy_q = '0;
+  end: gen_no_vreg_copy
+
+  // Address of the bank row holding the word addr of instruction id. The copies of the
+  // vector registers are stacked after each other, so the bank of the word does not change.
+  function automatic vaddr_t vrf_row(vaddr_t addr, vid_t id);
+    automatic logic [4:0] vreg = 5'(addr >> $clog2(VRegWords));
+    vrf_row = (addr + vaddr_t'(vreg_copy_q[id][vreg]) * VRFWords) >> $clog2(NrBanks);
+  endfunction : vrf_row
+
   ////////////////////////
   //  Stream registers  //
   ////////////////////////
@@ -255,6 +292,13 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
     logic is_widening;
     // One-bit counters
     logic [NrVInsn-1:0] waw_hazard_counter;
+
+    // Unit-stride segment stores read the same word of all the nf + 1 fields in a row.
+    // Field being read, its address offset, and the offset between two fields.
+    logic [2:0] nf;
+    logic [2:0] field;
+    vaddr_t field_addr;
+    vaddr_t field_stride;
   } requester_metadata_t;
 
   for (genvar b = 0; b < NrBanks; b++) begin
@@ -263,6 +307,9 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
     end
   end
 
+  // Requesters that have an operand queue ready, but are stalled by a hazard
+  logic [NrOperandQueues-1:0] requester_hazard_stall;
+
   for (genvar requester_index = 0; requester_index < NrOperandQueues; requester_index++) begin : gen_operand_requester
     // State of this operand requester_index
     state_t state_d, state_q;
@@ -274,6 +321,9 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
     assign stall = |(requester_metadata_q.hazard & ~(vinsn_result_written_q &
                    (~{NrVInsn{requester_metadata_q.is_widening}} | requester_metadata_q.waw_hazard_counter)));
 
+    assign requester_hazard_stall[requester_index] = (state_q == REQUESTING) &&
+      operand_queue_ready_i[requester_index] && stall;
+
     // Did we get a grant?
     logic [NrBanks-1:0] operand_requester_gnt;
     for (genvar bank = 0; bank < NrBanks; bank++) begin: gen_operand_requester_gnt
@@ -295,8 +345,10 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
       automatic elen_t vector_body_len_byte;
       automatic elen_t scaled_vector_len_elements;
 
+      // Address we are currently requesting
+      automatic vaddr_t req_addr = requester_metadata_q.addr + requester_metadata_q.field_addr;
       // Bank we are currently requesting
-      automatic int bank = requester_metadata_q.addr[idx_width(NrBanks)-1:0];
+      automatic int bank = req_addr[idx_width(NrBanks)-1:0];
 
       // Maintain state
       state_d     = state_q;
@@ -345,6 +397,10 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
         vew         : operand_request_i[requester_index].eew,
         hazard      : operand_request_i[requester_index].hazard,
         is_widening : operand_request_i[requester_index].cvt_resize == CVT_WIDE,
+        nf          : operand_request_i[requester_index].nf,
+        field_stride: vaddr(operand_request_i[requester_index].emul[2]
+                          ? 5'd1
+                          : 5'd1 << operand_request_i[requester_index].emul[1:0], NrLanes, VLEN),
         default: '0
       };
       operand_queue_cmd_tmp = '{
@@ -355,6 +411,12 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
         target_fu : operand_request_i[requester_index].target_fu,
         is_reduct : operand_request_i[requester_index].is_reduct
       };
+      // The operand queue forwards the words of all the fields, and counts whole words
+      if (operand_request_i[requester_index].nf != '0)
+        operand_queue_cmd_tmp.elem_count = ((((effective_vector_body_length - 1) >>
+          (unsigned'(EW64) - unsigned'(operand_request_i[requester_index].eew))) + 1) <<
+          (unsigned'(EW64) - unsigned'(operand_request_i[requester_index].eew))) *
+          (operand_request_i[requester_index].nf + 1);
 
       case (state_q)
         IDLE: begin : state_q_IDLE
@@ -404,24 +466,34 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
             // Operand request
             lane_operand_req_transposed[requester_index][bank] = !stall;
             operand_payload[requester_index]   = '{
-              addr   : requester_metadata_q.addr >> $clog2(NrBanks),
+              addr   : vrf_row(req_addr, requester_metadata_q.id),
               opqueue: opqueue_e'(requester_index),
               default: '0 // this is a read operation
             };
 
             // Received a grant.
             if (|operand_requester_gnt) begin : op_req_grant
-              // Bump the address pointer
-              requester_metadata_d.addr = requester_metadata_q.addr + 1'b1;
-
-              // We read less than 64 bits worth of elements
-              num_elements = ( 1 << ( unsigned'(EW64) - unsigned'(requester_metadata_q.vew) ) );
-              if (requester_metadata_q.len < num_elements) begin
-                requester_metadata_d.len    = 0;
-              end
-              else begin
-                requester_metadata_d.len = requester_metadata_q.len - num_elements;
-              end
+              if (requester_metadata_q.field != requester_metadata_q.nf) begin : next_field
+                // Same word of the next field
+                requester_metadata_d.field      = requester_metadata_q.field + 1;
+                requester_metadata_d.field_addr = requester_metadata_q.field_addr +
+                                                  requester_metadata_q.field_stride;
+              end : next_field else begin : next_word
+                requester_metadata_d.field      = '0;
+                requester_metadata_d.field_addr = '0;
+
+                // Bump the address pointer
+                requester_metadata_d.addr = requester_metadata_q.addr + 1'b1;
+
+                // We read less than 64 bits worth of elements
+                num_elements = ( 1 << ( unsigned'(EW64) - unsigned'(requester_metadata_q.vew) ) );
+                if (requester_metadata_q.len < num_elements) begin
+                  requester_metadata_d.len    = 0;
+                end
+                else begin
+                  requester_metadata_d.len = requester_metadata_q.len - num_elements;
+                end
+              end : next_word
             end : op_req_grant
 
             // Finished requesting all the elements
@@ -505,7 +577,7 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
 
     // Generate the payloads for write back operations
     operand_payload[NrOperandQueues + VFU_Alu] = '{
-      addr   : alu_result_addr_i >> $clog2(NrBanks),
+      addr   : vrf_row(alu_result_addr_i, alu_result_id_i),
       wen    : 1'b1,
       wdata  : alu_result_wdata_i,
       be     : alu_result_be_i,
@@ -513,7 +585,7 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
       default: '0
     };
     operand_payload[NrOperandQueues + VFU_MFpu] = '{
-      addr   : mfpu_result_addr_i >> $clog2(NrBanks),
+      addr   : vrf_row(mfpu_result_addr_i, mfpu_result_id_i),
       wen    : 1'b1,
       wdata  : mfpu_result_wdata_i,
       be     : mfpu_result_be_i,
@@ -521,7 +593,7 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
       default: '0
     };
     operand_payload[NrOperandQueues + VFU_MaskUnit] = '{
-      addr   : masku_result_addr >> $clog2(NrBanks),
+      addr   : vrf_row(masku_result_addr, masku_result_id),
       wen    : 1'b1,
       wdata  : masku_result_wdata,
       be     : masku_result_be,
@@ -529,7 +601,7 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
       default: '0
     };
     operand_payload[NrOperandQueues + VFU_SlideUnit] = '{
-      addr   : sldu_result_addr >> $clog2(NrBanks),
+      addr   : vrf_row(sldu_result_addr, sldu_result_id),
       wen    : 1'b1,
       wdata  : sldu_result_wdata,
       be     : sldu_result_be,
@@ -537,7 +609,7 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
       default: '0
     };
     operand_payload[NrOperandQueues + VFU_LoadUnit] = '{
-      addr   : ldu_result_addr >> $clog2(NrBanks),
+      addr   : vrf_row(ldu_result_addr, ldu_result_id),
       wen    : 1'b1,
       wdata  : ldu_result_wdata,
       be     : ldu_result_be,
@@ -646,4 +718,17 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
     );
   end : gen_vrf_arbiters
 
+  //////////////////////////
+  //  Performance events  //
+  //////////////////////////
+
+  // Did any requester lose a VRF bank to another one?
+  logic [NrBanks-1:0] bank_conflict;
+  for (genvar bank = 0; bank < NrBanks; bank++) begin: gen_bank_conflict
+    assign bank_conflict[bank] = |({ext_operand_req[bank], lane_operand_req[bank]} & ~operand_gnt[bank]);
+  end: gen_bank_conflict
+
+  assign hazard_stall_o  = |requester_hazard_stall;
+  assign bank_conflict_o = |bank_conflict;
+
 endmodule : operand_requester
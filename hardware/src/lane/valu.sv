@@ -32,8 +32,6 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
     input  logic                         vfu_operation_valid_i,
     output logic                         alu_ready_o,
     output logic           [NrVInsn-1:0] alu_vinsn_done_o,
-    // Interface with the lane
-    output logic                         alu_red_complete_o,
     // Interface with the operand queues
     input  elen_t          [1:0]         alu_operand_i,
     input  logic           [1:0]         alu_operand_valid_i,
@@ -45,12 +43,12 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
     output elen_t                        alu_result_wdata_o,
     output strb_t                        alu_result_be_o,
     input  logic                         alu_result_gnt_i,
-    // Interface with the Slide Unit
+    // Interface with the reduction network
     output logic                         alu_red_valid_o,
     input  logic                         alu_red_ready_i,
-    input  elen_t                        sldu_operand_i,
-    input  logic                         sldu_alu_valid_i,
-    output logic                         sldu_alu_ready_o,
+    input  elen_t                        red_result_i,
+    input  logic                         red_result_valid_i,
+    output logic                         red_result_ready_o,
     // Interface with the Mask unit
     output elen_t                        mask_operand_o,
     output logic                         mask_operand_valid_o,
@@ -240,26 +238,12 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
   //  Reductions  //
   //////////////////
 
-  // Cut the path between the SLDU and the ALU. This increases latency
-  // but does has negligible impact on long vectors
-  elen_t sldu_operand_q;
-  logic  sldu_alu_valid_q, sldu_alu_ready_d;
-  spill_register #(
-    .T(elen_t)
-  ) i_alu_reduction_spill_register (
-    .clk_i  (clk_i           ),
-    .rst_ni (rst_ni          ),
-    .valid_i(sldu_alu_valid_i),
-    .ready_o(sldu_alu_ready_o),
-    .data_i (sldu_operand_i  ),
-    .valid_o(sldu_alu_valid_q),
-    .ready_i(sldu_alu_ready_d),
-    .data_o (sldu_operand_q  )
-  );
+  // The partial results are exchanged with the other lanes through the reduction
+  // network, whose outputs are registered.
 
   // This function returns 1'b1 if `op` is a reduction instruction, i.e.,
   // it must accumulate the result (intra-lane reduction) before sending it to the
-  // sliding unit (inter-lane and SIMD reduction).
+  // reduction network (inter-lane and SIMD reduction).
   function automatic logic is_reduction(ara_op_e op);
     is_reduction = 1'b0;
     if (op inside {[VREDSUM:VWREDSUM]})
@@ -306,7 +290,7 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
   endfunction: reduction_rx_cnt_init
 
   // Count how many transactions we must do in total to complete the reduction operation
-  logic [idx_width($clog2(NrLanes)+1):0] sldu_transactions_cnt_d, sldu_transactions_cnt_q;
+  logic [idx_width($clog2(NrLanes)+1):0] red_transactions_cnt_d, red_transactions_cnt_q;
 
   // Counter to drive SIMD reductions
   logic [1:0] simd_red_cnt_d, simd_red_cnt_q;
@@ -315,10 +299,6 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
   // the operation is performed between the first vector element and the scalar.
   logic first_op_d, first_op_q;
 
-  // The ALU has completed a reduction
-  logic alu_red_complete_d;
-  `FF(alu_red_complete_o, alu_red_complete_d, 1'b0, clk_i, rst_ni);
-
   // Signal to indicate the state of the ALU
   typedef enum logic [2:0] {NO_REDUCTION, INTRA_LANE_REDUCTION, INTER_LANES_REDUCTION_RX, INTER_LANES_REDUCTION_TX, LN0_REDUCTION_COMMIT, SIMD_REDUCTION} alu_state_e;
   alu_state_e alu_state_d, alu_state_q;
@@ -344,7 +324,7 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
                         ? result_queue_q[result_queue_write_pnt_q].wdata
                         : vinsn_issue_q.use_scalar_op ? scalar_op : alu_operand_i[0];
   assign alu_operand_b  = (alu_state_q inside {INTER_LANES_REDUCTION_RX, SIMD_REDUCTION})
-                        ? alu_state_q == SIMD_REDUCTION ? simd_red_operand : sldu_operand_q
+                        ? alu_state_q == SIMD_REDUCTION ? simd_red_operand : red_result_i
                         : alu_operand_i[1];
 
   ///////////////////
@@ -428,17 +408,15 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
     first_op_d              = first_op_q;
     simd_red_cnt_d          = simd_red_cnt_q;
     reduction_rx_cnt_d      = reduction_rx_cnt_q;
-    sldu_transactions_cnt_d = sldu_transactions_cnt_q;
+    red_transactions_cnt_d  = red_transactions_cnt_q;
     alu_red_valid_o         = 1'b0;
-    sldu_alu_ready_d        = 1'b0;
+    red_result_ready_o      = 1'b0;
     simd_red_cnt_max_d      = simd_red_cnt_max_q;
     simd_red_operand        = '0;
     red_mask                = '0;
 
     vxsat_flag_o            = '0;
 
-    alu_red_complete_d = 1'b0;
-
     // Do not issue any operations
     valu_valid  = 1'b0;
     alu_state_d = alu_state_q;
@@ -613,9 +591,9 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
           // If the workload is unbalanced and some lanes already have commit_cnt == '0,
           // delay the commit until we are over with the inter-lanes phase
           prevent_commit = 1'b1;
-          // Send the result to the SLDU
+          // Send the result to the reduction network
           alu_red_valid_o = 1'b1;
-          // Get ready for the result from the SLDU
+          // Get ready for the result from the reduction network
           if (alu_red_ready_i)
             alu_state_d = INTER_LANES_REDUCTION_RX;
         end
@@ -624,12 +602,12 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
           // delay the commit until we are over with the inter-lanes phase
           prevent_commit = 1'b1;
           // This unit should either still participate to the reduction or
-          // just handshake the SLDU to sync with the still active lanes
-          if (sldu_alu_valid_q) begin
-            // Handshake the SLDU
-            sldu_alu_ready_d = 1'b1;
-            // Count the successful transaction with the SLDU
-            sldu_transactions_cnt_d = sldu_transactions_cnt_q - 1;
+          // just handshake the reduction network to sync with the still active lanes
+          if (red_result_valid_i) begin
+            // Handshake the reduction network
+            red_result_ready_o = 1'b1;
+            // Count the successful transaction with the reduction network
+            red_transactions_cnt_d = red_transactions_cnt_q - 1;
             // Is this lane active?
             if (reduction_rx_cnt_q != '0) begin
               // Issue the operation
@@ -640,11 +618,11 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
               reduction_rx_cnt_d = reduction_rx_cnt_q - 1;
             end
             // Is this the last cycle for the INTER-LANES phase?
-            if (sldu_transactions_cnt_q == 1) begin
+            if (red_transactions_cnt_q == 1) begin
               // Lane 0 is receiving an already processed result
               // and needs to SIMD-reduce the result
               if (lane_id_i == '0) begin
-                result_queue_d[result_queue_write_pnt_q].wdata = sldu_operand_q;
+                result_queue_d[result_queue_write_pnt_q].wdata = red_result_i;
                 unique case (vinsn_commit.vtype.vsew)
                     EW8 : simd_red_cnt_max_d = 2'd3;
                     EW16: simd_red_cnt_max_d = 2'd2;
@@ -659,7 +637,7 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
                 alu_state_d = LN0_REDUCTION_COMMIT;
               end
             end else begin
-              // Send the result to the SLDU during next cycle
+              // Send the result to the reduction network during next cycle
               alu_state_d = INTER_LANES_REDUCTION_TX;
             end
           end
@@ -782,16 +760,13 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
       if (vinsn_queue_d.commit_cnt != '0)
         commit_cnt_d = vinsn_queue_q.vinsn[vinsn_queue_d.commit_pnt].vl;
 
-      // If this was a reduction, clean the Lane SLDU/ADDRGEN arbiter
-      if (is_reduction(vinsn_commit.op)) alu_red_complete_d = 1'b1;
-
       // Initialize counters and alu state if needed by the next instruction
       // After a reduction, the next instructions starts after the reduction commits
       if (is_reduction(vinsn_queue_q.vinsn[vinsn_queue_d.issue_pnt].op) && (vinsn_queue_d.issue_cnt != '0)) begin
         // Initialize reduction-related sequential elements
         first_op_d              = 1'b1;
         reduction_rx_cnt_d      = reduction_rx_cnt_init(NrLanes, lane_id_i);
-        sldu_transactions_cnt_d = $clog2(NrLanes) + 1;
+        red_transactions_cnt_d  = $clog2(NrLanes) + 1;
 
         alu_state_d = INTRA_LANE_REDUCTION;
       end else begin
@@ -825,7 +800,7 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
         // Initialize reduction-related sequential elements
         first_op_d              = 1'b1;
         reduction_rx_cnt_d      = reduction_rx_cnt_init(NrLanes, lane_id_i);
-        sldu_transactions_cnt_d = $clog2(NrLanes) + 1;
+        red_transactions_cnt_d  = $clog2(NrLanes) + 1;
 
         issue_cnt_d = vfu_operation_i.vl;
       end
@@ -857,7 +832,7 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
       alu_state_q             <= NO_REDUCTION;
       reduction_rx_cnt_q      <= '0;
       first_op_q              <= 1'b0;
-      sldu_transactions_cnt_q <= '0;
+      red_transactions_cnt_q  <= '0;
       simd_red_cnt_max_q      <= '0;
       alu_vxsat_q             <= '0;
     end else begin
@@ -868,7 +843,7 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
       alu_state_q             <= alu_state_d;
       reduction_rx_cnt_q      <= reduction_rx_cnt_d;
       first_op_q              <= first_op_d;
-      sldu_transactions_cnt_q <= sldu_transactions_cnt_d;
+      red_transactions_cnt_q  <= red_transactions_cnt_d;
       simd_red_cnt_max_q      <= simd_red_cnt_max_d;
       alu_vxsat_q             <= alu_vxsat_d;
     end
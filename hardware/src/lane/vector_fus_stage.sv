@@ -42,7 +42,6 @@ module vector_fus_stage import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg
     output logic                              mfpu_ready_o,
     output logic           [NrVInsn-1:0]      mfpu_vinsn_done_o,
     // Interface with the lane
-    output logic                              alu_red_complete_o,
     output logic                              fpu_red_complete_o,
     // Interface with the operand queues
     input  elen_t          [1:0]              alu_operand_i,
@@ -65,12 +64,19 @@ module vector_fus_stage import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg
     output elen_t                             mfpu_result_wdata_o,
     output strb_t                             mfpu_result_be_o,
     input  logic                              mfpu_result_gnt_i,
-    // Interface with the Slide Unit
+    // Interface with the reduction networks
+    output logic                              alu_red_valid_o,
+    input  logic                              alu_red_ready_i,
+    input  elen_t                             alu_red_result_i,
+    input  logic                              alu_red_result_valid_i,
+    output logic                              alu_red_result_ready_o,
+    output logic                              mfpu_red_valid_o,
+    input  logic                              mfpu_red_ready_i,
+    input  elen_t                             mfpu_red_result_i,
+    input  logic                              mfpu_red_result_valid_i,
+    output logic                              mfpu_red_result_ready_o,
+    // Interface with the Slide Unit (ordered reductions)
     input  elen_t                             sldu_operand_i,
-    output logic                              sldu_alu_req_valid_o,
-    input  logic                              sldu_alu_valid_i,
-    output logic                              sldu_alu_ready_o,
-    input  logic                              sldu_alu_gnt_i,
     output logic                              sldu_mfpu_req_valid_o,
     input  logic                              sldu_mfpu_valid_i,
     output logic                              sldu_mfpu_ready_o,
@@ -81,7 +87,9 @@ module vector_fus_stage import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg
     input  logic           [NrMaskFUnits-1:0] mask_operand_ready_i,
     input  strb_t                             mask_i,
     input  logic                              mask_valid_i,
-    output logic                              mask_ready_o
+    output logic                              mask_ready_o,
+    // Performance counters
+    output logic                              fpu_latency_stall_o
   );
 
   ///////////////
@@ -122,8 +130,6 @@ module vector_fus_stage import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg
     .vfu_operation_valid_i(vfu_operation_valid_i          ),
     .alu_ready_o          (alu_ready_o                    ),
     .alu_vinsn_done_o     (alu_vinsn_done_o               ),
-    // Interface with the lane
-    .alu_red_complete_o   (alu_red_complete_o             ),
     // Interface with the operand queues
     .alu_operand_i        (alu_operand_i                  ),
     .alu_operand_valid_i  (alu_operand_valid_i            ),
@@ -135,13 +141,12 @@ module vector_fus_stage import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg
     .alu_result_wdata_o   (alu_result_wdata_o             ),
     .alu_result_be_o      (alu_result_be_o                ),
     .alu_result_gnt_i     (alu_result_gnt_i               ),
-    // Interface with the Slide Unit
-    .alu_red_valid_o      (sldu_alu_req_valid_o           ),
-    .sldu_operand_i       (sldu_operand_i                 ),
-    .sldu_alu_valid_i     (sldu_alu_valid_i               ),
-    .sldu_alu_ready_o     (sldu_alu_ready_o               ),
-    // Interface with the Slide Unit
-    .alu_red_ready_i      (sldu_alu_gnt_i),
+    // Interface with the reduction network
+    .alu_red_valid_o      (alu_red_valid_o                ),
+    .alu_red_ready_i      (alu_red_ready_i                ),
+    .red_result_i         (alu_red_result_i               ),
+    .red_result_valid_i   (alu_red_result_valid_i         ),
+    .red_result_ready_o   (alu_red_result_ready_o         ),
     // Interface with the Mask unit
     .mask_operand_o       (mask_operand_o[MaskFUAlu]      ),
     .mask_operand_valid_o (mask_operand_valid_o[MaskFUAlu]),
@@ -192,19 +197,27 @@ module vector_fus_stage import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg
     .mfpu_result_wdata_o  (mfpu_result_wdata_o             ),
     .mfpu_result_be_o     (mfpu_result_be_o                ),
     .mfpu_result_gnt_i    (mfpu_result_gnt_i               ),
+    // Interface with the reduction network
+    .mfpu_red_valid_o     (mfpu_red_valid_o                ),
+    .mfpu_red_ready_i     (mfpu_red_ready_i                ),
+    .red_result_i         (mfpu_red_result_i               ),
+    .red_result_valid_i   (mfpu_red_result_valid_i         ),
+    .red_result_ready_o   (mfpu_red_result_ready_o         ),
     // Interface with the Slide Unit
-    .mfpu_red_valid_o     (sldu_mfpu_req_valid_o           ),
+    .mfpu_osum_valid_o    (sldu_mfpu_req_valid_o           ),
     .sldu_operand_i       (sldu_operand_i                  ),
     .sldu_mfpu_valid_i    (sldu_mfpu_valid_i               ),
     .sldu_mfpu_ready_o    (sldu_mfpu_ready_o               ),
-    .mfpu_red_ready_i     (sldu_mfpu_gnt_i                 ),
+    .mfpu_osum_ready_i    (sldu_mfpu_gnt_i                 ),
     // Interface with the Mask unit
     .mask_operand_o       (mask_operand_o[MaskFUMFpu]      ),
     .mask_operand_valid_o (mask_operand_valid_o[MaskFUMFpu]),
     .mask_operand_ready_i (mask_operand_ready_i[MaskFUMFpu]),
     .mask_i               (mask_i                          ),
     .mask_valid_i         (mask_valid_i                    ),
-    .mask_ready_o         (mfpu_mask_ready                 )
+    .mask_ready_o         (mfpu_mask_ready                 ),
+    // Performance counters
+    .latency_stall_o      (fpu_latency_stall_o             )
   );
 
 endmodule : vector_fus_stage
@@ -54,9 +54,15 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
     output elen_t                        mfpu_result_wdata_o,
     output strb_t                        mfpu_result_be_o,
     input  logic                         mfpu_result_gnt_i,
-    // Interface with the Slide Unit
+    // Interface with the reduction network (unordered reductions)
     output logic                         mfpu_red_valid_o,
     input  logic                         mfpu_red_ready_i,
+    input  elen_t                        red_result_i,
+    input  logic                         red_result_valid_i,
+    output logic                         red_result_ready_o,
+    // Interface with the Slide Unit (ordered reductions)
+    output logic                         mfpu_osum_valid_o,
+    input  logic                         mfpu_osum_ready_i,
     input  elen_t                        sldu_operand_i,
     input  logic                         sldu_mfpu_valid_i,
     output logic                         sldu_mfpu_ready_o,
@@ -66,7 +72,9 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
     input  logic                         mask_operand_ready_i,
     input  strb_t                        mask_i,
     input  logic                         mask_valid_i,
-    output logic                         mask_ready_o
+    output logic                         mask_ready_o,
+    // Performance counters
+    output logic                         latency_stall_o
   );
 
   // Power gating registers
@@ -566,8 +574,9 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
   //  Reductions  //
   //////////////////
 
-  // Cut the path between the SLDU and the MFPU. This increase latency
-  // but does has negligible impact on long vectors
+  // Cut the path between the SLDU and the MFPU, used by the ordered reductions.
+  // This increase latency but does has negligible impact on long vectors.
+  // The unordered reductions use the reduction network, whose outputs are registered.
   elen_t sldu_operand_q;
   logic  sldu_mfpu_valid_q, sldu_mfpu_ready_d;
   spill_register #(
@@ -598,7 +607,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
   logic prevent_commit;
 
   // Count how many transactions we must do in total to complete the reduction operation
-  logic [idx_width($clog2(NrLanes)+1):0] sldu_transactions_cnt_d, sldu_transactions_cnt_q;
+  logic [idx_width($clog2(NrLanes)+1):0] red_transactions_cnt_d, red_transactions_cnt_q;
 
   // Handshake synchronizer
   // Since the SLDU must receive a valid signals also from lanes that should not send anything,
@@ -614,7 +623,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
   // This signal has the highest privilage in multiple if-else loops
   logic first_op_d, first_op_q;
 
-  // Inform the lane SLDU/ADDRGEN arbiter that this reduction is over
+  // Inform the lane SLDU/ADDRGEN arbiter that this ordered reduction is over
   logic fpu_red_complete_d;
   `FF(fpu_red_complete_o, fpu_red_complete_d, 1'b0, clk_i, rst_ni);
 
@@ -654,7 +663,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
 
   // This function returns 1'b1 if `op` is a reduction instruction, i.e.,
   // it must accumulate the result (intra-lane reduction) before sending it to the
-  // sliding unit (inter-lane and SIMD reduction).
+  // reduction network (inter-lane and SIMD reduction).
   function automatic logic is_reduction(ara_op_e op);
     is_reduction = 1'b0;
     if (op inside {[VFREDUSUM:VFWREDOSUM]})
@@ -1369,6 +1378,8 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
   fpu_latency_t vinsn_issue_lat_d, vinsn_processing_lat_d;
   logic latency_stall, latency_problem_d, latency_problem_q;
 
+  assign latency_stall_o = latency_stall;
+
   always_comb begin: p_vmfpu
     // Maintain state
     vinsn_queue_d    = vinsn_queue_q;
@@ -1461,9 +1472,11 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
     first_op_d              = first_op_q;
     simd_red_cnt_d          = simd_red_cnt_q;
     reduction_rx_cnt_d      = reduction_rx_cnt_q;
-    sldu_transactions_cnt_d = sldu_transactions_cnt_q;
+    red_transactions_cnt_d  = red_transactions_cnt_q;
     red_hs_synch_d          = red_hs_synch_q;
     mfpu_red_valid_o        = 1'b0;
+    red_result_ready_o      = 1'b0;
+    mfpu_osum_valid_o       = 1'b0;
     sldu_mfpu_ready_d       = 1'b0;
     simd_red_cnt_max_d      = simd_red_cnt_max_q;
     simd_red_operand        = '0;
@@ -1898,7 +1911,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
         end else begin
           // Wait until the operand is valid in the result queue
           if (result_queue_valid_q[result_queue_write_pnt_q]) begin
-            // This unit has finished processing data for this reduction instruction, send the partial result to the sliding unit
+            // This unit has finished processing data for this reduction instruction, send the partial result to the reduction network
             mfpu_red_valid_o = 1'b1;
             if (mfpu_red_ready_i) begin
               mfpu_state_d = INTER_LANES_REDUCTION_RX;
@@ -1911,24 +1924,24 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
         // delay the commit until we are over with the inter-lanes phase
         prevent_commit = 1'b1;
         // This unit should either still participate to the reduction or
-        // just handshake the SLDU to sync with the still active lanes
-        if (sldu_mfpu_valid_q) begin
+        // just handshake the reduction network to sync with the still active lanes
+        if (red_result_valid_i) begin
           // If the lane is still active, issue the operands
           if (reduction_rx_cnt_q != '0) begin
-            operand_a = sldu_operand_q;
+            operand_a = red_result_i;
             operand_b = result_queue_q[result_queue_write_pnt_q].wdata;
-            operand_c = sldu_operand_q;
+            operand_c = red_result_i;
             // Wait for operand_b to be valid
             if (result_queue_valid_q[result_queue_write_pnt_q]) begin
               // Issue the operation
               vfpu_in_valid = 1'b1;
               // Wait for the unit
               if (vfpu_in_ready) begin
-                // Handshake the SLDU
-                sldu_mfpu_ready_d = 1'b1;
-                // Count the successful transaction with the SLDU
-                sldu_transactions_cnt_d = sldu_transactions_cnt_q - 1;
-                // Send the result to the SLDU during next cycle
+                // Handshake the reduction network
+                red_result_ready_o = 1'b1;
+                // Count the successful transaction with the reduction network
+                red_transactions_cnt_d = red_transactions_cnt_q - 1;
+                // Send the result to the reduction network during next cycle
                 reduction_rx_cnt_d = reduction_rx_cnt_q - 1;
                 // Disable the used operand
                 result_queue_valid_d[result_queue_write_pnt_q] = 1'b0;
@@ -1936,16 +1949,16 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
             end
           // If the lane is not active anymore, just sync with the other lanes
           end else begin
-            // Handshake the SLDU
-            sldu_mfpu_ready_d = 1'b1;
-            // Count the successful transaction with the SLDU
-            sldu_transactions_cnt_d = sldu_transactions_cnt_q - 1;
+            // Handshake the reduction network
+            red_result_ready_o = 1'b1;
+            // Count the successful transaction with the reduction network
+            red_transactions_cnt_d = red_transactions_cnt_q - 1;
             // Is this the last cycle for the INTER-LANES phase?
-            if (sldu_transactions_cnt_q == 1) begin
+            if (red_transactions_cnt_q == 1) begin
               // Lane 0 is receiving an already processed result
               // and needs to SIMD-reduce the result
               if (lane_id_i == '0) begin
-                result_queue_d[result_queue_write_pnt_q].wdata = sldu_operand_q;
+                result_queue_d[result_queue_write_pnt_q].wdata = red_result_i;
                 result_queue_valid_d[result_queue_write_pnt_q] = 1'b1;
                 unique case (vinsn_commit.vtype.vsew)
                     EW8 : simd_red_cnt_max_d = 2'd3;
@@ -1967,7 +1980,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
           end
         end
         // If we have a valid result from the FPU,
-        // write it in the queue and send it to the SLDU
+        // write it in the queue and send it to the reduction network
         if (vfpu_out_valid && !result_queue_full) begin
           result_queue_d[result_queue_write_pnt_q].wdata = vfpu_processed_result;
           result_queue_valid_d[result_queue_write_pnt_q] = 1'b1;
@@ -2051,7 +2064,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
         end
 
         // Ready to accept incoming operands from the slide unit.
-        mfpu_red_valid_o = red_hs_synch_q;
+        mfpu_osum_valid_o = red_hs_synch_q;
 
         // Issue the uOp
         if (operands_valid && vinsn_issue_q_valid && issue_cnt_q != '0) begin
@@ -2103,7 +2116,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
         end
 
         // Slide unit has acknowledged the operand, set next valid to 0
-        if (mfpu_red_valid_o && mfpu_red_ready_i) begin
+        if (mfpu_osum_valid_o && mfpu_osum_ready_i) begin
           red_hs_synch_d = 1'b0;
           result_queue_valid_d[result_queue_write_pnt_q] = 1'b0;
         end
@@ -2167,7 +2180,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
           // This information is useful for reduction operation
           first_op_d         = 1'b1;
           reduction_rx_cnt_d = reduction_rx_cnt_init(NrLanes, lane_id_i);
-          sldu_transactions_cnt_d = $clog2(NrLanes) + 1;
+          red_transactions_cnt_d = $clog2(NrLanes) + 1;
           // Allow the first valid
           red_hs_synch_d = !(vinsn_issue_d.op inside {VFREDOSUM, VFWREDOSUM}) & is_reduction(vinsn_issue_d.op);
 
@@ -2236,8 +2249,8 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
       if (vinsn_queue_d.commit_cnt != '0)
         commit_cnt_d = vinsn_queue_q.vinsn[vinsn_queue_d.commit_pnt].vl;
 
-      // Tell the SLDU/ADDRGEN arbiter that we are over with this reduction
-      if (is_reduction(vinsn_commit.op)) begin
+      // Tell the SLDU/ADDRGEN arbiter that we are over with this ordered reduction
+      if (vinsn_commit.op inside {VFREDOSUM, VFWREDOSUM}) begin
         fpu_red_complete_d = 1'b1;
       end
 
@@ -2250,7 +2263,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
           // This information is useful for reduction operation
           first_op_d         = 1'b1;
           reduction_rx_cnt_d = reduction_rx_cnt_init(NrLanes, lane_id_i);
-          sldu_transactions_cnt_d = $clog2(NrLanes) + 1;
+          red_transactions_cnt_d = $clog2(NrLanes) + 1;
           // Allow the first valid
           red_hs_synch_d = !(vinsn_issue_d.op inside {VFREDOSUM, VFWREDOSUM}) & is_reduction(vinsn_issue_d.op);
 
@@ -2293,7 +2306,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
         // This information is useful for reduction operation
         first_op_d              = 1'b1;
         reduction_rx_cnt_d      = reduction_rx_cnt_init(NrLanes, lane_id_i);
-        sldu_transactions_cnt_d = $clog2(NrLanes) + 1;
+        red_transactions_cnt_d = $clog2(NrLanes) + 1;
         // Allow the first valid
         red_hs_synch_d          =
           !(vfu_operation_i.op inside {VFREDOSUM, VFWREDOSUM}) & is_reduction(vfu_operation_i.op);
@@ -2362,7 +2375,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
       mfpu_state_q            <= NO_REDUCTION;
       reduction_rx_cnt_q      <= '0;
       first_op_q              <= 1'b0;
-      sldu_transactions_cnt_q <= '0;
+      red_transactions_cnt_q  <= '0;
       red_hs_synch_q          <= 1'b0;
       simd_red_cnt_max_q      <= '0;
       mfpu_red_ready_q        <= 1'b0;
@@ -2386,7 +2399,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
       mfpu_state_q            <= mfpu_state_d;
       reduction_rx_cnt_q      <= reduction_rx_cnt_d;
       first_op_q              <= first_op_d;
-      sldu_transactions_cnt_q <= sldu_transactions_cnt_d;
+      red_transactions_cnt_q  <= red_transactions_cnt_d;
       red_hs_synch_q          <= red_hs_synch_d;
       simd_red_cnt_max_q      <= simd_red_cnt_max_d;
       mfpu_red_ready_q        <= mfpu_red_ready_i;
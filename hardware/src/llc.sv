@@ -0,0 +1,629 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Last-level cache in front of the L2 memory. The cache is set-associative,
+// with NumWays ways and lines of LineBeats full-width beats, i.e., one line
+// per AXI burst of the VLSU. The tags are kept in flip-flops, the data in a
+// single-port SRAM.
+//
+// Reads and writes have separate paths, which run in parallel and share the
+// data SRAM. Up to MaxReads read bursts are accepted, whatever their ID, and
+// answered in order from the cache. A missing line is fetched from the memory
+// with a single burst. While the oldest read burst waits for its line, a
+// lookahead walks the lines of the younger bursts and fetches the missing
+// ones too, so that up to MaxFills line fills are in flight at the same time.
+// The fills all use the same AXI ID, and come back in order. A fill answered
+// with an error is not allocated, and the read bursts that need its line get
+// the error.
+//
+// The cache is write-through and does not allocate on writes: up to MaxWrites
+// write bursts are forwarded to the memory, and update the cached lines they
+// hit, so that the memory is always up to date and no line ever needs to be
+// written back. To keep the cached lines coherent, no line is fetched while a
+// write burst is in flight, and the fills in flight when a write burst is
+// accepted are not allocated if the burst overlaps their line.
+//
+// Every line touched by a read burst counts as one hit or one miss.
+
+module llc import axi_pkg::*; #(
+    // Capacity of the cache [B]
+    parameter  int  unsigned NumBytes     = 0,
+    parameter  int  unsigned NumWays      = 0,
+    // Length of a line, in beats
+    parameter  int  unsigned LineBeats    = 0,
+    // Outstanding read bursts, write bursts, and line fills
+    parameter  int  unsigned MaxReads     = 4,
+    parameter  int  unsigned MaxWrites    = 4,
+    parameter  int  unsigned MaxFills     = 4,
+    // AXI Interface parameters
+    parameter  int  unsigned AxiDataWidth = 0,
+    parameter  int  unsigned AxiAddrWidth = 0,
+    parameter  type          axi_ar_t     = logic,
+    parameter  type          axi_aw_t     = logic,
+    parameter  type          axi_r_t      = logic,
+    parameter  type          axi_req_t    = logic,
+    parameter  type          axi_resp_t   = logic,
+    // Dependant parameters. DO NOT CHANGE!
+    localparam int  unsigned AxiBeatBytes = AxiDataWidth / 8,
+    localparam int  unsigned LineBytes    = LineBeats * AxiBeatBytes,
+    localparam int  unsigned NumLines     = NumBytes / LineBytes,
+    localparam int  unsigned NumSets      = NumLines / NumWays
+  ) (
+    input  logic      clk_i,
+    input  logic      rst_ni,
+    // Towards the interconnect
+    input  axi_req_t  slv_req_i,
+    output axi_resp_t slv_resp_o,
+    // Towards the memory
+    output axi_req_t  mst_req_o,
+    input  axi_resp_t mst_resp_i,
+    // Performance counters
+    output logic      hit_o,
+    output logic      miss_o
+  );
+
+  import cf_math_pkg::idx_width;
+
+  `include "common_cells/registers.svh"
+
+  ////////////////
+  //  Typedefs  //
+  ////////////////
+
+  localparam int unsigned NumWords   = NumLines * LineBeats;
+  localparam int unsigned OffsetBits = $clog2(LineBytes);
+
+  // The tags hold the whole line address, whatever the number of sets
+  typedef logic [AxiAddrWidth-OffsetBits-1:0] line_addr_t;
+  typedef logic [idx_width(NumSets)-1:0] set_idx_t;
+  typedef logic [idx_width(NumWays)-1:0] way_idx_t;
+  typedef logic [idx_width(LineBeats)-1:0] beat_idx_t;
+  typedef logic [idx_width(NumWords)-1:0] word_idx_t;
+  typedef logic [idx_width(MaxReads)-1:0] read_pnt_t;
+  typedef logic [idx_width(MaxFills)-1:0] fill_pnt_t;
+
+  function automatic line_addr_t line_addr(logic [AxiAddrWidth-1:0] addr);
+    return addr[AxiAddrWidth-1:OffsetBits];
+  endfunction : line_addr
+
+  function automatic set_idx_t set_idx(line_addr_t line);
+    return set_idx_t'(line % NumSets);
+  endfunction : set_idx
+
+  function automatic beat_idx_t beat_idx(logic [AxiAddrWidth-1:0] addr);
+    return beat_idx_t'((addr >> $clog2(AxiBeatBytes)) % LineBeats);
+  endfunction : beat_idx
+
+  // Index of a beat of a line in the data SRAM
+  function automatic word_idx_t word_idx(set_idx_t set, way_idx_t way, beat_idx_t beat);
+    return word_idx_t'((set * NumWays + way) * LineBeats + beat);
+  endfunction : word_idx
+
+  // Last line touched by an incrementing burst
+  function automatic line_addr_t last_line_addr(logic [AxiAddrWidth-1:0] addr, len_t len,
+      size_t size);
+    return line_addr(addr + (AxiAddrWidth'(len) << size));
+  endfunction : last_line_addr
+
+  ////////////
+  //  Tags  //
+  ////////////
+
+  // A way is valid if its line can be hit, and filling while its line is fetched
+  line_addr_t [NumSets-1:0][NumWays-1:0] tag_d, tag_q;
+  logic       [NumSets-1:0][NumWays-1:0] valid_d, valid_q;
+  logic       [NumSets-1:0][NumWays-1:0] filling_d, filling_q;
+  // Next way to be replaced in each set, round-robin
+  way_idx_t   [NumSets-1:0]              victim_d, victim_q;
+
+  `FF(tag_q, tag_d, '0);
+  `FF(valid_q, valid_d, '0);
+  `FF(filling_q, filling_d, '0);
+  `FF(victim_q, victim_d, '0);
+
+  typedef struct packed {
+    logic     hit;
+    logic     present;
+    way_idx_t way;
+  } lookup_t;
+
+  // The line is present if it is valid or being fetched
+  function automatic lookup_t lookup(line_addr_t line,
+      line_addr_t [NumSets-1:0][NumWays-1:0] tag, logic [NumSets-1:0][NumWays-1:0] valid,
+      logic [NumSets-1:0][NumWays-1:0] filling);
+    lookup = '0;
+    for (int unsigned w = 0; w < NumWays; w++)
+      if ((valid[set_idx(line)][w] || filling[set_idx(line)][w]) &&
+          tag[set_idx(line)][w] == line) begin
+        lookup.hit     = valid[set_idx(line)][w];
+        lookup.present = 1'b1;
+        lookup.way     = w;
+      end
+  endfunction : lookup
+
+  // Way where a line of the set is fetched: the first invalid way of the set, or the next
+  // one in round-robin order. The ways being filled cannot be replaced.
+  function automatic lookup_t allocate(set_idx_t set, logic [NumSets-1:0][NumWays-1:0] valid,
+      logic [NumSets-1:0][NumWays-1:0] filling, way_idx_t [NumSets-1:0] victim);
+    allocate = '0;
+    for (int w = NumWays - 1; w >= 0; w--) begin
+      automatic way_idx_t way = way_idx_t'((victim[set] + w) % NumWays);
+      if (!filling[set][way]) begin
+        allocate.present = 1'b1;
+        allocate.way     = way;
+      end
+    end
+    for (int w = NumWays - 1; w >= 0; w--)
+      if (!valid[set][w] && !filling[set][w]) begin
+        allocate.present = 1'b1;
+        allocate.way     = w;
+      end
+  endfunction : allocate
+
+  ////////////
+  //  Data  //
+  ////////////
+
+  logic                      sram_req;
+  logic                      sram_we;
+  word_idx_t                 sram_addr;
+  logic [AxiDataWidth-1:0]   sram_wdata;
+  logic [AxiBeatBytes-1:0]   sram_be;
+  logic [AxiDataWidth-1:0]   sram_rdata;
+
+  tc_sram #(
+    .NumWords (NumWords    ),
+    .NumPorts (1           ),
+    .DataWidth(AxiDataWidth)
+  ) i_data_sram (
+    .clk_i  (clk_i     ),
+    .rst_ni (rst_ni    ),
+    .req_i  (sram_req  ),
+    .we_i   (sram_we   ),
+    .addr_i (sram_addr ),
+    .wdata_i(sram_wdata),
+    .be_i   (sram_be   ),
+    .rdata_o(sram_rdata)
+  );
+
+  ///////////////////
+  //  Read buffer  //
+  ///////////////////
+
+  // The R beats read from the SRAM are buffered, so that the SRAM can be read
+  // back-to-back regardless of the R channel backpressure
+  localparam int unsigned RBufDepth = 4;
+
+  axi_r_t                          r_buf_data, r_buf_out;
+  logic                            r_buf_push, r_buf_pop, r_buf_full, r_buf_empty;
+  logic [idx_width(RBufDepth)-1:0] r_buf_usage;
+
+  // A beat was answered in the previous cycle, from the SRAM or with an error.
+  // Its data is read from the SRAM.
+  logic   rd_issue, rd_pending_q;
+  axi_r_t rd_beat_d, rd_beat_q;
+
+  assign r_buf_push = rd_pending_q;
+  assign r_buf_pop  = !r_buf_empty && slv_req_i.r_ready;
+
+  fifo_v3 #(
+    .DEPTH(RBufDepth),
+    .dtype(axi_r_t  )
+  ) i_r_buf (
+    .clk_i     (clk_i      ),
+    .rst_ni    (rst_ni     ),
+    .testmode_i(1'b0       ),
+    .flush_i   (1'b0       ),
+    .data_i    (r_buf_data ),
+    .push_i    (r_buf_push ),
+    .full_o    (r_buf_full ),
+    .data_o    (r_buf_out  ),
+    .pop_i     (r_buf_pop  ),
+    .empty_o   (r_buf_empty),
+    .usage_o   (r_buf_usage)
+  );
+
+  `FF(rd_pending_q, rd_issue, 1'b0);
+  `FF(rd_beat_q, rd_beat_d, '0);
+
+  // R beat read from the SRAM, or the error of its line
+  always_comb begin: p_r_buf_data
+    r_buf_data      = rd_beat_q;
+    r_buf_data.data = rd_beat_q.resp == RESP_OKAY ? sram_rdata : '0;
+  end: p_r_buf_data
+
+  //////////////////
+  //  Write path  //
+  //////////////////
+
+  // Write bursts forwarded to the memory, until their B response. Their W beats
+  // follow the write bursts in the queue.
+  logic [idx_width(MaxWrites):0] wr_inflight_d, wr_inflight_q;
+  axi_aw_t                       wr_aw;
+  logic                          wr_aw_empty, wr_aw_pop;
+  logic [7:0]                    wr_beat_cnt_d, wr_beat_cnt_q;
+  logic                          aw_handshake;
+
+  fifo_v3 #(
+    .DEPTH(MaxWrites),
+    .dtype(axi_aw_t )
+  ) i_aw_queue (
+    .clk_i     (clk_i        ),
+    .rst_ni    (rst_ni       ),
+    .testmode_i(1'b0         ),
+    .flush_i   (1'b0         ),
+    .data_i    (slv_req_i.aw ),
+    .push_i    (aw_handshake ),
+    .full_o    (/* Unused */ ),
+    .data_o    (wr_aw        ),
+    .pop_i     (wr_aw_pop    ),
+    .empty_o   (wr_aw_empty  ),
+    .usage_o   (/* Unused */ )
+  );
+
+  `FF(wr_inflight_q, wr_inflight_d, '0);
+  `FF(wr_beat_cnt_q, wr_beat_cnt_d, '0);
+
+  /////////////////
+  //  Read path  //
+  /////////////////
+
+  // Read bursts accepted, answered in order
+  axi_ar_t   [MaxReads-1:0]         rd_ar_d, rd_ar_q;
+  read_pnt_t                        rd_head_d, rd_head_q, rd_tail_d, rd_tail_q;
+  logic      [idx_width(MaxReads):0] rd_cnt_d, rd_cnt_q;
+  // Beats of the oldest read burst answered so far
+  logic      [7:0]                  rd_beat_cnt_d, rd_beat_cnt_q;
+
+  // Last line looked up by the oldest read burst, to count each line only once
+  line_addr_t last_line_d, last_line_q;
+  logic       last_line_valid_d, last_line_valid_q;
+
+  // Lookahead, on the read burst la_pnt. It looks up la_line, or the first line of
+  // the burst if la_first is set.
+  read_pnt_t  la_pnt_d, la_pnt_q;
+  line_addr_t la_line_d, la_line_q;
+  logic       la_first_d, la_first_q;
+
+  `FF(rd_ar_q, rd_ar_d, '0);
+  `FF(rd_head_q, rd_head_d, '0);
+  `FF(rd_tail_q, rd_tail_d, '0);
+  `FF(rd_cnt_q, rd_cnt_d, '0);
+  `FF(rd_beat_cnt_q, rd_beat_cnt_d, '0);
+  `FF(last_line_q, last_line_d, '0);
+  `FF(last_line_valid_q, last_line_valid_d, 1'b0);
+  `FF(la_pnt_q, la_pnt_d, '0);
+  `FF(la_line_q, la_line_d, '0);
+  `FF(la_first_q, la_first_d, 1'b1);
+
+  //////////////////
+  //  Line fills  //
+  //////////////////
+
+  // Lines being fetched, in the order of their AR. A fill is stale if a write
+  // burst to its line was accepted meanwhile.
+  line_addr_t [MaxFills-1:0]         fill_line_d, fill_line_q;
+  way_idx_t   [MaxFills-1:0]         fill_way_d, fill_way_q;
+  logic       [MaxFills-1:0]         fill_stale_d, fill_stale_q;
+  logic       [MaxFills-1:0]         fill_err_d, fill_err_q;
+  fill_pnt_t                         fill_head_d, fill_head_q, fill_tail_d, fill_tail_q;
+  logic       [idx_width(MaxFills):0] fill_cnt_d, fill_cnt_q;
+  // Fills whose AR was not sent yet
+  logic       [idx_width(MaxFills):0] fill_ar_cnt_d, fill_ar_cnt_q;
+  beat_idx_t                         fill_beat_d, fill_beat_q;
+
+  // Last line whose fill failed, with the response of the memory
+  line_addr_t     err_line_d, err_line_q;
+  logic           err_valid_d, err_valid_q;
+  axi_pkg::resp_t err_resp_d, err_resp_q;
+
+  `FF(fill_line_q, fill_line_d, '0);
+  `FF(fill_way_q, fill_way_d, '0);
+  `FF(fill_stale_q, fill_stale_d, '0);
+  `FF(fill_err_q, fill_err_d, '0);
+  `FF(fill_head_q, fill_head_d, '0);
+  `FF(fill_tail_q, fill_tail_d, '0);
+  `FF(fill_cnt_q, fill_cnt_d, '0);
+  `FF(fill_ar_cnt_q, fill_ar_cnt_d, '0);
+  `FF(fill_beat_q, fill_beat_d, '0);
+  `FF(err_line_q, err_line_d, '0);
+  `FF(err_valid_q, err_valid_d, 1'b0);
+  `FF(err_resp_q, err_resp_d, RESP_OKAY);
+
+  //////////////////
+  //  Controller  //
+  //////////////////
+
+  always_comb begin: p_llc
+    automatic axi_ar_t                 rd_ar, la_ar;
+    automatic logic [AxiAddrWidth-1:0] beat_addr_rd, beat_addr_wr;
+    automatic line_addr_t              line_rd, la_line, aw_first, aw_last;
+    automatic lookup_t                 lookup_rd, lookup_wr, lookup_la, victim;
+    automatic logic                    rd_valid, err_rd, la_valid, la_last;
+    automatic logic                    fill_write, wr_write;
+    automatic logic                    alloc_req, alloc_ok, la_req;
+    automatic line_addr_t              alloc_line;
+    automatic fill_pnt_t               fill_ar_pnt;
+
+    // Maintain state
+    tag_d             = tag_q;
+    valid_d           = valid_q;
+    filling_d         = filling_q;
+    victim_d          = victim_q;
+    wr_inflight_d     = wr_inflight_q;
+    wr_beat_cnt_d     = wr_beat_cnt_q;
+    rd_ar_d           = rd_ar_q;
+    rd_head_d         = rd_head_q;
+    rd_tail_d         = rd_tail_q;
+    rd_cnt_d          = rd_cnt_q;
+    rd_beat_cnt_d     = rd_beat_cnt_q;
+    rd_beat_d         = rd_beat_q;
+    last_line_d       = last_line_q;
+    last_line_valid_d = last_line_valid_q;
+    la_pnt_d          = la_pnt_q;
+    la_line_d         = la_line_q;
+    la_first_d        = la_first_q;
+    fill_line_d       = fill_line_q;
+    fill_way_d        = fill_way_q;
+    fill_stale_d      = fill_stale_q;
+    fill_err_d        = fill_err_q;
+    fill_head_d       = fill_head_q;
+    fill_tail_d       = fill_tail_q;
+    fill_cnt_d        = fill_cnt_q;
+    fill_ar_cnt_d     = fill_ar_cnt_q;
+    fill_beat_d       = fill_beat_q;
+    err_line_d        = err_line_q;
+    err_valid_d       = err_valid_q;
+    err_resp_d        = err_resp_q;
+
+    // Default assignments
+    slv_resp_o          = '0;
+    slv_resp_o.r        = r_buf_out;
+    slv_resp_o.r_valid  = !r_buf_empty;
+    slv_resp_o.b        = mst_resp_i.b;
+    slv_resp_o.b_valid  = mst_resp_i.b_valid;
+
+    mst_req_o          = '0;
+    mst_req_o.aw       = slv_req_i.aw;
+    mst_req_o.w        = slv_req_i.w;
+    mst_req_o.b_ready  = slv_req_i.b_ready;
+    mst_req_o.r_ready  = 1'b1;
+
+    sram_req   = 1'b0;
+    sram_we    = 1'b0;
+    sram_addr  = '0;
+    sram_wdata = mst_resp_i.r.data;
+    sram_be    = '1;
+
+    rd_issue  = 1'b0;
+    wr_aw_pop = 1'b0;
+    hit_o     = 1'b0;
+    miss_o    = 1'b0;
+
+    ////////////////////////
+    //  Line fills: data  //
+    ////////////////////////
+
+    // The beats of the fills are always accepted, and have the priority on the SRAM
+    fill_write = mst_resp_i.r_valid;
+    if (fill_write) begin
+      automatic line_addr_t line = fill_line_q[fill_head_q];
+      automatic way_idx_t   way  = fill_way_q[fill_head_q];
+      automatic logic       err  = fill_err_q[fill_head_q] || (mst_resp_i.r.resp != RESP_OKAY);
+
+      sram_req    = 1'b1;
+      sram_we     = 1'b1;
+      sram_addr   = word_idx(set_idx(line), way, fill_beat_q);
+      fill_beat_d = fill_beat_q + 1;
+
+      fill_err_d[fill_head_q] = err;
+      if (mst_resp_i.r.resp != RESP_OKAY) err_resp_d = mst_resp_i.r.resp;
+
+      if (mst_resp_i.r.last) begin
+        // Only allocate a line fetched without errors, and not overwritten meanwhile
+        filling_d[set_idx(line)][way] = 1'b0;
+        valid_d[set_idx(line)][way]   = !err && !fill_stale_q[fill_head_q];
+        if (err) begin
+          err_line_d  = line;
+          err_valid_d = 1'b1;
+        end
+
+        fill_beat_d = '0;
+        fill_head_d = fill_head_q + 1;
+        fill_cnt_d -= 1;
+      end
+    end
+
+    //////////////////
+    //  Write path  //
+    //////////////////
+
+    // Forward the write bursts
+    aw_handshake = slv_req_i.aw_valid && mst_resp_i.aw_ready && (wr_inflight_q != MaxWrites);
+    mst_req_o.aw_valid  = slv_req_i.aw_valid && (wr_inflight_q != MaxWrites);
+    slv_resp_o.aw_ready = mst_resp_i.aw_ready && (wr_inflight_q != MaxWrites);
+    if (aw_handshake) begin
+      wr_inflight_d += 1;
+
+      // The fills in flight to the lines of the burst might get stale data
+      aw_first = line_addr(slv_req_i.aw.addr);
+      aw_last  = last_line_addr(slv_req_i.aw.addr, slv_req_i.aw.len, slv_req_i.aw.size);
+      for (int unsigned f = 0; f < MaxFills; f++)
+        if (slv_req_i.aw.burst != BURST_INCR ||
+            (fill_line_q[f] >= aw_first && fill_line_q[f] <= aw_last))
+          fill_stale_d[f] = 1'b1;
+    end
+    if (mst_resp_i.b_valid && slv_req_i.b_ready)
+      wr_inflight_d -= 1;
+
+    // Forward the W beats, and update the lines they hit. They wait if the SRAM is busy.
+    beat_addr_wr = AxiAddrWidth'(beat_addr(wr_aw.addr, wr_aw.size, wr_aw.len, wr_aw.burst,
+      wr_beat_cnt_q));
+    lookup_wr    = lookup(line_addr(beat_addr_wr), tag_q, valid_q, filling_q);
+    wr_write     = lookup_wr.hit && !fill_write;
+
+    mst_req_o.w_valid  = slv_req_i.w_valid && !wr_aw_empty && (!lookup_wr.hit || wr_write);
+    slv_resp_o.w_ready = mst_resp_i.w_ready && !wr_aw_empty && (!lookup_wr.hit || wr_write);
+    if (mst_req_o.w_valid && mst_resp_i.w_ready) begin
+      if (wr_write) begin
+        sram_req   = 1'b1;
+        sram_we    = 1'b1;
+        sram_addr  = word_idx(set_idx(line_addr(beat_addr_wr)), lookup_wr.way,
+          beat_idx(beat_addr_wr));
+        sram_wdata = slv_req_i.w.data;
+        sram_be    = slv_req_i.w.strb;
+      end
+
+      wr_beat_cnt_d = wr_beat_cnt_q + 1;
+      if (slv_req_i.w.last) begin
+        wr_beat_cnt_d = '0;
+        wr_aw_pop     = 1'b1;
+      end
+    end
+
+    /////////////////
+    //  Read path  //
+    /////////////////
+
+    // Accept the read bursts
+    slv_resp_o.ar_ready = rd_cnt_q != MaxReads;
+    if (slv_req_i.ar_valid && slv_resp_o.ar_ready) begin
+      rd_ar_d[rd_tail_q] = slv_req_i.ar;
+      rd_tail_d          = rd_tail_q + 1;
+      rd_cnt_d          += 1;
+    end
+
+    // Answer the oldest read burst
+    rd_ar        = rd_ar_q[rd_head_q];
+    rd_valid     = rd_cnt_q != '0;
+    beat_addr_rd = AxiAddrWidth'(beat_addr(rd_ar.addr, rd_ar.size, rd_ar.len, rd_ar.burst,
+      rd_beat_cnt_q));
+    line_rd      = line_addr(beat_addr_rd);
+    lookup_rd    = lookup(line_rd, tag_q, valid_q, filling_q);
+    err_rd       = !lookup_rd.hit && err_valid_q && err_line_q == line_rd;
+    alloc_req    = 1'b0;
+    alloc_line   = line_rd;
+
+    if (rd_valid) begin
+      // Count the lines once
+      if (!last_line_valid_q || last_line_q != line_rd) begin
+        hit_o             = lookup_rd.hit;
+        miss_o            = !lookup_rd.hit;
+        last_line_d       = line_rd;
+        last_line_valid_d = 1'b1;
+      end
+
+      if ((lookup_rd.hit && !sram_req) || err_rd) begin
+        // Answer the beat if the buffer has room for it
+        if (!r_buf_full && (r_buf_usage + rd_pending_q < RBufDepth)) begin
+          if (lookup_rd.hit) begin
+            // Read the beat from the SRAM, it will be buffered in the next cycle
+            sram_req  = 1'b1;
+            sram_addr = word_idx(set_idx(line_rd), lookup_rd.way, beat_idx(beat_addr_rd));
+          end
+          rd_issue       = 1'b1;
+          rd_beat_d      = '0;
+          rd_beat_d.id   = rd_ar.id;
+          rd_beat_d.resp = lookup_rd.hit ? RESP_OKAY : err_resp_q;
+          rd_beat_d.last = rd_beat_cnt_q == rd_ar.len;
+          rd_beat_d.user = rd_ar.user;
+
+          rd_beat_cnt_d = rd_beat_cnt_q + 1;
+          if (rd_beat_cnt_q == rd_ar.len) begin
+            rd_beat_cnt_d     = '0;
+            rd_head_d         = rd_head_q + 1;
+            rd_cnt_d         -= 1;
+            last_line_valid_d = 1'b0;
+            // The error was answered
+            if (err_rd) err_valid_d = 1'b0;
+          end
+        end
+      end else if (!lookup_rd.present && !err_rd) begin
+        // Fetch the missing line
+        alloc_req = 1'b1;
+      end
+    end
+
+    // Look ahead for the missing lines of the read bursts, if the oldest one does not miss
+    la_ar    = rd_ar_q[la_pnt_q];
+    la_valid = read_pnt_t'(la_pnt_q - rd_head_q) < rd_cnt_q;
+    la_line  = la_first_q ? line_addr(la_ar.addr) : la_line_q;
+    // Only the lines of incrementing bursts are looked up
+    la_last  = la_ar.burst != BURST_INCR || la_line == last_line_addr(la_ar.addr, la_ar.len,
+      la_ar.size);
+    lookup_la = lookup(la_line, tag_q, valid_q, filling_q);
+    la_req    = la_valid && !alloc_req && !lookup_la.present;
+    if (la_req) begin
+      alloc_req  = 1'b1;
+      alloc_line = la_line;
+    end
+
+    ///////////////////////////
+    //  Line fills: request  //
+    ///////////////////////////
+
+    // No line is fetched while a write burst is in flight, since it might
+    // get stale data
+    victim   = allocate(set_idx(alloc_line), valid_q, filling_q, victim_q);
+    alloc_ok = alloc_req && fill_cnt_q != MaxFills && wr_inflight_q == '0 && !aw_handshake &&
+      victim.present;
+    if (alloc_ok) begin
+      // Try again a line that failed
+      if (alloc_line == err_line_q) err_valid_d = 1'b0;
+
+      tag_d[set_idx(alloc_line)][victim.way]     = alloc_line;
+      valid_d[set_idx(alloc_line)][victim.way]   = 1'b0;
+      filling_d[set_idx(alloc_line)][victim.way] = 1'b1;
+      victim_d[set_idx(alloc_line)] = (NumWays == 1) ? '0 : way_idx_t'((victim.way + 1) % NumWays);
+
+      fill_line_d[fill_tail_q]  = alloc_line;
+      fill_way_d[fill_tail_q]   = victim.way;
+      fill_stale_d[fill_tail_q] = 1'b0;
+      fill_err_d[fill_tail_q]   = 1'b0;
+      fill_tail_d               = fill_tail_q + 1;
+      fill_cnt_d               += 1;
+      fill_ar_cnt_d            += 1;
+    end
+
+    // The lookahead moves to the next line, or waits for the fill to be allocated
+    if (la_valid && (lookup_la.present || (la_req && alloc_ok))) begin
+      la_line_d  = la_line + 1;
+      la_first_d = la_last;
+      if (la_last) la_pnt_d = la_pnt_q + 1;
+    end
+    // The oldest read burst is over before the lookahead
+    if (rd_head_d != rd_head_q && la_pnt_q == rd_head_q) begin
+      la_pnt_d   = rd_head_d;
+      la_first_d = 1'b1;
+    end
+
+    // Fetch the lines in order
+    fill_ar_pnt        = fill_tail_q - fill_pnt_t'(fill_ar_cnt_q);
+    mst_req_o.ar.addr  = {fill_line_q[fill_ar_pnt], {OffsetBits{1'b0}}};
+    mst_req_o.ar.len   = LineBeats - 1;
+    mst_req_o.ar.size  = $clog2(AxiBeatBytes);
+    mst_req_o.ar.burst = BURST_INCR;
+    mst_req_o.ar_valid = fill_ar_cnt_q != '0;
+    if (mst_req_o.ar_valid && mst_resp_i.ar_ready) fill_ar_cnt_d -= 1;
+  end: p_llc
+
+  //////////////////
+  //  Assertions  //
+  //////////////////
+
+  if (NumSets == 0 || NumSets * NumWays * LineBytes != NumBytes)
+    $error("[llc] The capacity must be a multiple of NumWays lines of %0d bytes.", LineBytes);
+
+  if (2**$clog2(NumSets) != NumSets)
+    $error("[llc] The number of sets must be a power of two.");
+
+  if (LineBytes > 4096)
+    $error("[llc] A line cannot cross a 4 KiB page boundary.");
+
+  if (MaxReads < 2 || 2**$clog2(MaxReads) != MaxReads ||
+      MaxFills < 2 || 2**$clog2(MaxFills) != MaxFills)
+    $error("[llc] The outstanding reads and fills must be powers of two, and at least two.");
+
+endmodule : llc
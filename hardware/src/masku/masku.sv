@@ -45,7 +45,7 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
     input  logic     [NrLanes-1:0]                     masku_result_final_gnt_i,
     output logic     [NrLanes-1:0]                     masku_vrgat_req_valid_o,
     input  logic     [NrLanes-1:0]                     masku_vrgat_req_ready_i,
-    output vrgat_req_t                                 masku_vrgat_req_o,
+    output vrgat_req_t [NrLanes-1:0]                   masku_vrgat_req_o,
     // Interface with the VFUs
     output strb_t    [NrLanes-1:0]                     mask_o,
     output logic     [NrLanes-1:0]                     mask_valid_o,
@@ -152,10 +152,15 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
     .alu_result_compressed_seq_o   (   alu_result_compressed_seq )
   );
 
-  // Local Parameter for mask logical instructions
+  // Local Parameter VRGATHER, VRGATHEREI16, VCOMPRESS
   //
-  // Don't change this parameter!
-  localparam integer unsigned VrgatherParallelism = 1;
+  // How many indices are resolved in parallel. Every index of a group is served by the lane
+  // that holds its source element, so at most NrLanes of them can be fetched at once.
+  localparam integer unsigned VrgatherParallelism = NrLanes;
+  // Check if parameters are within range
+  if (VrgatherParallelism > NrLanes || (VrgatherParallelism & (VrgatherParallelism - 1)) != 0) begin
+    $fatal(1, "Parameter VrgatherParallelism cannot be higher than NrLanes and should be a power of 2.");
+  end
 
   // Local Parameter for mask logical instructions
   //
@@ -395,8 +400,6 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
   in_ready_cnt_t in_ready_cnt_delta_q, in_ready_cnt_q;
   in_ready_cnt_t in_ready_threshold_d, in_ready_threshold_q;
 
-  assign in_ready_cnt_delta_q = 1;
-
   // Counter to trigger the input ready.
   // Ready triggered when all the slices of the VRF word have been consumed.
   delta_counter #(
@@ -420,8 +423,6 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
   in_m_ready_cnt_t in_m_ready_cnt_q, in_m_ready_cnt_delta_q;
   in_ready_cnt_t in_m_ready_threshold_d, in_m_ready_threshold_q;
 
-  assign in_m_ready_cnt_delta_q = 1;
-
   // Counter to trigger the input ready.
   // Ready triggered when all the slices of the VRF word have been consumed.
   delta_counter #(
@@ -445,8 +446,6 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
   out_valid_cnt_t out_valid_cnt_q, out_valid_cnt_delta_q;
   out_valid_cnt_t out_valid_threshold_d, out_valid_threshold_q;
 
-  assign out_valid_cnt_delta_q = 1;
-
   // Counter to trigger the output valid.
   // Valid triggered when all the slices of the VRF word have been consumed.
   delta_counter #(
@@ -495,11 +494,6 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
   // How deep are the VRGATHER/VCOMPRESS address/index FIFOs?
   localparam int unsigned VrgatFifoDepth = 3;
 
-  // Mask bit sequentially selected by the m-operand delta counter
-  // VRGATHER: used as a mask bit by the MASKU ALU (write-back phase of VRGATHER)
-  // VCOMPRESS: used as an index bit to build the next index for address generation (first phase of VCOMPRESS)
-  logic vrgat_m_seq_bit;
-
   // Sequential indicator to track that end of the vcompress issue phase
   logic vcompress_issue_end_d, vcompress_issue_end_q;
 
@@ -510,37 +504,50 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
 
   // Sequential counter for vcompress
   vlen_t vrgat_cnt_d, vrgat_cnt_q;
-  logic vcompress_bit;
+
+  // A group of up to VrgatherParallelism indices, resolved in the same cycle.
+  // The group never crosses a VrgatherParallelism-aligned element boundary, so it always
+  // belongs to a single index word and to a single result word.
+  typedef logic [$clog2(VrgatherParallelism+1)-1:0] vrgat_grp_cnt_t;
+  typedef struct packed {
+    // Source index of each result element
+    max_vlen_t [VrgatherParallelism-1:0] idx;
+    // The index is out of range, and the result element is zero
+    logic [VrgatherParallelism-1:0] oor;
+    // How many result elements the group writes
+    vrgat_grp_cnt_t cnt;
+    // The lanes were asked for the source elements of this group
+    logic has_req;
+    // Last group of the instruction
+    logic last;
+  } vrgat_grp_t;
+
+  // One request per lane. A lane that does not hold any element of the group
+  // is asked for a dummy element, which keeps the lanes' payloads in lockstep.
+  typedef vrgat_req_t [NrLanes-1:0] vrgat_lane_req_t;
 
   // FIFO-related signals
   logic vrgat_req_fifo_empty, vrgat_req_fifo_full, vrgat_req_fifo_push, vrgat_req_fifo_pop;
   logic vrgat_idx_fifo_empty, vrgat_idx_fifo_full, vrgat_idx_fifo_push, vrgat_idx_fifo_pop;
 
-  max_vlen_t vrgat_req_idx_d, vrgat_req_idx_q;
-  vrgat_req_t vrgat_req_d, vrgat_req_q;
+  vrgat_grp_t vrgat_grp_d, vrgat_grp_q;
+  vrgat_lane_req_t vrgat_req_d, vrgat_req_q;
 
-  vew_e vrgat_req_eew_d;
-  logic [4:0] vrgat_req_vs_d;
-  logic vrgat_req_is_last_req_d;
+  // How many source elements the current group consumes
+  vrgat_grp_cnt_t vrgat_grp_len;
 
   // If VRGATHEREI16, vsew == EW16 -> shift-by-1
   logic [1:0] vrgat_eff_vsew;
   assign vrgat_eff_vsew = (pe_req_i.op == VRGATHEREI16) ? 2'b1 : unsigned'(pe_req_i.vtype.vsew);
 
-  assign vrgat_req_eew_d = vinsn_issue.vtype.vsew;
-  assign vrgat_req_vs_d  = vinsn_issue.vs2;
-
-  // Build the address from the index
-  assign vrgat_req_d = {
-    vrgat_req_idx_d / NrLanes,
-    vrgat_req_eew_d,
-    vrgat_req_vs_d,
-    vrgat_req_is_last_req_d
-  };
-
-  // Broadcast the address request to all the lanes
+  // Send to every lane its own request
   assign masku_vrgat_req_o = vrgat_req_q;
 
+  // VRGATHER/VCOMPRESS bump the index, mask, and result counters by a whole group
+  assign in_ready_cnt_delta_q   = vinsn_issue.op inside {[VRGATHER:VCOMPRESS]} ? in_ready_cnt_t'(vrgat_grp_len) : 1;
+  assign in_m_ready_cnt_delta_q = vinsn_issue.op inside {[VRGATHER:VCOMPRESS]} ? in_m_ready_cnt_t'(vrgat_grp_q.cnt) : 1;
+  assign out_valid_cnt_delta_q  = vinsn_issue.op inside {[VRGATHER:VCOMPRESS]} ? out_valid_cnt_t'(vrgat_grp_q.cnt) : 1;
+
   // A mask for the valid to keep up only the unshaked ones and hide the others
   logic [NrLanes-1:0] vrgat_req_valid_mask_d, vrgat_req_valid_mask_q;
 
@@ -567,36 +574,28 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
     if (&(masku_vrgat_req_ready_i | vrgat_req_valid_mask_q) && ~vrgat_req_fifo_empty) vrgat_req_fifo_pop = 1'b1;
   end
 
-  // Overflow after 16-bits
-  logic vrgat_idx_overflow;
-  // Out-of-range (oor) indicators
-  logic vrgat_idx_oor_d, vrgat_idx_oor_q;
-  // Last vcompress index
-  logic vcompress_last_idx_d, vcompress_last_idx_q;
-
-  // Save the indices into the MASKU ALU vrgather/vcompress queue for later use
-  // Also, save if one of the indices is out of range and if this is the last VCOMPRESS index
+  // Save the index groups into the MASKU ALU vrgather/vcompress queue for later use
   fifo_v3 #(
-    .DATA_WIDTH($clog2(RISCV_MAX_VLEN) + 2),
-    .DEPTH     (VrgatFifoDepth            )
+    .dtype(vrgat_grp_t   ),
+    .DEPTH(VrgatFifoDepth)
   ) i_fifo_vrgat_idx (
     .clk_i,
     .rst_ni,
     .flush_i   (1'b0),
     .testmode_i(1'b0),
-    .full_o    (vrgat_idx_fifo_full           ),
-    .empty_o   (vrgat_idx_fifo_empty          ),
-    .usage_o   (/* unused */                  ),
-    .data_i    ({vcompress_last_idx_d, vrgat_idx_oor_d, vrgat_req_idx_d}),
-    .push_i    (vrgat_idx_fifo_push           ),
-    .data_o    ({vcompress_last_idx_q, vrgat_idx_oor_q, vrgat_req_idx_q}),
-    .pop_i     (vrgat_idx_fifo_pop            )
+    .full_o    (vrgat_idx_fifo_full ),
+    .empty_o   (vrgat_idx_fifo_empty),
+    .usage_o   (/* unused */         ),
+    .data_i    (vrgat_grp_d         ),
+    .push_i    (vrgat_idx_fifo_push ),
+    .data_o    (vrgat_grp_q         ),
+    .pop_i     (vrgat_idx_fifo_pop  )
   );
 
-  // Send the address request to the lanes
+  // Send the address requests to the lanes
   fifo_v3 #(
-    .dtype(vrgat_req_t   ),
-    .DEPTH(VrgatFifoDepth)
+    .dtype(vrgat_lane_req_t),
+    .DEPTH(VrgatFifoDepth  )
   ) i_fifo_vrgat_req (
     .clk_i,
     .rst_ni,
@@ -686,8 +685,6 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
 
     vcpop_operand = '0;
 
-    vrgat_m_seq_bit = 1'b0;
-
     // The result mask should be created here since the output is a non-mask vector
     be_viota_seq_d = be_viota_seq_q;
 
@@ -802,56 +799,42 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
         // This operation writes vsew-bit elements with vtype.vsew encoding
         // The vd source can have a different encoding (it gets deshuffled in the masku_operand stage)
         [VRGATHER:VCOMPRESS]: begin
-          // Buffer for the current element
+          // Buffer for the current elements
           logic [NrLanes*DataWidth-1:0] vrgat_res;
-          // Buffer for the current element
-          logic [DataWidth-1:0] vrgat_buf;
 
-          // Extract the correct elements
+          // Every element of the group comes from a different lane, or from the same element:
+          // pick each of them from the payload of its lane (lane crossbar)
           vrgat_res = '1; // Default assignment
-          vrgat_buf = masku_operand_vd_seq[vrgat_req_idx_q[idx_width(NrLanes*ELENB/8)-1:0] * 64 +: 64]; // Default assignment
-          unique case (vinsn_issue.vtype.vsew)
-            EW8: begin
-              vrgat_buf[0 +: 8] = masku_operand_vd_seq[vrgat_req_idx_q[idx_width(NrLanes*ELENB/1)-1:0] * 8 +: 8];
-              vrgat_res[out_valid_cnt_q[idx_width(NrLanes*ELENB/1)-1:0] * 8 +: 8] = vrgat_idx_oor_q ? '0 : vrgat_buf[0 +: 8];
-            end
-            EW16: begin
-              vrgat_buf[0 +: 16] = masku_operand_vd_seq[vrgat_req_idx_q[idx_width(NrLanes*ELENB/2)-1:0] * 16 +: 16];
-              vrgat_res[out_valid_cnt_q[idx_width(NrLanes*ELENB/2)-1:0] * 16 +: 16] = vrgat_idx_oor_q ? '0 : vrgat_buf[0 +: 16];
-            end
-            EW32: begin
-              vrgat_buf[0 +: 32] = masku_operand_vd_seq[vrgat_req_idx_q[idx_width(NrLanes*ELENB/4)-1:0] * 32 +: 32];
-              vrgat_res[out_valid_cnt_q[idx_width(NrLanes*ELENB/4)-1:0] * 32 +: 32] = vrgat_idx_oor_q ? '0 : vrgat_buf[0 +: 32];
-            end
-            default: begin // EW64
-              vrgat_buf[0 +: 64] = masku_operand_vd_seq[vrgat_req_idx_q[idx_width(NrLanes*ELENB/8)-1:0] * 64 +: 64];
-              vrgat_res[out_valid_cnt_q[idx_width(NrLanes*ELENB/8)-1:0] * 64 +: 64] = vrgat_idx_oor_q ? '0 : vrgat_buf[0 +: 64];
-            end
-          endcase
-
-          // BE signal for VRGATHER
-		  unique case (vinsn_issue.vtype.vsew)
-            EW8: begin
-              vrgat_m_seq_bit = masku_operand_m_seq[in_m_ready_cnt_q[idx_width(NrLanes*DataWidth)-1:0]];
-              be_vrgat_seq_d[out_valid_cnt_q[idx_width(NrLanes*DataWidth/8)-1:0] * 1 +: 1] =
-                {1{vinsn_issue.vm}} | {1{vrgat_m_seq_bit}};
-            end
-            EW16: begin
-              vrgat_m_seq_bit = masku_operand_m_seq[in_m_ready_cnt_q[idx_width(NrLanes*DataWidth)-1:0]];
-              be_vrgat_seq_d[out_valid_cnt_q[idx_width(NrLanes*DataWidth/16)-1:0] * 2 +: 2] =
-                {2{vinsn_issue.vm}} | {2{vrgat_m_seq_bit}};
+          for (int unsigned k = 0; k < VrgatherParallelism; k++) begin
+            if (k < vrgat_grp_q.cnt) begin
+              unique case (vinsn_issue.vtype.vsew)
+                EW8: begin
+                  vrgat_res[(out_valid_cnt_q[idx_width(NrLanes*ELENB/1)-1:0] + k) * 8 +: 8] = vrgat_grp_q.oor[k]
+                    ? '0 : masku_operand_vd_seq[vrgat_grp_q.idx[k][idx_width(NrLanes*ELENB/1)-1:0] * 8 +: 8];
+                  be_vrgat_seq_d[(out_valid_cnt_q[idx_width(NrLanes*DataWidth/8)-1:0] + k) * 1 +: 1] =
+                    {1{vinsn_issue.vm}} | {1{masku_operand_m_seq[in_m_ready_cnt_q[idx_width(NrLanes*DataWidth)-1:0] + k]}};
+                end
+                EW16: begin
+                  vrgat_res[(out_valid_cnt_q[idx_width(NrLanes*ELENB/2)-1:0] + k) * 16 +: 16] = vrgat_grp_q.oor[k]
+                    ? '0 : masku_operand_vd_seq[vrgat_grp_q.idx[k][idx_width(NrLanes*ELENB/2)-1:0] * 16 +: 16];
+                  be_vrgat_seq_d[(out_valid_cnt_q[idx_width(NrLanes*DataWidth/16)-1:0] + k) * 2 +: 2] =
+                    {2{vinsn_issue.vm}} | {2{masku_operand_m_seq[in_m_ready_cnt_q[idx_width(NrLanes*DataWidth)-1:0] + k]}};
+                end
+                EW32: begin
+                  vrgat_res[(out_valid_cnt_q[idx_width(NrLanes*ELENB/4)-1:0] + k) * 32 +: 32] = vrgat_grp_q.oor[k]
+                    ? '0 : masku_operand_vd_seq[vrgat_grp_q.idx[k][idx_width(NrLanes*ELENB/4)-1:0] * 32 +: 32];
+                  be_vrgat_seq_d[(out_valid_cnt_q[idx_width(NrLanes*DataWidth/32)-1:0] + k) * 4 +: 4] =
+                    {4{vinsn_issue.vm}} | {4{masku_operand_m_seq[in_m_ready_cnt_q[idx_width(NrLanes*DataWidth)-1:0] + k]}};
+                end
+                default: begin // EW64
+                  vrgat_res[(out_valid_cnt_q[idx_width(NrLanes*ELENB/8)-1:0] + k) * 64 +: 64] = vrgat_grp_q.oor[k]
+                    ? '0 : masku_operand_vd_seq[vrgat_grp_q.idx[k][idx_width(NrLanes*ELENB/8)-1:0] * 64 +: 64];
+                  be_vrgat_seq_d[(out_valid_cnt_q[idx_width(NrLanes*DataWidth/64)-1:0] + k) * 8 +: 8] =
+                    {8{vinsn_issue.vm}} | {8{masku_operand_m_seq[in_m_ready_cnt_q[idx_width(NrLanes*DataWidth)-1:0] + k]}};
+                end
+              endcase
             end
-            EW32: begin
-              vrgat_m_seq_bit = masku_operand_m_seq[in_m_ready_cnt_q[idx_width(NrLanes*DataWidth)-1:0]];
-              be_vrgat_seq_d[out_valid_cnt_q[idx_width(NrLanes*DataWidth/32)-1:0] * 4 +: 4] =
-                {4{vinsn_issue.vm}} | {4{vrgat_m_seq_bit}};
-            end
-            default: begin // EW64
-              vrgat_m_seq_bit = masku_operand_m_seq[in_m_ready_cnt_q[idx_width(NrLanes*DataWidth)-1:0]];
-              be_vrgat_seq_d[out_valid_cnt_q[idx_width(NrLanes*DataWidth/64)-1:0] * 8 +: 8] =
-                {8{vinsn_issue.vm}} | {8{vrgat_m_seq_bit}};
-            end
-          endcase
+          end
 
           alu_result_vm_m = vrgat_res;
         end
@@ -1092,130 +1075,161 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
 
     // VRGATHER, VCOMPRESS require index generation and ad-hoc operand requesters
     // The indices come from the VALU, while the operands will pass through the Vd operand queue (MaskB)
-    // This implementation is simple and unoptimized:
-    // We ask all the lanes in parallel for a precise index, and we will get a balanced payload from them.
-    // Only one element of the payload is important, the rest is discarded.
-    // This can be easily optimized by asking only the correct lane and by handling unbalanced payloads.
+    // Up to VrgatherParallelism indices are resolved per cycle. Each index is sent to the lane that
+    // holds its source element, and we get a balanced payload back from all the lanes.
+    // Two indices that need different elements from the same lane cannot be part of the same group.
 
     vrgat_cnt_d = vrgat_cnt_q;
 
-    vrgat_req_idx_d = '0;
+    vrgat_grp_d   = '0;
+    vrgat_grp_len = '0;
+    vrgat_req_d   = '0;
     vrgat_idx_fifo_push = 1'b0;
     vrgat_req_fifo_push = 1'b0;
 
-    // Track if an index overflow occurred past the 16 sampled bits
-    vrgat_idx_overflow = 1'b0;
-
-    // Track if the index is out of range
-    vrgat_idx_oor_d = 1'b0;
-
-    vcompress_bit = 1'b0;
-
-    vrgat_req_is_last_req_d = 1'b0;
-
-    vcompress_last_idx_d = 1'b0;
-
     vcompress_issue_end_d = vcompress_issue_end_q;
 
     vcompress_cnt_d = vcompress_cnt_q;
 
-    // Control counters in the pre-issue phase
-    if (vinsn_issue_valid) begin
-      unique case (vinsn_issue.op)
-        VCOMPRESS: begin
-          // Select the current enable bit
-          vcompress_bit = masku_operand_alu_seq[vrgat_cnt_q[idx_width(NrLanes*DataWidth)-1:0]];
-          // Select the current index
-          vrgat_req_idx_d = vrgat_cnt_q;
-          if (&masku_operand_alu_valid && ~vrgat_idx_fifo_full && ~vrgat_req_fifo_full) begin
-            // Check vrgat_m_seq_bit: we can use this since VRGATHER and VCOMPRESS are mutually exclusive
-            // and the masku_operand_m is used in different ways
-            if (vcompress_bit) begin
-              // Push this index and address if the fifos are free and if the mask bit is set
-              vrgat_idx_fifo_push = 1'b1;
-              vrgat_req_fifo_push = 1'b1;
-              // Increase the number of elements to write
-              vcompress_cnt_d = vcompress_cnt_q + 1;
+    // Build the next group in the pre-issue phase
+    if (vinsn_issue_valid && vinsn_issue.op inside {[VRGATHER:VCOMPRESS]}) begin
+      // Find the maximum vector length. VLMAX = LMUL * VLEN / SEW.
+      automatic int unsigned vlmax = (VLEN/8) >> vinsn_issue.vtype.vsew;
+      // How many VCOMPRESS results still fit in the current result word?
+      automatic int unsigned vcompress_room = ((NrLanes*DataWidth/8) >> vinsn_issue.vtype.vsew)
+        - (vcompress_cnt_q & (((NrLanes*DataWidth/8) >> vinsn_issue.vtype.vsew) - 1));
+      // Lanes already serving an element of this group
+      automatic logic [NrLanes-1:0] lane_busy = '0;
+      // The group cannot grow anymore
+      automatic logic grp_stop = 1'b0;
+
+      unique case (vinsn_issue.vtype.vlmul)
+        LMUL_1  : vlmax <<= 0;
+        LMUL_2  : vlmax <<= 1;
+        LMUL_4  : vlmax <<= 2;
+        LMUL_8  : vlmax <<= 3;
+        // Fractional LMUL
+        LMUL_1_2: vlmax >>= 1;
+        LMUL_1_4: vlmax >>= 2;
+        LMUL_1_8: vlmax >>= 3;
+        default:;
+      endcase
+
+      for (int unsigned k = 0; k < VrgatherParallelism; k++) begin
+        // Current element
+        automatic vlen_t vrgat_elm = vrgat_cnt_q + k;
+        // Current index
+        automatic max_vlen_t vrgat_idx = '0;
+        // Track if an index overflow occurred past the 16 sampled bits
+        automatic logic vrgat_idx_overflow = 1'b0;
+        // Track if the index is out of range
+        automatic logic vrgat_idx_oor = 1'b0;
+        // Lane that holds the source element
+        automatic int unsigned vrgat_lane;
+
+        // Stay within the aligned window, and within vl
+        if ((vrgat_cnt_q % VrgatherParallelism) + k >= VrgatherParallelism || vrgat_elm >= vinsn_issue.vl)
+          grp_stop = 1'b1;
+
+        if (vinsn_issue.op == VCOMPRESS) begin
+          // The element is selected by its enable bit
+          vrgat_idx = vrgat_elm;
+          vrgat_lane = vrgat_idx % NrLanes;
+          if (!grp_stop && masku_operand_alu_seq[vrgat_elm[idx_width(NrLanes*DataWidth)-1:0]]) begin
+            // Do not write past the current result word
+            if (vrgat_grp_d.cnt == vcompress_room) begin
+              grp_stop = 1'b1;
+            end else begin
+              vrgat_grp_d.idx[vrgat_grp_d.cnt] = vrgat_idx;
+              vrgat_req_d[vrgat_lane].idx      = vrgat_idx / NrLanes;
+              lane_busy[vrgat_lane]            = 1'b1;
+              vrgat_grp_d.cnt += 1;
             end
           end
-        end
-        VRGATHER,
-        VRGATHEREI16: begin
-          // Find the maximum vector length. VLMAX = LMUL * VLEN / SEW.
-          automatic int unsigned vlmax = (VLEN/8) >> vinsn_issue.vtype.vsew;
-          unique case (vinsn_issue.vtype.vlmul)
-            LMUL_1  : vlmax <<= 0;
-            LMUL_2  : vlmax <<= 1;
-            LMUL_4  : vlmax <<= 2;
-            LMUL_8  : vlmax <<= 3;
-            // Fractional LMUL
-            LMUL_1_2: vlmax >>= 1;
-            LMUL_1_4: vlmax >>= 2;
-            LMUL_1_8: vlmax >>= 3;
-            default:;
-          endcase
-
+        end else begin
           // VRGATHER: treat the index as a vtype.vsew-bit number
           if (vinsn_issue.op == VRGATHER) begin
             unique case (vinsn_issue.vtype.vsew)
               EW8: begin
-                vrgat_req_idx_d = {8'b0, masku_operand_alu_seq[vrgat_cnt_q[idx_width(NrLanes*DataWidth/8)-1:0] * 8 +: 8]};
+                vrgat_idx = {8'b0, masku_operand_alu_seq[vrgat_elm[idx_width(NrLanes*DataWidth/8)-1:0] * 8 +: 8]};
               end
               EW16: begin
-                vrgat_req_idx_d = masku_operand_alu_seq[vrgat_cnt_q[idx_width(NrLanes*DataWidth/16)-1:0] * 16 +: 16];
+                vrgat_idx = masku_operand_alu_seq[vrgat_elm[idx_width(NrLanes*DataWidth/16)-1:0] * 16 +: 16];
               end
               EW32: begin
-                vrgat_req_idx_d = masku_operand_alu_seq[vrgat_cnt_q[idx_width(NrLanes*DataWidth/32)-1:0] * 32 +: 16];
-                vrgat_idx_overflow = |masku_operand_alu_seq[vrgat_cnt_q[idx_width(NrLanes*DataWidth/32)-1:0] * 32 + 16 +: 32 - 16];
+                vrgat_idx = masku_operand_alu_seq[vrgat_elm[idx_width(NrLanes*DataWidth/32)-1:0] * 32 +: 16];
+                vrgat_idx_overflow = |masku_operand_alu_seq[vrgat_elm[idx_width(NrLanes*DataWidth/32)-1:0] * 32 + 16 +: 32 - 16];
               end
               default: begin // EW64
-                vrgat_req_idx_d = masku_operand_alu_seq[vrgat_cnt_q[idx_width(NrLanes*DataWidth/64)-1:0] * 64 +: 16];
-                vrgat_idx_overflow = |masku_operand_alu_seq[vrgat_cnt_q[idx_width(NrLanes*DataWidth/64)-1:0] * 64 + 16 +: 64 - 16];
+                vrgat_idx = masku_operand_alu_seq[vrgat_elm[idx_width(NrLanes*DataWidth/64)-1:0] * 64 +: 16];
+                vrgat_idx_overflow = |masku_operand_alu_seq[vrgat_elm[idx_width(NrLanes*DataWidth/64)-1:0] * 64 + 16 +: 64 - 16];
               end
             endcase
           end else begin
             // VRGATHEREI16: treat the index as a 16-bit number
-            vrgat_req_idx_d = masku_operand_alu_seq[vrgat_cnt_q[idx_width(NrLanes*DataWidth/16)-1:0] * 16 +: 16];
+            vrgat_idx = masku_operand_alu_seq[vrgat_elm[idx_width(NrLanes*DataWidth/16)-1:0] * 16 +: 16];
           end
 
           // VRGATHER.v[x|i] splats one scalar into Vd. The scalar is not truncated
           if (vinsn_issue.use_scalar_op) begin
-            vrgat_req_idx_d = vinsn_issue.scalar_op[15:0];
+            vrgat_idx = vinsn_issue.scalar_op[15:0];
             vrgat_idx_overflow = |vinsn_issue.scalar_op[16 +: ELEN - 16];
           end
 
-          vrgat_idx_oor_d = (vrgat_req_idx_d >= vlmax) | vrgat_idx_overflow;
+          vrgat_idx_oor = (vrgat_idx >= vlmax) | vrgat_idx_overflow;
+          vrgat_lane = vrgat_idx % NrLanes;
+
+          // The lane is already fetching another element
+          if (!vrgat_idx_oor && lane_busy[vrgat_lane] && vrgat_req_d[vrgat_lane].idx != vrgat_idx / NrLanes)
+            grp_stop = 1'b1;
 
-          // Proceed if the FIFOs are not full
-          if (&masku_operand_alu_valid && ~vrgat_idx_fifo_full && ~vrgat_req_fifo_full) begin
-            // Push the index no matter what
-            vrgat_idx_fifo_push = 1'b1;
+          if (!grp_stop) begin
+            vrgat_grp_d.idx[k] = vrgat_idx;
+            vrgat_grp_d.oor[k] = vrgat_idx_oor;
             // Request to the lanes only if the index is within range
-            if (!vrgat_idx_oor_d) begin
-              vrgat_req_fifo_push = 1'b1;
+            if (!vrgat_idx_oor) begin
+              vrgat_req_d[vrgat_lane].idx = vrgat_idx / NrLanes;
+              lane_busy[vrgat_lane]       = 1'b1;
             end
+            vrgat_grp_d.cnt += 1;
           end
         end
-        default:;
-      endcase
-    end
 
-    // Handle the counters
-    if (vinsn_issue.op inside {[VRGATHER:VCOMPRESS]} && &masku_operand_alu_valid && (vrgat_idx_fifo_push || (~vrgat_idx_fifo_full && ~vrgat_req_fifo_full && (vinsn_issue.op == VCOMPRESS)))) begin
-      // Count up if we could process the current input chunk
-      vrgat_cnt_d = vrgat_cnt_q + 1;
-      in_ready_cnt_en = 1'b1;
-
-      // We either finished or we need to ask a new idx operand
-      if ((in_ready_cnt_q[idx_width(NrLanes*DataWidth)-1:0] == in_ready_threshold_q) || (vrgat_cnt_q == (vinsn_issue.vl - 1))) begin
-        in_ready_cnt_clr = 1'b1;
-        masku_operand_alu_ready = '1;
-        // Check if we are over
-        if (vrgat_cnt_q == (vinsn_issue.vl - 1)) begin
-          vrgat_cnt_d = '0;
-          vcompress_last_idx_d = (vinsn_issue.op == VCOMPRESS);
+        // Source elements consumed by this group
+        if (!grp_stop) vrgat_grp_len += 1;
+      end
+
+      // Last group of the instruction
+      vrgat_grp_d.last = (vrgat_cnt_q + vrgat_grp_len) == vinsn_issue.vl;
+
+      // Ask the lanes for the source elements. The last request is always sent, to bring the
+      // lanes back to idle, and its payload is dropped if no element was needed.
+      vrgat_grp_d.has_req = |lane_busy || vrgat_grp_d.last;
+      for (int unsigned lane = 0; lane < NrLanes; lane++) begin
+        vrgat_req_d[lane].eew         = vinsn_issue.vtype.vsew;
+        vrgat_req_d[lane].vs          = vinsn_issue.vs2;
+        vrgat_req_d[lane].is_last_req = vrgat_grp_d.last;
+      end
+
+      // Proceed if the FIFOs are not full
+      if (&masku_operand_alu_valid && ~vrgat_idx_fifo_full && ~vrgat_req_fifo_full) begin
+        // VCOMPRESS skips the groups without any enabled element
+        vrgat_idx_fifo_push = (vrgat_grp_d.cnt != '0) || vrgat_grp_d.last;
+        vrgat_req_fifo_push = vrgat_grp_d.has_req;
+        // Increase the number of elements to write
+        if (vinsn_issue.op == VCOMPRESS)
+          vcompress_cnt_d = vcompress_cnt_q + vrgat_grp_d.cnt;
+
+        // Count up if we could process the current input chunk
+        vrgat_cnt_d = vrgat_cnt_q + vrgat_grp_len;
+        in_ready_cnt_en = 1'b1;
+
+        // We either finished or we need to ask a new idx operand
+        if ((in_ready_cnt_q[idx_width(NrLanes*DataWidth)-1:0] + vrgat_grp_len == in_ready_threshold_q + 1) || vrgat_grp_d.last) begin
+          in_ready_cnt_clr = 1'b1;
+          masku_operand_alu_ready = '1;
           // End of the pre-issue phase
-          vrgat_req_is_last_req_d = 1'b1;
+          if (vrgat_grp_d.last) vrgat_cnt_d = '0;
         end
       end
     end
@@ -1264,7 +1278,8 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
       // VID does not require any operand, while VRGATHER/VCOMPRESS's ALU operand is just preprocessed to get the indices.
       // Therefore, VRGATHER/VCOMPRESS's operand are special. Only the vd operand works in the MASKU ALU.
       if (!result_queue_full && (&masku_operand_alu_valid || vinsn_issue.op inside {VID,[VRGATHER:VCOMPRESS]})
-                             && (&masku_operand_vd_valid  || (!vinsn_issue.use_vd_op && !(vinsn_issue.op inside {[VRGATHER:VCOMPRESS]})))
+                             && (&masku_operand_vd_valid  || (!vinsn_issue.use_vd_op && !(vinsn_issue.op inside {[VRGATHER:VCOMPRESS]}))
+                                                          || (vinsn_issue.op inside {[VRGATHER:VCOMPRESS]} && !vrgat_grp_q.has_req))
                              && (&masku_operand_m_valid   || vinsn_issue.vm || vinsn_issue.op inside {[VMADC:VMSBC]})
                              && (!vrgat_idx_fifo_empty    || !(vinsn_issue.op inside {[VRGATHER:VCOMPRESS]}))) begin
 
@@ -1297,9 +1312,16 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
         out_valid_cnt_en  = 1'b1;
 
         // Account for the elements that have been processed
-        issue_cnt_d = issue_cnt_q - delta_elm_q;
-        if (issue_cnt_q < delta_elm_q)
-          issue_cnt_d = '0;
+        // VRGATHER and VCOMPRESS process a whole group of elements
+        if (vinsn_issue.op inside {[VRGATHER:VCOMPRESS]}) begin
+          issue_cnt_d = issue_cnt_q - vrgat_grp_q.cnt;
+          if (issue_cnt_q < vrgat_grp_q.cnt)
+            issue_cnt_d = '0;
+        end else begin
+          issue_cnt_d = issue_cnt_q - delta_elm_q;
+          if (issue_cnt_q < delta_elm_q)
+            issue_cnt_d = '0;
+        end
 
         // Request new input (by completing ready-valid handshake) once all slices have been processed
         // Alu input is accessed in different widths
@@ -1312,7 +1334,9 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
         end
         // Mask is always accessed at bit level
         // VMADC, VMSBC handle masks in the mask queue
-        if ((((in_m_ready_cnt_q == in_m_ready_threshold_q) || (issue_cnt_d == '0)) && !(vinsn_issue.op inside {[VMADC:VMSBC]})) || (!vfirst_empty && (vinsn_issue.op == VFIRST))) begin
+        if ((((in_m_ready_cnt_q == in_m_ready_threshold_q) || (issue_cnt_d == '0)
+            || (vinsn_issue.op inside {[VRGATHER:VCOMPRESS]} && (in_m_ready_cnt_q + vrgat_grp_q.cnt == in_m_ready_threshold_q + 1)))
+            && !(vinsn_issue.op inside {[VMADC:VMSBC]})) || (!vfirst_empty && (vinsn_issue.op == VFIRST))) begin
           in_m_ready_cnt_clr = 1'b1;
           if (!vinsn_issue.vm) begin
             masku_operand_m_ready = '1;
@@ -1320,12 +1344,13 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
         end
 
         // This vcompress has written less than vl elements
-        vcompress_issue_end_d = vcompress_last_idx_q;
+        vcompress_issue_end_d = (vinsn_issue.op == VCOMPRESS) && vrgat_grp_q.last;
         // Write to the result queue if the entry is full or if this is the last output
         // if this is the last output slice of the vector.
         // Also, handshake the vd input, which follows the output.
-        if (vinsn_issue.op inside {[VRGATHER:VCOMPRESS]}) masku_operand_vd_ready = '1;
-        if ((out_valid_cnt_q == out_valid_threshold_q) || (issue_cnt_d == '0) || vcompress_last_idx_q) begin
+        if (vinsn_issue.op inside {[VRGATHER:VCOMPRESS]} && vrgat_grp_q.has_req) masku_operand_vd_ready = '1;
+        if ((out_valid_cnt_q == out_valid_threshold_q) || (issue_cnt_d == '0) || vcompress_issue_end_d
+            || (vinsn_issue.op inside {[VRGATHER:VCOMPRESS]} && (out_valid_cnt_q + vrgat_grp_q.cnt == out_valid_threshold_q + 1))) begin
           out_valid_cnt_clr = 1'b1;
           // Handshake vd input
           if (vinsn_issue.use_vd_op) begin
@@ -0,0 +1,108 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Ara's inter-lane reduction network. It connects the functional units of the
+// lanes point-to-point, and carries the partial results of the unordered
+// reductions between them without going through the slide unit.
+//
+// The inter-lane reduction follows a logarithmic tree. During round r, with
+// r < log2(NrLanes), lane l receives the partial result of lane l-2^r, and the
+// result accumulates in the last lane. During the last round, the result of
+// the last lane is passed to lane 0, which performs the final SIMD reduction.
+// All the lanes take part in every round, so that the network does not need to
+// know which lanes are still active.
+//
+// Each lane has a slot holding the operand it will receive. A transmitted
+// partial result is written directly in the slot of its destination lane, and
+// the slots are delivered as soon as all of them are full. A round costs one
+// cycle of network latency.
+
+module rednet import ara_pkg::*; #(
+    parameter int unsigned NrLanes = 0
+  ) (
+    input  logic                clk_i,
+    input  logic                rst_ni,
+    // Partial results from the lanes
+    input  elen_t [NrLanes-1:0] red_operand_i,
+    input  logic  [NrLanes-1:0] red_operand_valid_i,
+    output logic  [NrLanes-1:0] red_operand_ready_o,
+    // Operands to the lanes
+    output elen_t [NrLanes-1:0] red_result_o,
+    output logic  [NrLanes-1:0] red_result_valid_o,
+    input  logic  [NrLanes-1:0] red_result_ready_i
+  );
+
+  `include "common_cells/registers.svh"
+
+  import cf_math_pkg::idx_width;
+
+  // Number of inter-lane rounds of a reduction
+  localparam int unsigned NrRounds = $clog2(NrLanes) + 1;
+
+  /////////////
+  //  Slots  //
+  /////////////
+
+  // Operand waiting for each lane
+  elen_t [NrLanes-1:0] slot_d, slot_q;
+  logic  [NrLanes-1:0] slot_valid_d, slot_valid_q;
+
+  // All the lanes transmitted, the slots are being delivered
+  logic deliver, deliver_d, deliver_q;
+
+  // Current round, and distance between the transmitting and the receiving lanes
+  logic [idx_width(NrRounds)-1:0] round_d, round_q;
+  logic [idx_width(NrLanes)-1:0]  stride;
+
+  assign stride       = (round_q == NrRounds - 1) ? 1 : 1 << round_q;
+  assign red_result_o = slot_q;
+
+  always_comb begin: p_rednet
+    // Maintain state
+    slot_d       = slot_q;
+    slot_valid_d = slot_valid_q;
+    round_d      = round_q;
+
+    // Deliver the slots once all of them are full
+    deliver = deliver_q || &slot_valid_q;
+
+    // Receive the partial results, and write them in the slot of the destination lane.
+    // The lane index wraps around, so that the last lane sends its result to lane 0.
+    for (int unsigned l = 0; l < NrLanes; l++) begin
+      automatic logic [idx_width(NrLanes)-1:0] dst = l + stride;
+
+      red_operand_ready_o[l] = !deliver && !slot_valid_q[dst];
+      if (red_operand_valid_i[l] && red_operand_ready_o[l]) begin
+        slot_d[dst]       = red_operand_i[l];
+        slot_valid_d[dst] = 1'b1;
+      end
+    end
+
+    // Deliver the operands
+    for (int unsigned l = 0; l < NrLanes; l++) begin
+      red_result_valid_o[l] = deliver && slot_valid_q[l];
+      if (red_result_valid_o[l] && red_result_ready_i[l])
+        slot_valid_d[l] = 1'b0;
+    end
+
+    // All the lanes received their operand. Go to the next round.
+    deliver_d = deliver && |slot_valid_d;
+    if (deliver && !(|slot_valid_d))
+      round_d = (round_q == NrRounds - 1) ? '0 : round_q + 1;
+  end: p_rednet
+
+  `FF(slot_q, slot_d, '0)
+  `FF(slot_valid_q, slot_valid_d, '0)
+  `FF(deliver_q, deliver_d, 1'b0)
+  `FF(round_q, round_d, '0)
+
+  //////////////////
+  //  Assertions  //
+  //////////////////
+
+  if (NrLanes < 2 || (NrLanes & (NrLanes - 1)) != 0)
+    $error("[rednet] The reduction network needs a power-of-two number of lanes, at least two.");
+
+endmodule : rednet
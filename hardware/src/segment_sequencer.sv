@@ -3,9 +3,17 @@
 // SPDX-License-Identifier: SHL-0.51
 //
 // Author: Matteo Perotti <mperotti@iis.ee.ethz.ch>
-// Description: break down segment memory operations into scalar
-// memory operations. This is extremely bad in terms of IPC, but
-// it has low-impact on the physical implementation.
+// Description: break down segment memory operations into non-segment
+// memory operations. Unit-stride segment operations are issued as they are:
+// the VLSU accesses the whole segment array with a single stream of bursts,
+// and the load (store) unit deinterleaves (interleaves) the fields from (into)
+// the AXI beats. The other segment operations access every field with a
+// strided or indexed operation over the whole vector.
+// Segment stores with address translation enabled and fault-only-first
+// segment loads are still broken down into scalar memory operations,
+// since a trap should not leave the segments past vstart updated. Unit-stride
+// segment loads with address translation enabled are accessed field by field,
+// so that an exception can be reported at the faulting segment.
 
 module segment_sequencer import ara_pkg::*; import rvv_pkg::*; #(
     parameter bit  SegSupport = 1'b0,
@@ -20,6 +28,7 @@ module segment_sequencer import ara_pkg::*; import rvv_pkg::*; #(
     input  logic      is_segment_mem_op_i,
     input  logic      illegal_insn_i,
     input  logic      is_vload_i,
+    input  logic      en_ld_st_translation_i,
     output logic      seg_mem_op_end_o,
     input  logic      load_complete_i,
     output logic      load_complete_o,
@@ -47,6 +56,17 @@ module segment_sequencer import ara_pkg::*; import rvv_pkg::*; #(
     logic [$bits(ara_req_i.vstart):0] next_vstart_cnt;
     logic [2:0] nf_d, nf_q;
 
+    // How the segment memory operation is broken down
+    typedef enum logic [1:0] {
+      // One micro operation per field of each segment
+      ELEMENT_OPS,
+      // One micro operation per field
+      FIELD_OPS,
+      // The segment operation itself, (de)interleaved by the VLSU
+      SEGMENT_STREAM
+    } seg_mode_e;
+    seg_mode_e mode_d, mode_q;
+
     typedef enum logic [1:0] {
       IDLE,
       SEGMENT_MICRO_OPS,
@@ -102,6 +122,12 @@ module segment_sequencer import ara_pkg::*; import rvv_pkg::*; #(
     // Next vstart count
     assign next_vstart_cnt = vstart_cnt_q + 1;
 
+    // Each field is a register group of EMUL registers
+    logic [4:0] field_vreg_offset;
+    assign field_vreg_offset = ara_req_i.emul[2]
+                             ? 5'(segment_cnt_q)
+                             : 5'(segment_cnt_q) << ara_req_i.emul[1:0];
+
     always_comb begin
       state_d = state_q;
 
@@ -118,6 +144,7 @@ module segment_sequencer import ara_pkg::*; import rvv_pkg::*; #(
       ara_resp_valid_d = ara_resp_valid_q;
       is_vload_d       = is_vload_q;
       nf_d             = nf_q;
+      mode_d           = mode_q;
 
       seg_mem_op_end_o = 1'b0;
 
@@ -134,25 +161,66 @@ module segment_sequencer import ara_pkg::*; import rvv_pkg::*; #(
           // Be ready to sample the next nf
           nf_d = ara_req_i.nf;
           is_vload_d = is_vload_i;
+          if (ara_req_i.fault_only_first || (!is_vload_i && en_ld_st_translation_i))
+            mode_d = ELEMENT_OPS;
+          else if ((ara_req_i.op == VLE || ara_req_i.op == VSE) && !en_ld_st_translation_i)
+            mode_d = SEGMENT_STREAM;
+          else
+            mode_d = FIELD_OPS;
           // Send a first micro operation upon valid segment mem op
           if (is_segment_mem_op_i && !illegal_insn_i) begin
             // If we are here, the backend is able to accept the request
             // Set-up sequencing
             new_seg_mem_op = 1'b1;
-            // Set up the first micro operation
-            ara_req_o.vl = 1;
-            // Pass to the next field if the previous micro op finished
-            segment_cnt_en = 1'b1;
+            // Set up the first micro operation. The segment stream is issued as it is,
+            // and it is the only one that the VLSU (de)interleaves.
+            if (mode_d != SEGMENT_STREAM)
+              ara_req_o.nf = '0;
+            if (mode_d == FIELD_OPS) begin
+              // First field of all the segments
+              if (ara_req_i.op == VLE || ara_req_i.op == VSE) begin
+                ara_req_o.op = is_vload_i
+                             ? VLSE
+                             : VSSE;
+                ara_req_o.stride = is_vload_i
+                                 ? (ara_req_i.nf + 1) << ara_req_i.vtype.vsew
+                                 : (ara_req_i.nf + 1) << ara_req_i.eew_vs1;
+              end
+            end else if (mode_d == ELEMENT_OPS) begin
+              // First field of the first segment
+              ara_req_o.vl = 1;
+            end
+            // Pass to the next field if the previous micro op finished.
+            // The segment stream counts its only micro operation once it is accepted.
+            segment_cnt_en = (mode_d != SEGMENT_STREAM) || (ara_req_valid_i && ara_req_ready_i);
             // Start sequencing
             state_d    = SEGMENT_MICRO_OPS;
           end
         end
-        SEGMENT_MICRO_OPS: begin
+        SEGMENT_MICRO_OPS: if (mode_q == SEGMENT_STREAM) begin
+          // Issue the segment operation if it was not accepted yet
+          ara_req_valid_o = ara_req_valid_i && (segment_cnt_q == '0);
+          segment_cnt_en  = ara_req_valid_o && ara_req_ready_i;
+
+          // Don't answer CVA6 yet
+          ara_resp_valid_o = 1'b0;
+
+          // Wait for the answer from Ara's backend, and forward it at the end
+          if (ara_resp_valid_i) begin
+            ara_resp_d = ara_resp_i;
+            state_d    = SEGMENT_MICRO_OPS_WAIT_END;
+          end
+        end else begin
+          // Only the segment stream is (de)interleaved by the VLSU
+          ara_req_o.nf = '0;
           // Manipulate the memory micro request in advance
-          ara_req_o.vl        = next_vstart_cnt;
-          ara_req_o.vstart    = vstart_cnt_q;
-          ara_req_o.vs1       = ara_req_i.vs1 + segment_cnt_q;
-          ara_req_o.vd        = ara_req_i.vd  + segment_cnt_q;
+          // In field mode, vl and vstart are the ones of the segment operation
+          if (mode_q == ELEMENT_OPS) begin
+            ara_req_o.vl      = next_vstart_cnt;
+            ara_req_o.vstart  = vstart_cnt_q;
+          end
+          ara_req_o.vs1       = ara_req_i.vs1 + field_vreg_offset;
+          ara_req_o.vd        = ara_req_i.vd  + field_vreg_offset;
 
           ara_req_o.scalar_op = is_vload_q           // todo: relax timing here
                               ? ara_req_i.scalar_op + (segment_cnt_q << ara_req_i.vtype.vsew)
@@ -181,7 +249,7 @@ module segment_sequencer import ara_pkg::*; import rvv_pkg::*; #(
             // If no exception, continue with the micro ops
             end else begin
               // If over - stop in the next cycle
-              if (segment_cnt_clear && (next_vstart_cnt == ara_req_i.vl)) begin
+              if (segment_cnt_clear && (mode_q == FIELD_OPS || (next_vstart_cnt == ara_req_i.vl))) begin
                 // Sample the last answer
                 ara_resp_d       = ara_resp_i;
                 is_vload_d       = is_vload_i;
@@ -216,12 +284,14 @@ module segment_sequencer import ara_pkg::*; import rvv_pkg::*; #(
       if (!rst_ni) begin
         state_q          <= IDLE;
         nf_q             <= '0;
+        mode_q           <= ELEMENT_OPS;
         is_vload_q       <= 1'b0;
         ara_resp_q       <= '0;
         ara_resp_valid_q <= '0;
       end else begin
         state_q          <= state_d;
         nf_q             <= nf_d;
+        mode_q           <= mode_d;
         is_vload_q       <= is_vload_d;
         ara_resp_q       <= ara_resp_d;
       end
@@ -232,10 +302,14 @@ module segment_sequencer import ara_pkg::*; import rvv_pkg::*; #(
     // Pass through if segment support is disabled
     assign load_complete_o  = load_complete_i;
     assign store_complete_o = store_complete_i;
-    assign ara_req_o        = ara_req_i;
     assign ara_req_valid_o  = ara_req_valid_i;
     assign ara_resp_o       = ara_resp_i;
     assign ara_resp_valid_o = ara_resp_valid_i;
+    // No fields to (de)interleave in the VLSU
+    always_comb begin
+      ara_req_o    = ara_req_i;
+      ara_req_o.nf = '0;
+    end
   end
 
 endmodule
@@ -5,7 +5,8 @@
 // Author: Matheus Cavalcante <matheusd@iis.ee.ethz.ch>
 // Description:
 // This is Ara's slide unit. It is responsible for running the vector slide (up/down)
-// instructions, which need access to the whole Vector Register File.
+// instructions, which need access to the whole Vector Register File, and for passing
+// the partial results of the ordered floating-point reductions between the lanes.
 
 module sldu import ara_pkg::*; import rvv_pkg::*; #(
     parameter  int  unsigned NrLanes   = 0,
@@ -38,8 +39,7 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
     output strb_t    [NrLanes-1:0] sldu_result_be_o,
     input  logic     [NrLanes-1:0] sldu_result_gnt_i,
     input  logic     [NrLanes-1:0] sldu_result_final_gnt_i,
-    // Support for reductions
-    output sldu_mux_e              sldu_mux_sel_o,
+    // Support for ordered reductions
     output logic     [NrLanes-1:0] sldu_red_valid_o,
     // Interface with the Mask Unit
     input  strb_t    [NrLanes-1:0] mask_i,
@@ -167,26 +167,7 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
   logic  [NrLanes-1:0] sldu_operand_valid;
   logic  [NrLanes-1:0] sldu_operand_ready;
 
-  // Don't handshake if the operands target the addrgen!
-  // Moreover, when computing NP2 slides, loop over the same data!
-  elen_t [NrLanes-1:0] sldu_operand_d;
-  logic [NrLanes-1:0]  sldu_operand_valid_d;
-  logic [NrLanes-1:0]  sldu_operand_ready_q;
-
-  typedef enum logic {
-    NP2_BUFFER_PNT,
-    NP2_RESULT_PNT
-  } np2_result_queue_pnt_e;
-
-  typedef enum logic {
-    NP2_EXT_SEL,
-    NP2_LOOP_SEL
-  } np2_loop_mux_e;
-  np2_loop_mux_e np2_loop_mux_sel_d, np2_loop_mux_sel_q;
-
-  logic slide_np2_buf_valid_d, slide_np2_buf_valid_q;
-
-  // There are multiple transmitters (TX) (OpQueue, ALU, FPU, SLDU-NP2) and receivers (RX) (SLDU, ADDRGEN).
+  // There are multiple transmitters (TX) (OpQueue, ALU, FPU) and receivers (RX) (SLDU, ADDRGEN).
   // Hypotheses:
   // - When valid is asserted on the RX, data cannot change anymore until the handshake happens.
   // - When valid is received by RX, then DATA is targeting that RX only.
@@ -196,27 +177,15 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
     spill_register #(
       .T(elen_t)
     ) i_sldu_spill_register (
-      .clk_i  (clk_i                      ),
-      .rst_ni (rst_ni                     ),
-      .valid_i(sldu_operand_valid_d[l]    ),
-      .ready_o(sldu_operand_ready_q[l]    ),
-      .data_i (sldu_operand_d[l]          ),
-      .valid_o(sldu_operand_valid[l]      ),
-      .ready_i(sldu_operand_ready[l]      ),
-      .data_o (sldu_operand[l]            )
+      .clk_i  (clk_i                  ),
+      .rst_ni (rst_ni                 ),
+      .valid_i(sldu_operand_valid_i[l]),
+      .ready_o(sldu_operand_ready_o[l]),
+      .data_i (sldu_operand_i[l]      ),
+      .valid_o(sldu_operand_valid[l]  ),
+      .ready_i(sldu_operand_ready[l]  ),
+      .data_o (sldu_operand[l]        )
     );
-
-    assign sldu_operand_d[l] = np2_loop_mux_sel_q == NP2_EXT_SEL
-                             ? sldu_operand_i[l]
-                             : result_queue_q[NP2_BUFFER_PNT][l].wdata;
-
-    assign sldu_operand_valid_d[l] = np2_loop_mux_sel_q == NP2_EXT_SEL
-                                   ? sldu_operand_valid_i[l]
-                                   : slide_np2_buf_valid_q;
-
-    assign sldu_operand_ready_o[l] = np2_loop_mux_sel_q == NP2_EXT_SEL
-                                   ? sldu_operand_ready_q[l]
-                                   : 1'b0;
   end
 
   //////////////////////////
@@ -250,71 +219,13 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
   // Don't upset the masku with a spurious ready
   assign mask_ready_o = mask_ready_q[0] & mask_valid_i[0] & ~vinsn_issue_q.vm & vinsn_issue_valid_q & !(vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu});
 
-  ///////////////////
-  //  NP2 Support  //
-  ///////////////////
-
-  // The SLDU only supports powers of two (p2) strides
-  // Decompose the non-power-of-two (np2) slide in multiple p2 slides
-
-  // We implement the np2 support here and fully process every input packet
-  // singularly to comply with the undisturbed policy. We cannot use the VRF
-  // as intermediate buffer; each VRF write is a commit.
-
-  typedef logic [idx_width(8*NrLanes)-1:0] stride_t;
-
-  stride_t                                  p2_stride_gen_stride_d;
-  logic                                     p2_stride_gen_valid_d;
-  logic                                     p2_stride_gen_update_d;
-  logic [idx_width(idx_width(8*NrLanes)):0] p2_stride_gen_popc_q;
-  stride_t                                  p2_stride_gen_stride_q;
-  logic                                     p2_stride_gen_valid_q;
-
-  p2_stride_gen #(
-    .NrLanes (NrLanes)
-  ) i_p2_stride_gen (
-    .clk_i       (clk_i                 ),
-    .rst_ni      (rst_ni                ),
-    .stride_i    (p2_stride_gen_stride_d),
-    .valid_i     (p2_stride_gen_valid_d ),
-    .update_i    (p2_stride_gen_update_d),
-    .popc_o      (p2_stride_gen_popc_q  ),
-    .stride_p2_o (p2_stride_gen_stride_q),
-    .valid_o     (p2_stride_gen_valid_q )
-  );
-
-  //////////////////
-  //  Reductions  //
-  //////////////////
-
-  // Inter-lane reductions are performed with a logarithmic tree, and the result is
-  // accumulated in the last Lane. Then, in the end, the result is passed to the first
-  // lane for SIMD reduction
-  logic [idx_width(NrLanes)-1:0] red_stride_cnt_d, red_stride_cnt_q;
-  logic [idx_width(NrLanes):0] red_stride_cnt_d_wide;
-
-  logic is_issue_reduction, is_issue_alu_reduction, is_issue_vmfpu_reduction;
-
-  assign is_issue_alu_reduction   = vinsn_issue_valid_q & (vinsn_issue_q.vfu == VFU_Alu);
-  assign is_issue_vmfpu_reduction = vinsn_issue_valid_q & (vinsn_issue_q.vfu == VFU_MFpu);
-  assign is_issue_reduction       = is_issue_alu_reduction | is_issue_vmfpu_reduction;
-
-  always_comb begin
-    sldu_mux_sel_o = NO_RED;
-    if ((is_issue_alu_reduction && !(vinsn_commit_valid && vinsn_commit.vfu != VFU_Alu)) || (vinsn_commit_valid && vinsn_commit.vfu == VFU_Alu)) begin
-      sldu_mux_sel_o = ALU_RED;
-    end else if ((is_issue_vmfpu_reduction && !(vinsn_commit_valid && vinsn_commit.vfu != VFU_MFpu)) || (vinsn_commit_valid && vinsn_commit.vfu == VFU_MFpu)) begin
-      sldu_mux_sel_o = MFPU_RED;
-    end
-  end
-
   /////////////////////
   //  SLDU DataPath  //
   /////////////////////
 
   // Input/output non-flat operands
   elen_t [NrLanes-1:0] sld_op_src;
-  elen_t [NrLanes-1:0] sld_op_dst;
+  elen_t [NrLanes-1:0] sld_op_dst, sld_op_p2_dst;
 
   // Input and output eew for reshuffling
   rvv_pkg::vew_e sld_eew_src;
@@ -323,20 +234,39 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
   // 0: slidedown, 1: slideup
   logic sld_dir;
 
-  // The SLDU slides by powers of two
+  // The optimized datapath slides by powers of two
+  typedef logic [idx_width(8*NrLanes)-1:0] stride_t;
   logic [idx_width(4*NrLanes):0] sld_slamt;
 
   sldu_op_dp #(
-    .NrLanes  (NrLanes    )
+    .NrLanes  (NrLanes      )
   ) i_sldu_op_dp (
-    .op_i     (sld_op_src ),
-    .slamt_i  (sld_slamt  ),
-    .eew_src_i(sld_eew_src),
-    .eew_dst_i(sld_eew_dst),
-    .dir_i    (sld_dir    ),
-    .op_o     (sld_op_dst )
+    .op_i     (sld_op_src   ),
+    .slamt_i  (sld_slamt    ),
+    .eew_src_i(sld_eew_src  ),
+    .eew_dst_i(sld_eew_dst  ),
+    .dir_i    (sld_dir      ),
+    .op_o     (sld_op_p2_dst)
+  );
+
+  // Non-power-of-two slides go through a general rotator, in a single pass
+  elen_t [NrLanes-1:0] sld_op_np2_dst;
+
+  sldu_rot_dp #(
+    .NrLanes  (NrLanes                                       )
+  ) i_sldu_rot_dp (
+    .op_i     (sld_op_src                                    ),
+    .slamt_i  (vinsn_issue_q.stride[idx_width(8*NrLanes)-1:0]),
+    .eew_src_i(sld_eew_src                                   ),
+    .eew_dst_i(sld_eew_dst                                   ),
+    .dir_i    (sld_dir                                       ),
+    .op_o     (sld_op_np2_dst                                )
   );
 
+  assign sld_op_dst = (vinsn_issue_q.is_stride_np2 && vinsn_issue_q.op inside {VSLIDEUP, VSLIDEDOWN})
+                    ? sld_op_np2_dst
+                    : sld_op_p2_dst;
+
   //////////////////
   //  Slide unit  //
   //////////////////
@@ -348,16 +278,12 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
   pe_resp_t pe_resp;
 
   // State of the slide FSM
-  typedef enum logic [3:0] {
+  typedef enum logic [2:0] {
     SLIDE_IDLE,
     SLIDE_RUN,
     SLIDE_RUN_VSLIDE1UP_FIRST_WORD,
     SLIDE_RUN_OSUM,
-    SLIDE_WAIT_OSUM,
-    SLIDE_NP2_SETUP,
-    SLIDE_NP2_RUN,
-    SLIDE_NP2_COMMIT,
-    SLIDE_NP2_WAIT
+    SLIDE_WAIT_OSUM
   } slide_state_e;
   slide_state_e state_d, state_q;
 
@@ -410,30 +336,15 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
     mask_ready_d       = 1'b0;
     sldu_operand_ready = '0;
 
-    red_stride_cnt_d = red_stride_cnt_q;
-
-    p2_stride_gen_stride_d = '0;
-    p2_stride_gen_valid_d  = 1'b0;
-    p2_stride_gen_update_d = 1'b0;
-
-    np2_loop_mux_sel_d    = np2_loop_mux_sel_q;
-    slide_np2_buf_valid_d = slide_np2_buf_valid_q;
-
-    red_stride_cnt_d_wide = {red_stride_cnt_q, red_stride_cnt_q[idx_width(NrLanes)-1]};
-
     // Inform the main sequencer if we are idle
     pe_req_ready_o = !vinsn_queue_full;
 
     // Slide Unit DP
     sld_op_src  = sldu_operand;
-    sld_eew_src = (vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu})
-                ? vinsn_issue_q.vtype.vsew
-                : vinsn_issue_q.eew_vs2;
+    sld_eew_src = vinsn_issue_q.eew_vs2;
     sld_eew_dst = vinsn_issue_q.vtype.vsew;
-    sld_dir     = (vinsn_issue_q.op == VSLIDEUP) || (vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu});
-    sld_slamt   = (vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu})
-                ? red_stride_cnt_q
-                : stride_t'(vinsn_issue_q.stride >> vinsn_issue_q.vtype.vsew);
+    sld_dir     = (vinsn_issue_q.op == VSLIDEUP);
+    sld_slamt   = stride_t'(vinsn_issue_q.stride >> vinsn_issue_q.vtype.vsew);
 
     /////////////////
     //  Slide FSM  //
@@ -442,7 +353,7 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
     unique case (state_q)
       SLIDE_IDLE: begin
         if (vinsn_issue_valid_q) begin
-          state_d   = vinsn_issue_q.is_stride_np2 ? SLIDE_NP2_SETUP : SLIDE_RUN;
+          state_d   = SLIDE_RUN;
           vrf_pnt_d = '0;
 
           unique case (vinsn_issue_q.op)
@@ -498,26 +409,17 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
 
               state_d = SLIDE_RUN_OSUM;
             end
-            // Unordered reductions
-            default: begin
-              // Unordered redsum instructions doesn't need in/out_pnt
-              in_pnt_d  = '0;
-              out_pnt_d = '0;
-
-              // Initialize issue cnt. Pretend to move NrLanes 64-bit elements for (clog2(NrLanes) + 1) times.
-              issue_cnt_d  = (NrLanes * ($clog2(NrLanes) + 1)) << EW64;
-            end
+            default:;
           endcase
         end
       end
 
-      SLIDE_RUN, SLIDE_RUN_VSLIDE1UP_FIRST_WORD, SLIDE_NP2_COMMIT: begin
+      SLIDE_RUN, SLIDE_RUN_VSLIDE1UP_FIRST_WORD: begin
         // Are we ready?
-        // During a reduction (vinsn_issue_q.vfu == VFU_Alu/VFU_MFPU) don't wait for mask bits
         if ((&sldu_operand_valid ||
            (((vinsn_issue_q.stride[$bits(vinsn_issue_q.vl)-1:0] >> vinsn_issue_q.vtype.vsew) >= vinsn_issue_q.vl) &&
            (state_q == SLIDE_RUN_VSLIDE1UP_FIRST_WORD))) &&
-           !result_queue_full && (vinsn_issue_q.vm || vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu} || (|mask_valid_q)))
+           !result_queue_full && (vinsn_issue_q.vm || (|mask_valid_q)))
         begin
 
           // How many bytes are we copying from the operand to the destination, in this cycle?
@@ -527,7 +429,7 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
 
           // Build the sequential byte-output-enable
           for (int unsigned b = 0; b < 8*NrLanes; b++)
-            if ((b >= out_pnt_q && b < output_limit_q) || vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu})
+            if (b >= out_pnt_q && b < output_limit_q)
               out_en_seq[b] = 1'b1;
 
           // Shuffle the output enable
@@ -535,7 +437,7 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
             out_en_flat[shuffle_index(b, NrLanes, vinsn_issue_q.vtype.vsew)] = out_en_seq[b];
 
           // Mask the output enable with the mask vector
-          out_en = out_en_flat & ({8*NrLanes{vinsn_issue_q.vm | (vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu})}} | mask_q);
+          out_en = out_en_flat & ({8*NrLanes{vinsn_issue_q.vm}} | mask_q);
 
           // Write in the correct bytes
           for (int lane = 0; lane < NrLanes; lane++)
@@ -552,14 +454,12 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
               vaddr(vinsn_issue_q.vd, NrLanes, VLEN) + vrf_pnt_q;
           end
 
-          // Bump pointers (reductions always finish in one shot)
-          in_pnt_d    = vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu} ? NrLanes * 8                  : in_pnt_q  + byte_count;
-          out_pnt_d   = vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu} ? NrLanes * 8                  : out_pnt_q + byte_count;
-          issue_cnt_d = vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu} ? issue_cnt_q - (NrLanes * 8)  : issue_cnt_q - byte_count;
+          // Bump pointers
+          in_pnt_d    = in_pnt_q  + byte_count;
+          out_pnt_d   = out_pnt_q + byte_count;
+          issue_cnt_d = issue_cnt_q - byte_count;
 
-          // In Jump to SLIDE_RUN if stride is P2
-          if (state_q != SLIDE_NP2_COMMIT)
-            state_d = SLIDE_RUN;
+          state_d = SLIDE_RUN;
 
           // If this is a vslide1up instruction, copy the scalar operand to the first word
           if (state_q == SLIDE_RUN_VSLIDE1UP_FIRST_WORD)
@@ -595,24 +495,12 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
             // Reset the pointer and ask for a new operand
             in_pnt_d           = '0;
             sldu_operand_ready = '1;
-            // Left-rotate the logarithmic counter. Hacky way to write it, but it's to
-            // deal with the 2-lanes design without complaints from Verilator...
-            // wide signal to please the tool
-            red_stride_cnt_d_wide = {red_stride_cnt_q, red_stride_cnt_q[idx_width(NrLanes)-1]};
-            red_stride_cnt_d      = red_stride_cnt_d_wide[idx_width(NrLanes)-1:0];
-
-            // Reset the input data mux
-            np2_loop_mux_sel_d = NP2_EXT_SEL;
-            if (state_q == SLIDE_NP2_COMMIT) begin
-              // Jump to NP2 setup again
-              state_d = SLIDE_NP2_SETUP;
-            end
           end
 
           // Filled up a word to the VRF or finished the instruction
           if (out_pnt_d == NrLanes * 8 || issue_cnt_q <= byte_count) begin
             // Reset the pointer
-            out_pnt_d = vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu} ? {'0, red_stride_cnt_d, 3'b0} : '0;
+            out_pnt_d = '0;
             // We used all the bits of the mask
             if (vinsn_issue_q.op inside {VSLIDEUP, VSLIDEDOWN})
               mask_ready_d = !vinsn_issue_q.vm;
@@ -626,16 +514,12 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
             result_queue_write_pnt_d                       = result_queue_write_pnt_q + 1;
             if (result_queue_write_pnt_q == ResultQueueDepth-1)
               result_queue_write_pnt_d = '0;
-
-            if (state_q == SLIDE_NP2_COMMIT) state_d = SLIDE_NP2_WAIT;
           end
 
           // Finished the operation
-          if (issue_cnt_q <= byte_count || (vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu} && issue_cnt_q <= 8 * NrLanes)) begin
+          if (issue_cnt_q <= byte_count) begin
             // Back to idle
             state_d = SLIDE_IDLE;
-            // Reset the logarighmic counter
-            red_stride_cnt_d = 1;
 
             // If this is a vslide1down, fill up the last position with the scalar operand
             if (vinsn_issue_q.op == VSLIDEDOWN && vinsn_issue_q.use_scalar_op) begin
@@ -678,10 +562,6 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
             vinsn_queue_d.issue_cnt -= 1;
           end
         end
-        if (state_q == SLIDE_NP2_COMMIT)
-          if (slide_np2_buf_valid_q && sldu_operand_ready_q[0])
-            // Reset the buffer-valid if the buffer is read, by default
-            slide_np2_buf_valid_d = 1'b0;
       end
       SLIDE_RUN_OSUM: begin
         // Short Note: For ordered sum reduction instruction, only one lane has a valid data, and it is sent to the next lane
@@ -721,53 +601,6 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
         commit_cnt_d = 1'b0;
         state_d      = SLIDE_IDLE;
       end
-      SLIDE_NP2_SETUP: begin
-        // Prepare the write pointer
-        result_queue_write_pnt_d = NP2_BUFFER_PNT;
-        // Prepare the read pointer
-        result_queue_read_pnt_d = NP2_RESULT_PNT;
-        // Setup the mux sel as soon as we get the operands
-        if (&(sldu_operand_valid_i | sldu_operand_valid))
-          np2_loop_mux_sel_d = NP2_LOOP_SEL;
-        // Setup the p2-stride generator
-        p2_stride_gen_stride_d = stride_t'(vinsn_issue_q.stride >> vinsn_issue_q.vtype.vsew);
-        p2_stride_gen_valid_d  = 1'b1;
-        // Start processing the first VRF chunk as soon as the result queue is completely empty
-        // and the VRF chunk is complete
-        if (np2_loop_mux_sel_q == NP2_LOOP_SEL && result_queue_empty) begin
-          state_d = SLIDE_NP2_RUN;
-        end
-      end
-      SLIDE_NP2_RUN: begin
-        // Reset the buffer-valid if the buffer is read, by default
-        if (slide_np2_buf_valid_q && sldu_operand_ready_q[0])
-          slide_np2_buf_valid_d = 1'b0;
-        // Setup the current p2 stride
-        sld_slamt = p2_stride_gen_stride_q;
-        // Slide the operands as soon as valid
-        if (&sldu_operand_valid) begin
-          for (int unsigned l = 0; l < NrLanes; l++)
-            result_queue_d[result_queue_write_pnt_q][l].wdata = sld_op_dst[l];
-          slide_np2_buf_valid_d = 1'b1;
-          // Operands correctly read
-          sldu_operand_ready     = '1;
-          // Update the p2 stride
-          p2_stride_gen_update_d = 1'b1;
-          // Commit the final result
-          if (p2_stride_gen_popc_q == {'0, 1'b1} && result_queue_empty) begin
-            state_d = SLIDE_NP2_COMMIT;
-            // Prepare the write pointer
-            result_queue_write_pnt_d = NP2_RESULT_PNT;
-          end
-        end
-      end
-      SLIDE_NP2_WAIT: begin
-        if (result_queue_empty) begin
-          result_queue_read_pnt_d  = NP2_RESULT_PNT;
-          result_queue_write_pnt_d = NP2_RESULT_PNT;
-          state_d = SLIDE_NP2_COMMIT;
-        end
-      end
       default:;
     endcase
 
@@ -803,12 +636,11 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
       (vinsn_commit.vfu inside {VFU_Alu, VFU_MFpu} || (&result_final_gnt_d || commit_cnt_q > (NrLanes * 8))))
       // There is something waiting to be written
       if (!result_queue_empty) begin
-        if (state_q != SLIDE_NP2_SETUP)
-          // Increment the read pointer
-          if (result_queue_read_pnt_q == ResultQueueDepth-1)
-            result_queue_read_pnt_d = 0;
-          else
-            result_queue_read_pnt_d = result_queue_read_pnt_q + 1;
+        // Increment the read pointer
+        if (result_queue_read_pnt_q == ResultQueueDepth-1)
+          result_queue_read_pnt_d = 0;
+        else
+          result_queue_read_pnt_d = result_queue_read_pnt_q + 1;
 
         // Decrement the counter of results waiting to be written
         result_queue_cnt_d -= 1;
@@ -849,7 +681,7 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
     //////////////////////////////
 
     if (!vinsn_queue_full && pe_req_valid_i && !vinsn_running_q[pe_req_i.id] &&
-      (pe_req_i.vfu == VFU_SlideUnit || pe_req_i.op inside {[VREDSUM:VWREDSUM], [VFREDUSUM:VFWREDOSUM]})) begin
+      (pe_req_i.vfu == VFU_SlideUnit || pe_req_i.op inside {VFREDOSUM, VFWREDOSUM})) begin
       vinsn_queue_d.vinsn[vinsn_queue_q.accept_pnt] = pe_req_i;
       vinsn_running_d[pe_req_i.id]                  = 1'b1;
 
@@ -891,9 +723,6 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
       state_q               <= SLIDE_IDLE;
       pe_resp_o             <= '0;
       result_final_gnt_q    <= '0;
-      red_stride_cnt_q      <= 1;
-      np2_loop_mux_sel_q    <= NP2_EXT_SEL;
-      slide_np2_buf_valid_q <= 1'b0;
     end else begin
       vinsn_running_q       <= vinsn_running_d;
       issue_cnt_q           <= issue_cnt_d;
@@ -905,9 +734,6 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
       state_q               <= state_d;
       pe_resp_o             <= pe_resp;
       result_final_gnt_q    <= result_final_gnt_d;
-      red_stride_cnt_q      <= red_stride_cnt_d;
-      np2_loop_mux_sel_q    <= np2_loop_mux_sel_d;
-      slide_np2_buf_valid_q <= slide_np2_buf_valid_d;
     end
   end
 
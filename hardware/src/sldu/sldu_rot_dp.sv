@@ -0,0 +1,53 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// General slide datapath of the SLDU, for the non-power-of-two strides.
+// The operand is deshuffled, rotated by any number of bytes with a
+// logarithmic barrel rotator, and shuffled back, so that every stride
+// is processed in a single pass. Unlike sldu_op_dp, it can also
+// reshuffle while sliding.
+
+module sldu_rot_dp import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width; #(
+    parameter int unsigned NrLanes = 0,
+    // Dependant parameters. DO NOT CHANGE!
+    localparam int unsigned NrBytes = 8*NrLanes
+  ) (
+    input  elen_t                  [NrLanes-1:0] op_i,
+    // Slide amount, in bytes
+    input  logic        [idx_width(NrBytes)-1:0] slamt_i,
+    input  rvv_pkg::vew_e                        eew_src_i,
+    input  rvv_pkg::vew_e                        eew_dst_i,
+    // 0: slidedown, 1: slideup
+    input  logic                                 dir_i,
+    output elen_t                  [NrLanes-1:0] op_o
+  );
+
+  logic [8*NrBytes-1:0] op_i_flat, op_o_flat;
+  logic [8*NrBytes-1:0] op_seq, op_rot;
+
+  // A slideup by n bytes is a slidedown by NrBytes-n bytes
+  logic [idx_width(NrBytes)-1:0] rotamt;
+
+  assign op_i_flat = op_i;
+  assign op_o      = op_o_flat;
+  assign rotamt    = dir_i ? -slamt_i : slamt_i;
+
+  always_comb begin
+    // Deshuffle the operand
+    for (int unsigned b = 0; b < NrBytes; b++)
+      op_seq[8*b +: 8] = op_i_flat[8*shuffle_index(b, NrLanes, eew_src_i) +: 8];
+
+    // Rotate right by rotamt bytes, i.e., byte b gets byte b + rotamt
+    op_rot = op_seq;
+    for (int unsigned s = 0; s < idx_width(NrBytes); s++)
+      if (rotamt[s])
+        op_rot = (op_rot >> (8 << s)) | (op_rot << (8*NrBytes - (8 << s)));
+
+    // Shuffle the result back
+    for (int unsigned b = 0; b < NrBytes; b++)
+      op_o_flat[8*shuffle_index(b, NrLanes, eew_dst_i) +: 8] = op_rot[8*b +: 8];
+  end
+
+endmodule : sldu_rot_dp
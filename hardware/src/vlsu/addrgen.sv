@@ -5,11 +5,15 @@
 // Author: Matheus Cavalcante <matheusd@iis.ee.ethz.ch>
 // Description:
 // This unit generates transactions on the AR/AW buses, upon receiving vector
-// memory operations.
+// memory operations. The VLSU has two of them, one for the vector loads (AR)
+// and one for the vector stores (AW), so that both channels can be busy at
+// the same time.
 
 module addrgen import ara_pkg::*; import rvv_pkg::*; #(
     parameter int  unsigned NrLanes      = 0,
     parameter int  unsigned VLEN         = 0,
+    // Handle the vector loads (1) or the vector stores (0)
+    parameter bit           IsLoad       = 1'b1,
     // AXI Interface parameters
     parameter int  unsigned AxiDataWidth = 0,
     parameter int  unsigned AxiAddrWidth = 0,
@@ -51,6 +55,8 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
     input  exception_t                     mmu_exception_i,  // address translation threw an exception
     // Interace with the dispatcher
     input  logic                           core_st_pending_i,
+    // The request overlaps with an older memory operation of the other kind
+    input  logic                           mem_hazard_i,
     // Interface with the main sequencer
     input  pe_req_t                        pe_req_i,
     input  logic                           pe_req_valid_i,
@@ -105,6 +111,13 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
     is_addr_error = |(max_sew_byte_t'(addr[LOG2_MAX_SEW_BYTE-1:0]) & (max_sew_byte_t'(1 << vew) - 1));
   endfunction // is_addr_error
 
+  // Bytes of the AXI beat accessed by an element of width vew
+  function automatic logic [AxiDataWidth/8-1:0] elm_strb(axi_addr_t addr, logic [1:0] vew);
+    automatic logic [AxiDataWidth/8-1:0] strb = (1 << (1 << vew)) - 1;
+
+    elm_strb = strb << addr[$clog2(AxiDataWidth/8)-1:0];
+  endfunction // elm_strb
+
   ////////////////////
   //  PE Req Queue  //
   ////////////////////
@@ -119,6 +132,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
     logic is_load;
     logic is_burst; // Unit-strided instructions can be converted into AXI INCR bursts
     logic fault_only_first; // Fault-only-first instruction
+    vlen_t vl;
     vlen_t vstart;
   } addrgen_req_t;
   addrgen_req_t addrgen_req;
@@ -166,17 +180,23 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
   // Support for indexed memory operations (scatter/gather)
   logic [$bits(elen_t)*NrLanes-1:0] shuffled_word;
   logic [$bits(elen_t)*NrLanes-1:0] deshuffled_word;
-  elen_t                            reduced_word;
-  axi_addr_t                        idx_final_vaddr_d, idx_final_vaddr_q;
-  elen_t                            idx_vaddr;
   logic                             idx_op_error_d, idx_op_error_q;
   vlen_t                            addrgen_exception_vstart_d;
 
-  // Pointer to point to the correct
-  logic [$clog2(NrLanes)-1:0] word_lane_ptr_d, word_lane_ptr_q;
-  logic [$clog2(DataWidthB)-1:0] elm_ptr_d, elm_ptr_q;
-  logic [$clog2(DataWidthB)-1:0] last_elm_subw_d, last_elm_subw_q;
-  vlen_t                              idx_op_cnt_d, idx_op_cnt_q;
+  // Indices that fall into the same AXI beat, in increasing order and without overlapping,
+  // are coalesced into a single AXI request. The load/store units only use the bytes
+  // of the beat enabled by the strobe.
+  typedef logic [$clog2(VaddrgenIdxCoalesceWidth):0] idx_cnt_t;
+  typedef struct packed {
+    axi_addr_t                 vaddr; // Address of the first element of the group
+    logic [AxiDataWidth/8-1:0] strb;  // Bytes of the beat accessed by the group
+    idx_cnt_t                  cnt;   // Number of elements in the group
+  } idx_group_t;
+  idx_group_t idx_group_d, idx_group_q;
+
+  // Pointer to the next index in the (deshuffled) NrLanes*64b word
+  logic [$clog2(8*NrLanes):0] idx_elm_ptr_d, idx_elm_ptr_q;
+  vlen_t                      idx_op_cnt_d, idx_op_cnt_q;
 
   // Spill reg signals
   logic      idx_vaddr_valid_d, idx_vaddr_valid_q;
@@ -188,17 +208,17 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
 
   // Break the path from the VRF to the AXI request
   spill_register_flushable #(
-    .T(axi_addr_t)
+    .T(idx_group_t)
   ) i_addrgen_idx_op_spill_reg (
     .clk_i  (clk_i           ),
     .rst_ni (rst_ni          ),
     .flush_i(lsu_ex_flush_q  ),
     .valid_i(idx_vaddr_valid_d),
     .ready_o(idx_vaddr_ready_q),
-    .data_i (idx_final_vaddr_d),
+    .data_i (idx_group_d      ),
     .valid_o(idx_vaddr_valid_q),
     .ready_i(idx_vaddr_ready_d),
-    .data_o (idx_final_vaddr_q)
+    .data_o (idx_group_q      )
   );
 
   //////////////////////////
@@ -270,12 +290,9 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
     // No valid words for the spill register
     idx_vaddr_valid_d       = 1'b0;
     addrgen_operand_ready_o = 1'b0;
-    reduced_word            = '0;
-    elm_ptr_d               = elm_ptr_q;
+    idx_elm_ptr_d           = idx_elm_ptr_q;
     idx_op_cnt_d            = idx_op_cnt_q;
-    word_lane_ptr_d         = word_lane_ptr_q;
-    idx_final_vaddr_d       = idx_final_vaddr_q;
-    last_elm_subw_d         = last_elm_subw_q;
+    idx_group_d             = idx_group_q;
 
     // Support for indexed operations
     shuffled_word = addrgen_operand_i;
@@ -285,17 +302,11 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
       deshuffled_word[8*b +: 8] = shuffled_word[8*b_shuffled +: 8];
     end
 
-    // Extract only 1/NrLanes of the word
-    for (int unsigned lane = 0; lane < NrLanes; lane++)
-      if (lane == word_lane_ptr_q)
-        reduced_word = deshuffled_word[word_lane_ptr_q*$bits(elen_t) +: $bits(elen_t)];
-    idx_vaddr = reduced_word;
-
     case (state_q)
       IDLE: begin
         // Received a new request
-        if (pe_req_valid_i &&
-            (is_load(pe_req_i.op) || is_store(pe_req_i.op)) && !vinsn_running_q[pe_req_i.id]) begin
+        if (pe_req_valid_i && (IsLoad ? is_load(pe_req_i.op) : is_store(pe_req_i.op)) &&
+            !vinsn_running_q[pe_req_i.id] && !mem_hazard_i) begin
           // Mark the instruction as running in this unit
           vinsn_running_d[pe_req_i.id] = 1'b1;
 
@@ -304,36 +315,23 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
 
           // Pre-calculate expensive additions / multiplications
           // pe_req_i shouldn't be that critical at this point
-          lookahead_addr_e_d  = pe_req_i.scalar_op + (pe_req_i.vstart << unsigned'(pe_req_i.vtype.vsew));
+          // Unit-stride segment operations access the nf + 1 fields of each segment
+          lookahead_addr_e_d  = pe_req_i.scalar_op +
+                                ((pe_req_i.vstart * (pe_req_i.nf + 1)) << unsigned'(pe_req_i.vtype.vsew));
           lookahead_addr_se_d = pe_req_i.scalar_op + (pe_req_i.vstart * pe_req_i.stride);
-          lookahead_len_d     = (pe_req_i.vl - pe_req_i.vstart) << unsigned'(pe_req_i.vtype.vsew[1:0]);
+          lookahead_len_d     = ((pe_req_i.vl - pe_req_i.vstart) * (pe_req_i.nf + 1))
+                                << unsigned'(pe_req_i.vtype.vsew[1:0]);
 
           case (pe_req_i.op)
             VLXE, VSXE: begin
               state_d = ADDRGEN_IDX_OP;
 
-              // Load element pointers
+              // Load the element pointer
               case (pe_req_i.eew_vs2)
-                EW8: begin
-                  last_elm_subw_d = 7;
-                  word_lane_ptr_d = pe_req_i.vstart[Log2VRFWordWidthB-1:Log2LaneWordWidthB];
-                  elm_ptr_d       = pe_req_i.vstart[Log2LaneWordWidthB-1:0];
-                end
-                EW16: begin
-                  last_elm_subw_d = 3;
-                  word_lane_ptr_d = pe_req_i.vstart[Log2VRFWordWidthH-1:Log2LaneWordWidthH];
-                  elm_ptr_d       = pe_req_i.vstart[Log2LaneWordWidthH-1:0];
-                end
-                EW32: begin
-                  last_elm_subw_d = 1;
-                  word_lane_ptr_d = pe_req_i.vstart[Log2VRFWordWidthS-1:Log2LaneWordWidthS];
-                  elm_ptr_d       = pe_req_i.vstart[Log2LaneWordWidthS-1:0];
-                end
-                default: begin // EW64
-                  last_elm_subw_d = 0;
-                  word_lane_ptr_d = pe_req_i.vstart[Log2VRFWordWidthD-1:0];
-                  elm_ptr_d       = 0;
-                end
+                EW8    : idx_elm_ptr_d = pe_req_i.vstart[Log2VRFWordWidthB-1:0];
+                EW16   : idx_elm_ptr_d = pe_req_i.vstart[Log2VRFWordWidthH-1:0];
+                EW32   : idx_elm_ptr_d = pe_req_i.vstart[Log2VRFWordWidthS-1:0];
+                default: idx_elm_ptr_d = pe_req_i.vstart[Log2VRFWordWidthD-1:0]; // EW64
               endcase
 
               // Load element counter
@@ -368,6 +366,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
           // Unit-strided loads/stores trigger incremental AXI bursts.
           is_burst: (pe_req_q.op inside {VLE, VSE}),
           fault_only_first: pe_req_q.fault_only_first,
+          vl      : pe_req_q.vl,
           vstart  : pe_req_q.vstart
         };
 
@@ -417,6 +416,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
           // Unit-strided loads/stores trigger incremental AXI bursts.
           is_burst: 1'b0,
           fault_only_first: 1'b0,
+          vl      : pe_req_q.vl,
           vstart  : pe_req_q.vstart
         };
         addrgen_req_valid = 1'b1;
@@ -438,58 +438,73 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
         // We accept all the incoming data, without any checks
         // since Ara stalls on an indexed memory operation
         if (&addrgen_operand_valid) begin
+          // Number of indices in the NrLanes*64b word
+          automatic logic [$clog2(8*NrLanes):0] idx_word_elms = (8*NrLanes) >> pe_req_q.eew_vs2;
+          // Number of data elements in a NrLanes*64b word, and position of the next one
+          automatic logic [$clog2(8*NrLanes):0] data_word_elms = (8*NrLanes) >> pe_req_q.vtype.vsew;
+          automatic vlen_t data_elm_ptr = (pe_req_q.vl - idx_op_cnt_q) & (data_word_elms - 1);
+          // A group cannot cross the boundary of the index word, nor the one of the data word
+          // exchanged with the lanes
+          automatic vlen_t idx_avail = idx_op_cnt_q;
+          automatic axi_addr_t [VaddrgenIdxCoalesceWidth-1:0] idx_vaddr;
+          automatic logic coalesce;
+
+          if (idx_avail > idx_word_elms - idx_elm_ptr_q)
+            idx_avail = idx_word_elms - idx_elm_ptr_q;
+          if (idx_avail > data_word_elms - data_elm_ptr)
+            idx_avail = data_word_elms - data_elm_ptr;
 
           // Valid data for the spill register
           idx_vaddr_valid_d = 1'b1;
 
-          // Select the correct element, and zero extend it depending on vsew
-          case (pe_req_q.eew_vs2)
-            EW8: begin
-              for (int unsigned b = 0; b < 8; b++)
-                if (b == elm_ptr_q)
-                  idx_vaddr = reduced_word[b*8 +: 8];
-            end
-            EW16: begin
-              for (int unsigned h = 0; h < 4; h++)
-                if (h == elm_ptr_q)
-                  idx_vaddr = reduced_word[h*16 +: 16];
-            end
-            EW32: begin
-              for (int unsigned w = 0; w < 2; w++)
-                if (w == elm_ptr_q)
-                  idx_vaddr = reduced_word[w*32 +: 32];
-            end
-            EW64: begin
-              for (int unsigned d = 0; d < 1; d++)
-                if (d == elm_ptr_q)
-                  idx_vaddr = reduced_word[d*64 +: 64];
+          // Select the next indices, zero extend them depending on eew_vs2, and compose the addresses
+          for (int unsigned i = 0; i < VaddrgenIdxCoalesceWidth; i++) begin : select_idx
+            automatic int unsigned elm = idx_elm_ptr_q + i;
+            automatic elen_t idx       = '0;
+
+            if (elm < idx_word_elms) begin
+              case (pe_req_q.eew_vs2)
+                EW8    : idx = deshuffled_word[8*elm  +: 8 ];
+                EW16   : idx = deshuffled_word[16*elm +: 16];
+                EW32   : idx = deshuffled_word[32*elm +: 32];
+                default: idx = deshuffled_word[64*elm +: 64];
+              endcase
             end
-            default: begin
-              for (int unsigned b = 0; b < 8; b++)
-                if (b == elm_ptr_q)
-                  idx_vaddr = reduced_word[b*8 +: 8];
+            idx_vaddr[i] = pe_req_q.scalar_op + idx;
+          end : select_idx
+
+          // The first index always opens a new group
+          idx_group_d = '{
+            vaddr: idx_vaddr[0],
+            strb : elm_strb(idx_vaddr[0], pe_req_q.vtype.vsew[1:0]),
+            cnt  : 1
+          };
+          // Coalesce the following indices as long as they hit the same AXI beat with
+          // increasing addresses. Misaligned indices are never coalesced, so that they
+          // still raise their exception.
+          coalesce = !is_addr_error(idx_vaddr[0], pe_req_q.vtype.vsew[1:0]);
+          for (int unsigned i = 1; i < VaddrgenIdxCoalesceWidth; i++) begin : coalesce_idx
+            coalesce &= (i < idx_avail)
+                     && !is_addr_error(idx_vaddr[i], pe_req_q.vtype.vsew[1:0])
+                     && (idx_vaddr[i] > idx_vaddr[i-1])
+                     && (idx_vaddr[i][AxiAddrWidth-1:$clog2(AxiDataWidth/8)] ==
+                         idx_vaddr[0][AxiAddrWidth-1:$clog2(AxiDataWidth/8)]);
+            if (coalesce) begin
+              idx_group_d.strb |= elm_strb(idx_vaddr[i], pe_req_q.vtype.vsew[1:0]);
+              idx_group_d.cnt   = i + 1;
             end
-          endcase
-
-          // Compose the address
-          idx_final_vaddr_d = pe_req_q.scalar_op + idx_vaddr;
+          end : coalesce_idx
 
           // When the data is accepted
           if (idx_vaddr_ready_q) begin
-            // Consumed one element
-            idx_op_cnt_d = idx_op_cnt_q - 1;
+            // Consumed the elements of the group
+            idx_op_cnt_d  = idx_op_cnt_q - idx_group_d.cnt;
+            idx_elm_ptr_d = idx_elm_ptr_q + idx_group_d.cnt;
             // Have we finished a full NrLanes*64b word?
-            if (elm_ptr_q == last_elm_subw_q) begin
-              // Bump lane pointer
-              elm_ptr_d       = '0;
-              word_lane_ptr_d += 1;
-              if (word_lane_ptr_q == NrLanes - 1) begin
-                // Ready for the next full word
-                addrgen_operand_ready_o = 1'b1;
-              end
-            end else begin
-              // Bump element pointer
-              elm_ptr_d += 1;
+            if (idx_elm_ptr_d == idx_word_elms) begin
+              idx_elm_ptr_d           = '0;
+              // Ready for the next full word
+              addrgen_operand_ready_o = 1'b1;
             end
           end
 
@@ -511,8 +526,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
         addrgen_req_valid = '0;
         state_d           = IDLE;
         // Reset pointers
-        elm_ptr_d       = '0;
-        word_lane_ptr_d = '0;
+        idx_elm_ptr_d = '0;
         // Raise an error if necessary
         if (idx_op_error_q) begin
           // In this case, we always get EEW-misaligned exceptions
@@ -534,8 +548,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
           addrgen_req_valid = '0;
           state_d           = IDLE;
           // Reset pointers
-          elm_ptr_d       = '0;
-          word_lane_ptr_d = '0;
+          idx_elm_ptr_d = '0;
           // Propagate the exception from the MMU (if any)
           addrgen_exception_o = mmu_exception_q;
           addrgen_fof_exception_o = addrgen_fof_exception_q;
@@ -555,10 +568,8 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
       state_q                    <= IDLE;
       pe_req_q                   <= '0;
       vinsn_running_q            <= '0;
-      word_lane_ptr_q            <= '0;
-      elm_ptr_q                  <= '0;
+      idx_elm_ptr_q              <= '0;
       idx_op_cnt_q               <= '0;
-      last_elm_subw_q            <= '0;
       idx_op_error_q             <= '0;
       addrgen_exception_vstart_o <= '0;
       mmu_exception_q            <= '0;
@@ -570,10 +581,8 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
       state_q                    <= state_d;
       pe_req_q                   <= pe_req_d;
       vinsn_running_q            <= vinsn_running_d;
-      word_lane_ptr_q            <= word_lane_ptr_d;
-      elm_ptr_q                  <= elm_ptr_d;
+      idx_elm_ptr_q              <= idx_elm_ptr_d;
       idx_op_cnt_q               <= idx_op_cnt_d;
-      last_elm_subw_q            <= last_elm_subw_d;
       idx_op_error_q             <= idx_op_error_d;
       addrgen_exception_vstart_o <= addrgen_exception_vstart_d;
       mmu_exception_q            <= mmu_exception_d;
@@ -584,48 +593,17 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
     end
   end
 
-  /////////////////////////////////////
-  //  Support for misaligned stores  //
-  /////////////////////////////////////
-
   localparam clog2_AxiStrobeWidth = $clog2(AxiDataWidth/8);
 
   // AXI Request Generation signals, declared here for convenience
   addrgen_req_t axi_addrgen_d, axi_addrgen_q;
 
-  // Narrower AXI Data Byte-Width used for misaligned stores
-  logic [clog2_AxiStrobeWidth-1:0]            narrow_axi_data_bwidth;
-  // Helper signal to calculate the narrow_axi_data_bwidth
-  // It carries information about the misalignment of the start address w.r.t. the AxiDataWidth
-  logic [clog2_AxiStrobeWidth-1:0]            axi_addr_misalignment;
-  // Number of trailing 0s of axi_addr_misalignment
-  logic [idx_width(clog2_AxiStrobeWidth)-1:0] zeroes_cnt;
-
-  // Get the misalignment information for this vector memory instruction
-  assign axi_addr_misalignment = axi_addrgen_d.addr[clog2_AxiStrobeWidth-1:0];
-
-  // Calculate the maximum number of Bytes we can send in a store-misaligned beat.
-  // This number must be a power of 2 not to get misaligned wrt the pack of data that the
-  // store unit receives from the lanes
-  lzc #(
-    .WIDTH(clog2_AxiStrobeWidth),
-    .MODE (1'b0                  )
-  ) i_lzc (
-    .in_i   (axi_addr_misalignment),
-    .cnt_o  (zeroes_cnt           ),
-    .empty_o(/* Unconnected */    )
-  );
-
-  // Effective AXI data width for misaligned stores
-  assign narrow_axi_data_bwidth = (AxiDataWidth/8) >> (clog2_AxiStrobeWidth - zeroes_cnt);
-
   //////////////////////////////
   //  AXI Request Generation  //
   //////////////////////////////
 
   enum logic [2:0] {
     AXI_ADDRGEN_IDLE,
-    AXI_ADDRGEN_AXI_DW_STORE_MISALIGNED,    // Misaligned vector store to AxiDataWidth/8, needs special treatement
     AXI_ADDRGEN_WAITING_CORE_STORE_PENDING, // Wait until (core_st_pending_i == 0)
     AXI_ADDRGEN_REQUESTING,                 // Perform AW/AR transactions and push addrgen_req to VSTU/VLDU
     AXI_ADDRGEN_WAIT_TRANSLATION            // Wait for MMU to ack back
@@ -638,11 +616,15 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
   // MSb of the next-next page (page selector for page 2 positions after the current one)
   logic [($bits(aligned_start_addr_d) - 12)-1:0] next_2page_msb_d, next_2page_msb_q;
 
-  logic [clog2_AxiStrobeWidth:0]            eff_axi_dw_d, eff_axi_dw_q;
-  logic [idx_width(clog2_AxiStrobeWidth):0] eff_axi_dw_log_d, eff_axi_dw_log_q;
+  // Load bursts are capped, so that the load unit can buffer the responses of all the
+  // bursts in flight and reorder them
+  function automatic int unsigned max_burst_beats(logic is_load);
+    max_burst_beats = is_load ? VlsuRobBurstBeats : 256;
+  endfunction // max_burst_beats
 
   function automatic void set_end_addr (
       input  logic [($bits(axi_addr_t) - 12)-1:0]       next_2page_msb,
+      input  logic                                      is_load,
       input  vlen_t                                     num_bytes,
       input  axi_addr_t                                 addr,
       input  logic [clog2_AxiStrobeWidth:0]             eff_axi_dw,
@@ -652,7 +634,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
       output axi_addr_t                                 aligned_next_start_addr
   );
 
-    automatic int unsigned max_burst_bytes = 256 << eff_axi_dw_log;
+    automatic int unsigned max_burst_bytes = max_burst_beats(is_load) << eff_axi_dw_log;
 
     // The final address can be found similarly...
     if (num_bytes >= max_burst_bytes) begin
@@ -687,9 +669,6 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
 
     next_2page_msb_d = next_2page_msb_q;
 
-    eff_axi_dw_d     = eff_axi_dw_q;
-    eff_axi_dw_log_d = eff_axi_dw_log_q;
-
     idx_vaddr_ready_d    = 1'b0;
     addrgen_exception_vstart_d  = '0;
 
@@ -745,6 +724,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
         // The final address can be found similarly...
         set_end_addr (
           next_2page_msb_d,
+          axi_addrgen_d.is_load,
           axi_addrgen_d.len,
           axi_addrgen_d.addr,
           AxiDataWidth/8,
@@ -757,47 +737,11 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
         if (addrgen_req_valid) begin
           axi_addrgen_state_d = core_st_pending_i ? AXI_ADDRGEN_WAITING_CORE_STORE_PENDING : AXI_ADDRGEN_REQUESTING;
 
-          // In case of a misaligned store, reduce the effective width of the AXI transaction,
-          // since the store unit does not support misalignments between the AXI bus and the lanes
-          if (axi_addrgen_d.vstart != 0 && !axi_addrgen_d.is_load) begin
-            // vstart > 0 can create problems similar to the ones a misalignment would create.
-            // Limit the effective AXI bus width to the element width to avoid problems.
-            axi_addrgen_state_d = AXI_ADDRGEN_AXI_DW_STORE_MISALIGNED;
-
-            eff_axi_dw_d     = 1 << axi_addrgen_d.vew;
-            eff_axi_dw_log_d = axi_addrgen_d.vew;
-          end else if ((axi_addrgen_d.addr[clog2_AxiStrobeWidth-1:0] != '0) && !axi_addrgen_d.is_load) begin
-            // Calculate the start and the end addresses in the AXI_ADDRGEN_AXI_DW_STORE_MISALIGNED state
-            axi_addrgen_state_d = AXI_ADDRGEN_AXI_DW_STORE_MISALIGNED;
-
-            eff_axi_dw_d     = {1'b0, narrow_axi_data_bwidth};
-            eff_axi_dw_log_d = zeroes_cnt;
-          end else begin
-            eff_axi_dw_d     = AxiDataWidth/8;
-            eff_axi_dw_log_d = clog2_AxiStrobeWidth;
-          end
+          // Misaligned unit-stride accesses use the full AXI width as well. The store unit
+          // realigns the data from the lanes to the AXI beats.
         end
       end : axi_addrgen_state_AXI_ADDRGEN_IDLE
 
-      AXI_ADDRGEN_AXI_DW_STORE_MISALIGNED: begin : axi_addrgen_state_AXI_ADDRGEN_AXI_DW_STORE_MISALIGNED
-        axi_addrgen_state_d = core_st_pending_i ? AXI_ADDRGEN_WAITING_CORE_STORE_PENDING : AXI_ADDRGEN_REQUESTING;
-
-        // The start address is found by aligning the original request address by the width of
-        // the memory interface.
-        aligned_start_addr_d = aligned_addr(axi_addrgen_q.addr, eff_axi_dw_log_q);
-
-        set_end_addr (
-          next_2page_msb_q,
-          axi_addrgen_q.len,
-          axi_addrgen_q.addr,
-          eff_axi_dw_q,
-          eff_axi_dw_log_q,
-          aligned_start_addr_d,
-          aligned_end_addr_d,
-          aligned_next_start_addr_d
-        );
-      end : axi_addrgen_state_AXI_ADDRGEN_AXI_DW_STORE_MISALIGNED
-
       AXI_ADDRGEN_WAITING_CORE_STORE_PENDING: begin : axi_addrgen_state_AXI_ADDRGEN_WAITING_CORE_STORE_PENDING
         if (!core_st_pending_i) begin
           axi_addrgen_state_d = AXI_ADDRGEN_REQUESTING;
@@ -852,12 +796,13 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
               // AXI burst length
               automatic int unsigned burst_length;
 
-              // 1 - AXI bursts are at most 256 beats long.
-              burst_length = 256;
+              // 1 - AXI bursts are at most 256 beats long, load bursts are capped to the
+              //     size of the reorder buffer slots of the load unit.
+              burst_length = max_burst_beats(axi_addrgen_q.is_load);
               // 2 - The AXI burst length cannot be longer than the number of beats required
               //     to access the memory regions between aligned_start_addr and
               //     aligned_end_addr
-              num_beats = ((aligned_end_addr_q[11:0] - aligned_start_addr_q[11:0]) >> eff_axi_dw_log_q) + 1;
+              num_beats = ((aligned_end_addr_q[11:0] - aligned_start_addr_q[11:0]) >> clog2_AxiStrobeWidth) + 1;
               if (burst_length > num_beats) begin
                 burst_length = num_beats;
               end
@@ -867,7 +812,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
                 axi_ar_o = '{
                   addr   : paddr,
                   len    : burst_length - 1,
-                  size   : eff_axi_dw_log_q,
+                  size   : clog2_AxiStrobeWidth,
                   cache  : CACHE_MODIFIABLE,
                   burst  : BURST_INCR,
                   default: '0
@@ -878,9 +823,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
                 axi_aw_o = '{
                   addr   : paddr,
                   len    : burst_length - 1,
-                  // If misaligned store access, reduce the effective AXI width
-                  // This hurts performance
-                  size   : eff_axi_dw_log_q,
+                  size   : clog2_AxiStrobeWidth,
                   cache  : CACHE_MODIFIABLE,
                   burst  : BURST_INCR,
                   default: '0
@@ -891,7 +834,8 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
               axi_addrgen_queue = '{
                 addr         : paddr,
                 len          : burst_length - 1,
-                size         : eff_axi_dw_log_q,
+                size         : clog2_AxiStrobeWidth,
+                strb         : '1,
                 is_load      : axi_addrgen_q.is_load,
                 is_exception : 1'b0
               };
@@ -902,25 +846,66 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
               // the memory interface. In our case, we have it already.
               set_end_addr (
                 next_2page_msb_d,
+                axi_addrgen_q.is_load,
                 axi_addrgen_q.len - num_bytes,
                 aligned_next_start_addr_q,
-                eff_axi_dw_q,
-                eff_axi_dw_log_q,
+                AxiDataWidth/8,
+                clog2_AxiStrobeWidth,
                 aligned_next_start_addr_q,
                 aligned_end_addr_temp,
                 aligned_next_start_addr_temp
               );
             end : unit_stride_data
             else if (state_q != ADDRGEN_IDX_OP) begin : strided_data
+              // Elements left, and elements left in the data word exchanged with the lanes.
+              // pe_req_q might already hold the next instruction, so the position of the next
+              // element (vstart + elements done) only depends on the request being processed.
+              automatic vlen_t strd_avail = axi_addrgen_q.len >> axi_addrgen_q.vew;
+              automatic logic [$clog2(8*NrLanes):0] data_word_elms = (8*NrLanes) >> axi_addrgen_q.vew;
+              automatic vlen_t data_elm_ptr = (axi_addrgen_q.vstart +
+                (axi_addrgen_q.vl - axi_addrgen_q.vstart - strd_avail)) & (data_word_elms - 1);
+              // Addresses of the next elements
+              automatic axi_addr_t [VaddrgenStrideCoalesceWidth:0] strd_vaddr;
+              automatic logic     pack;
+              automatic logic [$clog2(VaddrgenStrideCoalesceWidth):0] strd_cnt;
+              automatic logic [AxiDataWidth/8-1:0] strd_strb;
+              automatic axi_pkg::size_t strd_size;
               /////////////////////
               //  Strided access //
               /////////////////////
+
+              if (strd_avail > data_word_elms - data_elm_ptr)
+                strd_avail = data_word_elms - data_elm_ptr;
+
+              // Pack the following elements as long as they hit the same AXI beat. Only positive,
+              // non-overlapping strides that keep the elements aligned can be packed.
+              strd_vaddr[0] = axi_addrgen_q.addr;
+              strd_cnt      = 1;
+              strd_strb     = elm_strb(axi_addrgen_q.addr, axi_addrgen_q.vew);
+              pack          = !axi_addrgen_q.stride[$bits(elen_t)-1]
+                           && (axi_addrgen_q.stride >= (1 << axi_addrgen_q.vew))
+                           && !is_addr_error(axi_addrgen_q.stride, axi_addrgen_q.vew);
+              for (int unsigned i = 1; i <= VaddrgenStrideCoalesceWidth; i++) begin : pack_strided
+                strd_vaddr[i] = strd_vaddr[i-1] + axi_addrgen_q.stride;
+                if (i < VaddrgenStrideCoalesceWidth) begin
+                  pack &= (i < strd_avail)
+                       && (strd_vaddr[i][AxiAddrWidth-1:$clog2(AxiDataWidth/8)] ==
+                           strd_vaddr[0][AxiAddrWidth-1:$clog2(AxiDataWidth/8)]);
+                  if (pack) begin
+                    strd_strb |= elm_strb(strd_vaddr[i], axi_addrgen_q.vew);
+                    strd_cnt   = i + 1;
+                  end
+                end
+              end : pack_strided
+              // Packed elements access the full AXI beat, single elements only their own bytes
+              strd_size = (strd_cnt == 1) ? axi_addrgen_q.vew : $clog2(AxiDataWidth/8);
+
               // AR Channel
               if (axi_addrgen_q.is_load) begin
                 axi_ar_o = '{
                   addr   : paddr,
                   len    : 0,
-                  size   : axi_addrgen_q.vew,
+                  size   : strd_size,
                   cache  : CACHE_MODIFIABLE,
                   burst  : BURST_INCR,
                   default: '0
@@ -931,7 +916,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
                 axi_aw_o = '{
                   addr   : paddr,
                   len    : 0,
-                  size   : axi_addrgen_q.vew,
+                  size   : strd_size,
                   cache  : CACHE_MODIFIABLE,
                   burst  : BURST_INCR,
                   default: '0
@@ -941,22 +926,26 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
               // Send this request to the load/store units
               axi_addrgen_queue = '{
                 addr         : paddr,
-                size         : axi_addrgen_q.vew,
+                size         : strd_size,
                 len          : 0,
+                strb         : strd_strb,
                 is_load      : axi_addrgen_q.is_load,
                 is_exception : 1'b0
               };
 
               // Account for the requested operands
               // This should never overflow
-              len_temp = axi_addrgen_q.len - (1 << axi_addrgen_q.vew);
+              len_temp = axi_addrgen_q.len - (strd_cnt << axi_addrgen_q.vew);
               // Calculate the addresses for the next iteration, adding the correct stride
-              next_addr_strided_temp = axi_addrgen_q.addr + axi_addrgen_q.stride;
+              next_addr_strided_temp = strd_vaddr[strd_cnt];
             end : strided_data
             else begin : indexed_data
               // NOTE: address translation is not yet been implemented/tested for indexed
 
               automatic logic [CVA6Cfg.PLEN-1:0] idx_final_paddr;
+              // Coalesced groups access the full AXI beat, single elements only their own bytes
+              automatic axi_pkg::size_t idx_size = (idx_group_q.cnt == 1) ? axi_addrgen_q.vew :
+                                                                            $clog2(AxiDataWidth/8);
               //////////////////////
               //  Indexed access  //
               //////////////////////
@@ -966,7 +955,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
                 // Check if the virtual address generates an exception
                 // NOTE: we can do this even before address translation, since the
                 //       page offset (2^12) is the same for both physical and virtual addresses
-                if (is_addr_error(idx_final_vaddr_q, axi_addrgen_q.vew[1:0])) begin : eew_misaligned_error
+                if (is_addr_error(idx_group_q.vaddr, axi_addrgen_q.vew[1:0])) begin : eew_misaligned_error
                   // Generate an error
                   idx_op_error_d          = 1'b1;
                   // Forward next vstart info to the dispatcher
@@ -976,14 +965,14 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
                 end : eew_misaligned_error
                 else begin : aligned_vaddress
                   // Mux target address
-                  idx_final_paddr = (en_ld_st_translation_i) ? mmu_paddr_i : idx_final_vaddr_q;
+                  idx_final_paddr = (en_ld_st_translation_i) ? mmu_paddr_i : idx_group_q.vaddr;
 
                   // AR Channel
                   if (axi_addrgen_q.is_load) begin
                     axi_ar_o = '{
                       addr   : idx_final_paddr,
                       len    : 0,
-                      size   : axi_addrgen_q.vew,
+                      size   : idx_size,
                       cache  : CACHE_MODIFIABLE,
                       burst  : BURST_INCR,
                       default: '0
@@ -994,7 +983,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
                     axi_aw_o = '{
                       addr   : idx_final_paddr,
                       len    : 0,
-                      size   : axi_addrgen_q.vew,
+                      size   : idx_size,
                       cache  : CACHE_MODIFIABLE,
                       burst  : BURST_INCR,
                       default: '0
@@ -1004,15 +993,16 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
                   // Prepare the request for the load or store unit
                   axi_addrgen_queue = '{
                     addr         : idx_final_paddr,
-                    size         : axi_addrgen_q.vew,
+                    size         : idx_size,
                     len          : 0,
+                    strb         : idx_group_q.strb,
                     is_load      : axi_addrgen_q.is_load,
                     is_exception : 1'b0
                   };
 
                   // Account for the requested operands
                   // This should never overflow
-                  len_temp = axi_addrgen_q.len - (1 << axi_addrgen_q.vew);
+                  len_temp = axi_addrgen_q.len - (idx_group_q.cnt << axi_addrgen_q.vew);
                 end : aligned_vaddress
               end : if_idx_vaddr_valid_q
             end : indexed_data
@@ -1021,7 +1011,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
             if (en_ld_st_translation_i && ((state_q != ADDRGEN_IDX_OP) || idx_vaddr_valid_q)) begin : translation_req
               // Request an address translation
               mmu_req_d           = 1'b1;
-              mmu_vaddr_o         = (state_q == ADDRGEN_IDX_OP) ? idx_final_vaddr_q : axi_addrgen_q.addr;
+              mmu_vaddr_o         = (state_q == ADDRGEN_IDX_OP) ? idx_group_q.vaddr : axi_addrgen_q.addr;
               mmu_is_store_o      = !axi_addrgen_q.is_load;
             end : translation_req
             // Either we got a valid address translation from the MMU
@@ -1065,7 +1055,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
                   // Check if the virtual address generates an exception
                   // NOTE: we can do this even before address translation, since the
                   //       page offset (2^12) is the same for both physical and virtual addresses
-                  if (!is_addr_error(idx_final_vaddr_q, axi_addrgen_q.vew[1:0])) begin : aligned_vaddress
+                  if (!is_addr_error(idx_group_q.vaddr, axi_addrgen_q.vew[1:0])) begin : aligned_vaddress
                     // We consumed a word
                     idx_vaddr_ready_d = 1'b1;
 
@@ -1106,6 +1096,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
                 addr         : paddr,
                 size         : axi_addrgen_q.vew,
                 len          : 0,
+                strb         : '1,
                 is_load      : axi_addrgen_q.is_load,
                 is_exception : 1'b1
               };
@@ -1145,8 +1136,6 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
       aligned_next_start_addr_q <= '0;
       addrgen_fof_exception_q   <= '0;
       aligned_end_addr_q        <= '0;
-      eff_axi_dw_q              <= '0;
-      eff_axi_dw_log_q          <= '0;
       next_2page_msb_q          <= '0;
     end else begin
       axi_addrgen_state_q       <= axi_addrgen_state_d;
@@ -1155,8 +1144,6 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
       aligned_next_start_addr_q <= aligned_next_start_addr_d;
       addrgen_fof_exception_q   <= addrgen_fof_exception_d;
       aligned_end_addr_q        <= aligned_end_addr_d;
-      eff_axi_dw_q              <= eff_axi_dw_d;
-      eff_axi_dw_log_q          <= eff_axi_dw_log_d;
       next_2page_msb_q          <= next_2page_msb_d;
     end
   end
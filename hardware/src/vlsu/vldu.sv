@@ -13,6 +13,8 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
     parameter  type          vaddr_t   = logic,  // Type used to address vector register file elements
     parameter  type          pe_req_t  = logic,
     parameter  type          pe_resp_t = logic,
+    // Support for segment memory operations
+    parameter  seg_support_e SegSupport = SegSupportEnable,
     // AXI Interface parameters
     parameter  int  unsigned AxiDataWidth = 0,
     parameter  int  unsigned AxiAddrWidth = 0,
@@ -159,7 +161,8 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
   //  Result queues  //
   /////////////////////
 
-  localparam int unsigned ResultQueueDepth = 2;
+  // A unit-stride segment load fills the VRF words of all its fields at the same time
+  localparam int unsigned ResultQueueDepth = SegSupport ? MaxSegFields : 2;
 
   // There is a result queue per lane, holding the results that were not
   // yet accepted by the corresponding lane.
@@ -177,8 +180,9 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
   // indicate with `payload_t` we are currently writing into (write_pnt),
   // and one pointer to indicate which `payload_t` we are currently
   // reading from and writing into the lanes (read_pnt).
-  logic     [idx_width(ResultQueueDepth)-1:0]   result_queue_write_pnt_d, result_queue_write_pnt_q;
-  logic     [idx_width(ResultQueueDepth)-1:0]   result_queue_read_pnt_d, result_queue_read_pnt_q;
+  typedef logic [idx_width(ResultQueueDepth)-1:0] result_queue_pnt_t;
+  result_queue_pnt_t                            result_queue_write_pnt_d, result_queue_write_pnt_q;
+  result_queue_pnt_t                            result_queue_read_pnt_d, result_queue_read_pnt_q;
   // We need to count how many valid elements (payload_t) are there in this result queue.
   logic     [idx_width(ResultQueueDepth):0]     result_queue_cnt_d, result_queue_cnt_q;
   // Vector to register the final grants from the operand requesters, which indicate
@@ -186,9 +190,17 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
   // that the result was accepted by the operand requester stage
   logic     [NrLanes-1:0]                       result_final_gnt_d, result_final_gnt_q;
 
+  // Unit-stride segment loads deinterleave the fields of the segments into nf + 1 VRF words,
+  // which are filled at the same time in consecutive entries of the result queue
+  logic issue_segment, commit_segment;
+  assign issue_segment  = SegSupport && vinsn_issue_valid && (vinsn_issue_q.nf != '0);
+  assign commit_segment = SegSupport && (vinsn_commit.nf != '0);
+
   // Is the result queue full?
   logic result_queue_full;
-  assign result_queue_full = (result_queue_cnt_q == ResultQueueDepth);
+  assign result_queue_full = issue_segment
+                           ? (result_queue_cnt_q + vinsn_issue_q.nf >= ResultQueueDepth)
+                           : (result_queue_cnt_q == ResultQueueDepth);
   // Is the result queue empty?
   logic result_queue_empty;
   assign result_queue_empty = (result_queue_cnt_q == '0);
@@ -230,7 +242,7 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
   // into the VRF. Namely, we need:
   // - A counter of how many beats are left in the current AXI burst
   axi_pkg::len_t                           axi_len_d, axi_len_q;
-  // - A pointer to which byte in the current R beat we are reading data from.
+  // - A pointer to which valid byte in the current R beat we are reading data from.
   logic [idx_width(AxiDataWidth/8):0]      axi_r_byte_pnt_d, axi_r_byte_pnt_q;
   // - A pointer to which byte in the full VRF word we are writing data into.
   logic [idx_width(DataWidth*NrLanes/8):0] vrf_word_byte_pnt_d, vrf_word_byte_pnt_q;
@@ -257,6 +269,12 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
   // Counter to increase the VRF write address.
   vlen_t seq_word_wr_offset_d, seq_word_wr_offset_q;
 
+  // Unit-stride segment loads:
+  // - The field of the next byte read from the R channel.
+  logic [2:0] seg_field_d, seg_field_q;
+  // - The field of the next VRF word written back.
+  logic [2:0] commit_field_d, commit_field_q;
+
   // Exception handling FSM
   // Needed because of the result queue buffer, which can contain partial
   // results upon exception.
@@ -269,6 +287,29 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
 
   localparam unsigned DataWidthB = DataWidth / 8;
 
+  // Bytes of the current R beat that belong to the vector, and their position in the
+  // sequence of valid bytes. Requests that coalesce several non-contiguous elements only
+  // use some of the bytes of their beat.
+  logic [AxiDataWidth/8-1:0]                              beat_byte_valid;
+  logic [AxiDataWidth/8-1:0][idx_width(AxiDataWidth/8):0] beat_byte_idx;
+  logic [idx_width(AxiDataWidth/8):0]                     beat_valid_bytes;
+
+  always_comb begin: p_beat_bytes
+    // If non-unit strided load, we do not progress within the beat
+    automatic logic [idx_width(AxiDataWidth/8)-1:0] lower_byte = beat_lower_byte(axi_addrgen_req_i.addr,
+      axi_addrgen_req_i.size, axi_addrgen_req_i.len, BURST_INCR, AxiDataWidth/8, axi_len_q);
+    automatic logic [idx_width(AxiDataWidth/8)-1:0] upper_byte = beat_upper_byte(axi_addrgen_req_i.addr,
+      axi_addrgen_req_i.size, axi_addrgen_req_i.len, BURST_INCR, AxiDataWidth/8, axi_len_q);
+
+    beat_valid_bytes = '0;
+    for (int unsigned axi_byte = 0; axi_byte < AxiDataWidth/8; axi_byte++) begin
+      beat_byte_valid[axi_byte] = (axi_byte >= lower_byte) && (axi_byte <= upper_byte) &&
+                                  axi_addrgen_req_i.strb[axi_byte];
+      beat_byte_idx[axi_byte]   = beat_valid_bytes;
+      beat_valid_bytes          = beat_valid_bytes + beat_byte_valid[axi_byte];
+    end
+  end: p_beat_bytes
+
   always_comb begin: p_vldu
     // Maintain state
     vinsn_queue_d = vinsn_queue_q;
@@ -290,6 +331,8 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
     seq_word_wr_offset_d = seq_word_wr_offset_q;
     first_payload_byte_d = first_payload_byte_q;
     vrf_word_byte_cnt_d  = vrf_word_byte_cnt_q;
+    seg_field_d          = seg_field_q;
+    commit_field_d       = commit_field_q;
 
     // Vector instructions currently running
     vinsn_running_d = vinsn_running_q & pe_vinsn_running_i;
@@ -326,13 +369,6 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
     if (axi_r_valid_i && axi_addrgen_req_valid_i
         && axi_addrgen_req_i.is_load && !axi_addrgen_req_i.is_exception
         && !result_queue_full) begin : axi_r_beat_read
-      // Bytes valid in the current R beat
-      // If non-unit strided load, we do not progress within the beat
-      automatic logic [idx_width(AxiDataWidth/8)-1:0] lower_byte = beat_lower_byte(axi_addrgen_req_i.addr,
-        axi_addrgen_req_i.size, axi_addrgen_req_i.len, BURST_INCR, AxiDataWidth/8, axi_len_q);
-      automatic logic [idx_width(AxiDataWidth/8)-1:0] upper_byte = beat_upper_byte(axi_addrgen_req_i.addr,
-        axi_addrgen_req_i.size, axi_addrgen_req_i.len, BURST_INCR, AxiDataWidth/8, axi_len_q);
-
       // Is there a vector instruction ready to be issued?
       // Do we have the operands for it?
       if (vinsn_issue_valid && (vinsn_issue_q.vm || (|mask_valid_q))) begin : operands_valid
@@ -342,7 +378,7 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
         // How many bytes are valid in this instruction
         automatic vlen_t vinsn_valid_bytes = issue_cnt_bytes_q - vrf_word_byte_cnt_q;
         // How many bytes are valid in this AXI word
-        automatic vlen_t axi_valid_bytes   = upper_byte - lower_byte - axi_r_byte_pnt_q + 1;
+        automatic vlen_t axi_valid_bytes   = beat_valid_bytes - axi_r_byte_pnt_q;
 
 
         // How many bytes are we committing?
@@ -358,11 +394,12 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
         // Copy data from the R channel into the result queue
         for (int unsigned axi_byte = 0; axi_byte < AxiDataWidth/8; axi_byte++) begin : axi_r_to_result_queue
           // Is this byte a valid byte in the R beat?
-          if ((axi_byte >= (lower_byte + axi_r_byte_pnt_q)) && (axi_byte <= upper_byte)) begin : is_axi_r_byte
+          if (!issue_segment && beat_byte_valid[axi_byte] &&
+              (beat_byte_idx[axi_byte] >= axi_r_byte_pnt_q)) begin : is_axi_r_byte
             // Map axi_byte to the corresponding byte in the VRF word (sequential)
-            automatic int unsigned vrf_seq_byte = axi_byte - lower_byte - axi_r_byte_pnt_q + vrf_word_byte_pnt_q;
+            automatic int unsigned vrf_seq_byte = beat_byte_idx[axi_byte] - axi_r_byte_pnt_q + vrf_word_byte_pnt_q;
             // Follow the vrf_seq_byte, but without the vstart information
-            automatic int unsigned vrf_seq_byte_cnt = axi_byte - lower_byte - axi_r_byte_pnt_q + vrf_word_byte_cnt_q;
+            automatic int unsigned vrf_seq_byte_cnt = beat_byte_idx[axi_byte] - axi_r_byte_pnt_q + vrf_word_byte_cnt_q;
             // And then shuffle it
             automatic int unsigned vrf_byte = shuffle_index(vrf_seq_byte, NrLanes, vinsn_issue_q.vtype.vsew);
 
@@ -395,6 +432,65 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
           result_queue_d[result_queue_write_pnt_q][lane].addr = vaddr(vinsn_issue_q.vd, NrLanes, VLEN) + (vstart_lane >> (EW64 - vinsn_issue_q.vtype.vsew)) + seq_word_wr_offset_q;
           result_queue_d[result_queue_write_pnt_q][lane].id   = vinsn_issue_q.id;
         end : compute_vrf_addr
+
+        // Unit-stride segment loads: element i of field f goes to element i of the register
+        // group vd + f * EMUL. The VRF words of the fields are filled in the result queue
+        // entries following the write pointer. The VRF word pointers point to the current
+        // element, and go back to its first byte until all its fields are over.
+        if (issue_segment) begin : segment_deinterleave
+          automatic logic [idx_width(DataWidth*NrLanes/8):0] seg_pnt = vrf_word_byte_pnt_q;
+          automatic logic [idx_width(DataWidth*NrLanes/8):0] seg_cnt = vrf_word_byte_cnt_q;
+          automatic logic [2:0] seg_field   = seg_field_q;
+          automatic logic [4:0] field_vregs = vinsn_issue_q.emul[2] ? 5'd1 : 5'd1 << vinsn_issue_q.emul[1:0];
+          automatic vlen_t      vstart_lane = vinsn_issue_q.vstart / NrLanes;
+
+          valid_bytes = '0;
+          for (int unsigned axi_byte = 0; axi_byte < AxiDataWidth/8; axi_byte++) begin : axi_r_to_fields
+            if (beat_byte_valid[axi_byte] && (beat_byte_idx[axi_byte] >= axi_r_byte_pnt_q) &&
+                seg_pnt < (NrLanes * DataWidthB) && seg_cnt < issue_cnt_bytes_q) begin : is_field_byte
+              automatic result_queue_pnt_t entry = result_queue_write_pnt_q + seg_field;
+              automatic int unsigned vrf_byte    = shuffle_index(seg_pnt, NrLanes, vinsn_issue_q.vtype.vsew);
+              automatic int unsigned vrf_offset  = vrf_byte[2:0];
+              automatic int unsigned vrf_lane    = (vrf_byte >> 3);
+
+              // Copy data and byte strobe
+              result_queue_d[entry][vrf_lane].wdata[8*vrf_offset +: 8] = axi_r_i.data[8*axi_byte +: 8];
+              result_queue_d[entry][vrf_lane].be[vrf_offset] =
+                vinsn_issue_q.vm || mask_q[vrf_lane][vrf_offset];
+
+              valid_bytes += 1;
+              seg_pnt     += 1;
+              seg_cnt     += 1;
+              // Last byte of the element of this field
+              if ((seg_pnt & ((1 << vinsn_issue_q.vtype.vsew) - 1)) == '0) begin
+                if (seg_field == vinsn_issue_q.nf) begin
+                  seg_field = '0;
+                end else begin
+                  seg_field += 1;
+                  seg_pnt   -= (1 << vinsn_issue_q.vtype.vsew);
+                  seg_cnt   -= (1 << vinsn_issue_q.vtype.vsew);
+                end
+              end
+            end : is_field_byte
+          end : axi_r_to_fields
+
+          // Bump R beat and VRF word pointers
+          axi_r_byte_pnt_d    = axi_r_byte_pnt_q + valid_bytes;
+          vrf_word_byte_pnt_d = seg_pnt;
+          vrf_word_byte_cnt_d = seg_cnt;
+          seg_field_d         = seg_field;
+
+          for (int unsigned field = 0; field < MaxSegFields; field++) begin : compute_field_vrf_addr
+            automatic result_queue_pnt_t entry = result_queue_write_pnt_q + field;
+            if (field <= vinsn_issue_q.nf) begin
+              for (int unsigned lane = 0; lane < NrLanes; lane++) begin
+                result_queue_d[entry][lane].addr = vaddr(5'(vinsn_issue_q.vd + field * field_vregs), NrLanes, VLEN) +
+                  (vstart_lane >> (EW64 - vinsn_issue_q.vtype.vsew)) + seq_word_wr_offset_q;
+                result_queue_d[entry][lane].id   = vinsn_issue_q.id;
+              end
+            end
+          end : compute_field_vrf_addr
+        end : segment_deinterleave
       end : operands_valid
 
       // We have a word ready to be sent to the lanes
@@ -411,6 +507,15 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
         // Trigger the request signal
         result_queue_valid_d[result_queue_write_pnt_q] = {NrLanes{1'b1}};
 
+        // The VRF words of all the fields of a unit-stride segment load are ready
+        if (issue_segment) begin : segment_words_ready
+          result_queue_cnt_d       += vinsn_issue_q.nf;
+          result_queue_write_pnt_d  = result_queue_write_pnt_q + vinsn_issue_q.nf + 1;
+          for (int unsigned field = 1; field < MaxSegFields; field++)
+            if (field <= vinsn_issue_q.nf)
+              result_queue_valid_d[result_queue_pnt_t'(result_queue_write_pnt_q + field)] = {NrLanes{1'b1}};
+        end : segment_words_ready
+
         // Increase the VRF-write sequential counter
         seq_word_wr_offset_d = seq_word_wr_offset_q + 1;
 
@@ -434,7 +539,7 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
       end : vrf_word_ready
 
       // Consumed all valid bytes in this R beat
-      if ((axi_r_byte_pnt_d == (upper_byte - lower_byte + 1)) || (issue_cnt_bytes_d == '0)) begin : axi_r_beat_finish
+      if ((axi_r_byte_pnt_d == beat_valid_bytes) || (issue_cnt_bytes_d == '0)) begin : axi_r_beat_finish
         // Request another beat
         axi_r_ready_o = 1'b1;
         axi_r_byte_pnt_d   = '0;
@@ -473,6 +578,7 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
           vrf_word_byte_pnt_d  = {1'b0, vrf_word_start_byte[$clog2(8*NrLanes)-1:0]};
           vrf_word_byte_cnt_d  = '0;
           seq_word_wr_offset_d = '0;
+          seg_field_d          = '0;
           // The first payload byte width for this vload
           first_payload_byte_d = (NrLanes * DataWidthB) - vrf_word_start_byte[$clog2(8*NrLanes)-1:0];
         end : issue_cnt_bytes_update
@@ -527,14 +633,21 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
         // Decrement the counter of results waiting to be written
         result_queue_cnt_d -= 1;
 
-        // The next write will surely not be the first one anymore
-        first_result_queue_read_d = 1'b0;
-
-        // Decrement the counter of remaining vector elements waiting to be written
-        commit_cnt_bytes_d = commit_cnt_bytes_q - res_queue_eff_write_bytes;
-        if (commit_cnt_bytes_q < (NrLanes * DataWidthB)) begin : commit_cnt_bytes_overflow
-          commit_cnt_bytes_d = '0;
-        end : commit_cnt_bytes_overflow
+        // The VRF words of the fields of a unit-stride segment load hold the same elements
+        if (commit_segment && (commit_field_q != vinsn_commit.nf)) begin : commit_next_field
+          commit_field_d = commit_field_q + 1;
+        end : commit_next_field else begin : commit_elements
+          commit_field_d = '0;
+
+          // The next write will surely not be the first one anymore
+          first_result_queue_read_d = 1'b0;
+
+          // Decrement the counter of remaining vector elements waiting to be written
+          commit_cnt_bytes_d = commit_cnt_bytes_q - res_queue_eff_write_bytes;
+          if (commit_cnt_bytes_q < (NrLanes * DataWidthB)) begin : commit_cnt_bytes_overflow
+            commit_cnt_bytes_d = '0;
+          end : commit_cnt_bytes_overflow
+        end : commit_elements
       end : result_available
     end : wait_for_write_back
 
@@ -603,6 +716,8 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
         // Reset axi state
         axi_len_d        = '0;
         axi_r_byte_pnt_d = '0;
+        seg_field_d      = '0;
+        commit_field_d   = '0;
 
         // Ack the addrgen for this last faulty request
         axi_addrgen_req_ready_o = axi_addrgen_req_valid_i;
@@ -653,6 +768,7 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
         vrf_word_byte_pnt_d  = {1'b0, vrf_word_start_byte[$clog2(8*NrLanes)-1:0]};
         vrf_word_byte_cnt_d  = '0;
         seq_word_wr_offset_d = '0;
+        seg_field_d          = '0;
         // The first payload byte width for this vload
         first_payload_byte_d = (NrLanes * DataWidthB) - vrf_word_start_byte[$clog2(8*NrLanes)-1:0];
       end
@@ -677,6 +793,8 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
       seq_word_wr_offset_q          <= '0;
       first_payload_byte_q          <= '0;
       vrf_word_byte_cnt_q           <= '0;
+      seg_field_q                   <= '0;
+      commit_field_q                <= '0;
       lsu_ex_flush_q                <= 1'b0;
       ldu_current_burst_exception_o <= 1'b0;
       ldu_ex_state_q                <= IDLE;
@@ -693,6 +811,8 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
       seq_word_wr_offset_q          <= seq_word_wr_offset_d;
       first_payload_byte_q          <= first_payload_byte_d;
       vrf_word_byte_cnt_q           <= vrf_word_byte_cnt_d;
+      seg_field_q                   <= seg_field_d;
+      commit_field_q                <= commit_field_d;
       lsu_ex_flush_q                <= lsu_ex_flush_i;
       ldu_current_burst_exception_o <= ldu_current_burst_exception_d;
       ldu_ex_state_q                <= ldu_ex_state_d;
@@ -0,0 +1,482 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Stride prefetcher of the vector load unit. It learns, for every unit-stride
+// and strided load instruction, the distance between the base addresses of
+// two consecutive executions of the instruction. The instructions are told
+// apart by their destination register, which stands for their PC. Once the
+// same distance is seen twice in a row, the prefetcher fetches the bytes of
+// the next execution of the instruction into a small fully-associative buffer
+// of aligned blocks, BurstBeats full-width beats each. The load bursts whose
+// beats all fall into buffered blocks are answered from the buffer, without
+// reaching the memory.
+//
+// The prefetches use their own AXI ID, PfId, and are sent only when no load
+// burst is waiting for the AR channel. The buffer is kept coherent with the
+// vector stores: a block is dropped when a store burst of the VLSU overlaps
+// it, no block is prefetched while a store burst is in flight, and all the
+// blocks are dropped while the scalar core has pending stores. The physical
+// addresses of the next execution are not known with address translation
+// enabled, so the prefetcher must be disabled in that case.
+
+module vldu_prefetcher import ara_pkg::*; import rvv_pkg::*; #(
+    // Number of buffered blocks
+    parameter  int  unsigned NrEntries    = 0,
+    // Number of load instructions tracked
+    parameter  int  unsigned NrStreams    = 0,
+    // Length of a block, in beats
+    parameter  int  unsigned BurstBeats   = 0,
+    // AXI ID of the prefetches
+    parameter  int  unsigned PfId         = 0,
+    // AXI Interface parameters
+    parameter  int  unsigned AxiDataWidth = 0,
+    parameter  int  unsigned AxiAddrWidth = 0,
+    parameter  type          axi_ar_t     = logic,
+    parameter  type          axi_r_t      = logic,
+    parameter  type          axi_aw_t     = logic,
+    parameter  type          pe_req_t     = logic,
+    // Dependant parameters. DO NOT CHANGE!
+    localparam int  unsigned AxiBeatBytes = AxiDataWidth / 8,
+    localparam int  unsigned BlockBytes   = BurstBeats * AxiBeatBytes
+  ) (
+    input  logic    clk_i,
+    input  logic    rst_ni,
+    // Enable the prefetcher
+    input  logic    en_i,
+    // Interface with the sequencer
+    input  pe_req_t pe_req_i,
+    input  logic    pe_req_valid_i,
+    // Stores of the VLSU and of the scalar core
+    input  axi_aw_t axi_aw_i,
+    input  logic    axi_aw_handshake_i,
+    input  logic    axi_b_handshake_i,
+    input  logic    core_st_pending_i,
+    // AR and R channels, from the load unit
+    input  axi_ar_t slv_ar_i,
+    input  logic    slv_ar_valid_i,
+    output logic    slv_ar_ready_o,
+    output axi_r_t  slv_r_o,
+    output logic    slv_r_valid_o,
+    input  logic    slv_r_ready_i,
+    // AR and R channels, towards the memory
+    output axi_ar_t mst_ar_o,
+    output logic    mst_ar_valid_o,
+    input  logic    mst_ar_ready_i,
+    input  axi_r_t  mst_r_i,
+    input  logic    mst_r_valid_i,
+    output logic    mst_r_ready_o,
+    // Performance counters
+    output logic    hit_o,
+    output logic    miss_o,
+    output logic    prefetch_o
+  );
+
+  import cf_math_pkg::idx_width;
+  import axi_pkg::*;
+
+  `include "common_cells/registers.svh"
+
+  ///////////////////
+  //  Definitions  //
+  ///////////////////
+
+  localparam int unsigned BeatOffBits  = $clog2(AxiBeatBytes);
+  localparam int unsigned BlockOffBits = $clog2(BlockBytes);
+
+  typedef logic [AxiAddrWidth-1:0]              axi_addr_t;
+  typedef logic [AxiDataWidth-1:0]              axi_data_t;
+  typedef logic [AxiAddrWidth-BlockOffBits-1:0] block_t;
+  typedef logic [idx_width(NrEntries)-1:0]      entry_t;
+  typedef logic [idx_width(BurstBeats)-1:0]     beat_t;
+  typedef logic [idx_width(BurstBeats):0]       beat_cnt_t;
+
+  // The enable, with the scalar stores, invalidates the whole buffer
+  logic flush;
+  assign flush = !en_i || core_st_pending_i;
+
+  //////////////
+  //  Buffer  //
+  //////////////
+
+  // An entry is valid if its block can be hit. It is filling while its prefetch is in flight,
+  // and cannot be replaced until all its beats arrived.
+  block_t    [NrEntries-1:0]                 entry_block_d, entry_block_q;
+  logic      [NrEntries-1:0]                 entry_valid_d, entry_valid_q;
+  logic      [NrEntries-1:0]                 entry_fill_d, entry_fill_q;
+  logic      [NrEntries-1:0]                 entry_err_d, entry_err_q;
+  beat_cnt_t [NrEntries-1:0]                 entry_beats_d, entry_beats_q;
+  // The data of an entry is only read once its beats arrived, so it is not reset
+  axi_data_t [NrEntries-1:0][BurstBeats-1:0] entry_data_q;
+
+  ////////////////////
+  //  Stream table  //
+  ////////////////////
+
+  // Base address of the last execution of every tracked instruction, and the distance from
+  // the previous one
+  typedef struct packed {
+    logic       valid;
+    logic [4:0] vd;
+    axi_addr_t  base;
+    axi_addr_t  stride;
+  } stream_t;
+
+  stream_t [NrStreams-1:0] stream_d, stream_q;
+
+  // Train once per instruction
+  logic pe_req_valid_q;
+  vid_t pe_req_id_q;
+
+  // Blocks of the next execution still to be prefetched
+  block_t                        pf_block_d, pf_block_q;
+  logic [idx_width(NrEntries):0] pf_cnt_d, pf_cnt_q;
+
+  // Store bursts in flight
+  logic [15:0] aw_inflight_d, aw_inflight_q;
+
+  //////////////////
+  //  Prefetcher  //
+  //////////////////
+
+  // Prefetch towards the memory
+  axi_ar_t pf_ar_d, pf_ar_q;
+  logic    pf_ar_valid_d, pf_ar_valid_q;
+  // Arbitration of the AR channel towards the memory, locked until the handshake
+  logic    ar_sel_pf, ar_sel_pf_q, ar_lock_q;
+
+  // Replacement
+  entry_t victim, rr_pnt_d, rr_pnt_q;
+  logic   victim_valid;
+
+  // Burst answered from the buffer. Its blocks are pinned in the buffer.
+  logic      serve_d, serve_q;
+  axi_addr_t serve_addr_d, serve_addr_q;
+  axi_ar_t   serve_ar_d, serve_ar_q;
+  beat_cnt_t serve_beat_d, serve_beat_q;
+  block_t    serve_block_d, serve_block_q;
+  entry_t    [1:0] serve_entry_d, serve_entry_q;
+
+  // The prefetches are answered in order, since they share their AXI ID
+  entry_t fill_entry;
+  logic   fill_push, fill_pop;
+
+  fifo_v3 #(
+    .DEPTH       (NrEntries),
+    .FALL_THROUGH(1'b0     ),
+    .dtype       (entry_t  )
+  ) i_fill_queue (
+    .clk_i     (clk_i        ),
+    .rst_ni    (rst_ni       ),
+    .flush_i   (1'b0         ),
+    .testmode_i(1'b0         ),
+    .data_i    (victim       ),
+    .push_i    (fill_push    ),
+    .full_o    (/* Unused */ ),
+    .data_o    (fill_entry   ),
+    .pop_i     (fill_pop     ),
+    .empty_o   (/* Unused */ ),
+    .usage_o   (/* Unused */ )
+  );
+
+  always_comb begin: p_prefetcher
+    // Beats of the demand burst
+    automatic axi_addr_t demand_start = slv_ar_i.addr & ~((axi_addr_t'(1) << slv_ar_i.size) - 1);
+    automatic axi_addr_t demand_last  = demand_start + (axi_addr_t'(slv_ar_i.len) << slv_ar_i.size);
+    automatic block_t    [1:0] demand_block;
+    automatic logic      [1:0] demand_present;
+    automatic entry_t    [1:0] demand_entry;
+    automatic logic      demand_hit;
+    // Beat answered from the buffer
+    automatic axi_addr_t serve_beat_addr = serve_addr_q +
+                                           (axi_addr_t'(serve_beat_q) << serve_ar_q.size);
+    automatic entry_t    serve_entry     = serve_beat_addr[AxiAddrWidth-1:BlockOffBits] == serve_block_q
+                                         ? serve_entry_q[0]
+                                         : serve_entry_q[1];
+    automatic beat_t     serve_idx       = serve_beat_addr[BlockOffBits-1:BeatOffBits];
+    automatic axi_r_t    serve_r;
+    automatic logic      serve_r_valid;
+    // The memory answers a load burst
+    automatic logic      mem_r_pass      = mst_r_valid_i && (mst_r_i.id != PfId);
+    // Store burst
+    automatic axi_addr_t aw_end;
+    automatic block_t    aw_first, aw_last;
+    // Training
+    automatic logic      train;
+    automatic stream_t   stream;
+    automatic axi_addr_t base, next_base, next_end, bytes;
+
+    // Maintain state
+    entry_block_d = entry_block_q;
+    entry_valid_d = entry_valid_q;
+    entry_fill_d  = entry_fill_q;
+    entry_err_d   = entry_err_q;
+    entry_beats_d = entry_beats_q;
+    stream_d      = stream_q;
+    pf_block_d    = pf_block_q;
+    pf_cnt_d      = pf_cnt_q;
+    pf_ar_d       = pf_ar_q;
+    pf_ar_valid_d = pf_ar_valid_q;
+    rr_pnt_d      = rr_pnt_q;
+    aw_inflight_d = aw_inflight_q;
+    serve_d       = serve_q;
+    serve_addr_d  = serve_addr_q;
+    serve_ar_d    = serve_ar_q;
+    serve_beat_d  = serve_beat_q;
+    serve_block_d = serve_block_q;
+    serve_entry_d = serve_entry_q;
+
+    fill_push  = 1'b0;
+    fill_pop   = 1'b0;
+    hit_o      = 1'b0;
+    miss_o     = 1'b0;
+    prefetch_o = 1'b0;
+
+    //////////////
+    //  Lookup  //
+    //////////////
+
+    // A burst spans at most two blocks
+    demand_block[0] = demand_start[AxiAddrWidth-1:BlockOffBits];
+    demand_block[1] = demand_last[AxiAddrWidth-1:BlockOffBits];
+    demand_present  = '0;
+    demand_entry    = '0;
+    for (int unsigned b = 0; b < 2; b++)
+      for (int unsigned e = 0; e < NrEntries; e++)
+        if (entry_valid_q[e] && entry_block_q[e] == demand_block[b]) begin
+          demand_present[b] = 1'b1;
+          demand_entry[b]   = e;
+        end
+
+    // One burst is answered from the buffer at a time. A burst already sent to the memory
+    // cannot be taken back.
+    demand_hit = !flush && !serve_q && (&demand_present) && slv_ar_i.burst == BURST_INCR &&
+                 !(ar_lock_q && !ar_sel_pf_q);
+
+    //////////////////////
+    //  AR arbitration  //
+    //////////////////////
+
+    // The load bursts have the priority over the prefetches
+    ar_sel_pf = ar_lock_q ? ar_sel_pf_q : !(slv_ar_valid_i && !demand_hit);
+
+    mst_ar_o       = ar_sel_pf ? pf_ar_q : slv_ar_i;
+    mst_ar_valid_o = ar_sel_pf ? pf_ar_valid_q : slv_ar_valid_i;
+    slv_ar_ready_o = demand_hit || (!ar_sel_pf && mst_ar_ready_i);
+
+    if (slv_ar_valid_i && slv_ar_ready_o) begin
+      if (demand_hit) begin
+        hit_o         = 1'b1;
+        serve_d       = 1'b1;
+        serve_addr_d  = demand_start;
+        serve_ar_d    = slv_ar_i;
+        serve_beat_d  = '0;
+        serve_block_d = demand_block[0];
+        serve_entry_d = demand_entry;
+      end else begin
+        miss_o = en_i;
+      end
+    end
+
+    if (pf_ar_valid_q && ar_sel_pf && mst_ar_ready_i) begin
+      pf_ar_valid_d = 1'b0;
+      prefetch_o    = 1'b1;
+    end
+
+    /////////////////
+    //  R channel  //
+    /////////////////
+
+    serve_r       = '0;
+    serve_r.id    = serve_ar_q.id;
+    serve_r.data  = entry_data_q[serve_entry][serve_idx];
+    serve_r.resp  = entry_err_q[serve_entry] ? RESP_SLVERR : RESP_OKAY;
+    serve_r.last  = serve_beat_q == serve_ar_q.len;
+    serve_r_valid = serve_q && (entry_beats_q[serve_entry] > serve_idx);
+
+    // The beats from the memory have the priority, since they cannot wait in the buffer
+    slv_r_o       = mem_r_pass ? mst_r_i : serve_r;
+    slv_r_valid_o = mem_r_pass || serve_r_valid;
+    // The prefetched beats are always accepted
+    mst_r_ready_o = (mst_r_i.id == PfId) || slv_r_ready_i;
+
+    // Answer a beat from the buffer
+    if (!mem_r_pass && serve_r_valid && slv_r_ready_i) begin
+      serve_beat_d = serve_beat_q + 1;
+      if (serve_r.last)
+        serve_d = 1'b0;
+    end
+
+    // Prefetched beat
+    if (mst_r_valid_i && (mst_r_i.id == PfId)) begin
+      entry_beats_d[fill_entry] = entry_beats_q[fill_entry] + 1;
+      if (mst_r_i.resp != RESP_OKAY) begin
+        entry_err_d[fill_entry]   = 1'b1;
+        entry_valid_d[fill_entry] = 1'b0;
+      end
+      if (mst_r_i.last) begin
+        entry_fill_d[fill_entry] = 1'b0;
+        fill_pop                 = 1'b1;
+      end
+    end
+
+    //////////////
+    //  Stores  //
+    //////////////
+
+    aw_end   = axi_aw_i.addr + (axi_addr_t'(axi_aw_i.len) << axi_aw_i.size);
+    aw_first = axi_aw_i.addr[AxiAddrWidth-1:BlockOffBits];
+    aw_last  = aw_end[AxiAddrWidth-1:BlockOffBits];
+
+    if (axi_aw_handshake_i) begin
+      aw_inflight_d += 1;
+      // Drop the blocks overwritten by the store
+      for (int unsigned e = 0; e < NrEntries; e++)
+        if (entry_block_q[e] >= aw_first && entry_block_q[e] <= aw_last)
+          entry_valid_d[e] = 1'b0;
+    end
+    if (axi_b_handshake_i)
+      aw_inflight_d -= 1;
+
+    ////////////////
+    //  Training  //
+    ////////////////
+
+    train = en_i && pe_req_valid_i && !(pe_req_valid_q && pe_req_id_q == pe_req_i.id) &&
+            (pe_req_i.op inside {VLE, VLSE});
+
+    stream    = stream_q[pe_req_i.vd[idx_width(NrStreams)-1:0]];
+    base      = axi_addr_t'(pe_req_i.scalar_op);
+    next_base = base + stream.stride;
+    // Bytes accessed by the next execution. Large strides only prefetch the first element.
+    if (pe_req_i.op == VLE)
+      bytes = (axi_addr_t'(pe_req_i.vl) * (pe_req_i.nf + 1)) << pe_req_i.vtype.vsew;
+    else if (pe_req_i.stride > 0 && pe_req_i.stride < BlockBytes)
+      bytes = axi_addr_t'(pe_req_i.vl) * pe_req_i.stride[BlockOffBits-1:0];
+    else
+      bytes = axi_addr_t'(1) << pe_req_i.vtype.vsew;
+
+    if (train) begin
+      // Same distance twice in a row: prefetch the next execution
+      if (stream.valid && stream.vd == pe_req_i.vd && stream.stride != '0 &&
+          base - stream.base == stream.stride && bytes != '0) begin
+        automatic block_t first, last;
+
+        next_end   = next_base + bytes - 1;
+        first      = next_base[AxiAddrWidth-1:BlockOffBits];
+        last       = next_end[AxiAddrWidth-1:BlockOffBits];
+        pf_block_d = first;
+        pf_cnt_d   = (last - first) >= NrEntries ? NrEntries : last - first + 1;
+      end
+
+      // Remember this execution
+      stream_d[pe_req_i.vd[idx_width(NrStreams)-1:0]] = '{
+        valid : 1'b1,
+        vd    : pe_req_i.vd,
+        base  : base,
+        stride: stream.valid && stream.vd == pe_req_i.vd ? base - stream.base : '0
+      };
+    end
+
+    ////////////////
+    //  Prefetch  //
+    ////////////////
+
+    // Replace the entries in round-robin order, but the ones in use
+    victim       = '0;
+    victim_valid = 1'b0;
+    for (int unsigned i = 0; i < NrEntries; i++) begin
+      automatic entry_t e = rr_pnt_q + i;
+      if (!victim_valid && !entry_fill_q[e] &&
+          !(serve_q && (e == serve_entry_q[0] || e == serve_entry_q[1]))) begin
+        victim       = e;
+        victim_valid = 1'b1;
+      end
+    end
+
+    // A store burst accepted in this cycle could overwrite the block to be allocated
+    if (pf_cnt_q != '0 && !pf_ar_valid_q && aw_inflight_q == '0 && !axi_aw_handshake_i &&
+        !flush) begin
+      automatic logic present = 1'b0;
+      for (int unsigned e = 0; e < NrEntries; e++)
+        if (entry_valid_q[e] && entry_block_q[e] == pf_block_q)
+          present = 1'b1;
+
+      if (present || victim_valid) begin
+        // Fetch the block, if not already there
+        if (!present) begin
+          entry_block_d[victim] = pf_block_q;
+          entry_valid_d[victim] = 1'b1;
+          entry_fill_d[victim]  = 1'b1;
+          entry_err_d[victim]   = 1'b0;
+          entry_beats_d[victim] = '0;
+          fill_push             = 1'b1;
+          rr_pnt_d              = victim + 1;
+
+          pf_ar_d = '{
+            id     : PfId,
+            addr   : {pf_block_q, {BlockOffBits{1'b0}}},
+            len    : BurstBeats - 1,
+            size   : BeatOffBits,
+            cache  : CACHE_MODIFIABLE,
+            burst  : BURST_INCR,
+            default: '0
+          };
+          pf_ar_valid_d = 1'b1;
+        end
+        pf_block_d = pf_block_q + 1;
+        pf_cnt_d   = pf_cnt_q - 1;
+      end
+    end
+
+    // Invalidate everything, and stop prefetching
+    if (flush) begin
+      entry_valid_d = '0;
+      pf_cnt_d      = '0;
+    end
+  end: p_prefetcher
+
+  `FF(entry_block_q, entry_block_d, '0, clk_i, rst_ni);
+  `FF(entry_valid_q, entry_valid_d, '0, clk_i, rst_ni);
+  `FF(entry_fill_q, entry_fill_d, '0, clk_i, rst_ni);
+  `FF(entry_err_q, entry_err_d, '0, clk_i, rst_ni);
+  `FF(entry_beats_q, entry_beats_d, '0, clk_i, rst_ni);
+  `FF(stream_q, stream_d, '0, clk_i, rst_ni);
+  `FF(pe_req_valid_q, pe_req_valid_i, 1'b0, clk_i, rst_ni);
+  `FF(pe_req_id_q, pe_req_i.id, '0, clk_i, rst_ni);
+  `FF(pf_block_q, pf_block_d, '0, clk_i, rst_ni);
+  `FF(pf_cnt_q, pf_cnt_d, '0, clk_i, rst_ni);
+  `FF(pf_ar_q, pf_ar_d, '0, clk_i, rst_ni);
+  `FF(pf_ar_valid_q, pf_ar_valid_d, 1'b0, clk_i, rst_ni);
+  `FF(rr_pnt_q, rr_pnt_d, '0, clk_i, rst_ni);
+  `FF(aw_inflight_q, aw_inflight_d, '0, clk_i, rst_ni);
+  `FF(ar_sel_pf_q, ar_sel_pf, 1'b0, clk_i, rst_ni);
+  `FF(ar_lock_q, mst_ar_valid_o && !mst_ar_ready_i, 1'b0, clk_i, rst_ni);
+  `FF(serve_q, serve_d, 1'b0, clk_i, rst_ni);
+  `FF(serve_addr_q, serve_addr_d, '0, clk_i, rst_ni);
+  `FF(serve_ar_q, serve_ar_d, '0, clk_i, rst_ni);
+  `FF(serve_beat_q, serve_beat_d, '0, clk_i, rst_ni);
+  `FF(serve_block_q, serve_block_d, '0, clk_i, rst_ni);
+  `FF(serve_entry_q, serve_entry_d, '0, clk_i, rst_ni);
+
+  // Write the prefetched beats into the buffer
+  always_ff @(posedge clk_i) begin
+    if (mst_r_valid_i && (mst_r_i.id == PfId))
+      entry_data_q[fill_entry][entry_beats_q[fill_entry]] <= mst_r_i.data;
+  end
+
+  //////////////////
+  //  Assertions  //
+  //////////////////
+
+  if (NrEntries < 2 || NrEntries != 2**$clog2(NrEntries))
+    $error("[vldu_prefetcher] The number of entries must be a power of two, and at least two.");
+
+  if (NrStreams < 2 || NrStreams != 2**$clog2(NrStreams))
+    $error("[vldu_prefetcher] The number of streams must be a power of two, and at least two.");
+
+  if (BlockBytes > 4096 || BlockBytes != 2**$clog2(BlockBytes))
+    $error("[vldu_prefetcher] A block must be a power of two, and cannot cross a 4 KiB page.");
+
+endmodule : vldu_prefetcher
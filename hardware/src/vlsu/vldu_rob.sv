@@ -0,0 +1,126 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Reorder buffer of the vector load unit. Every AR burst gets its own AXI ID
+// from a pool of NrIds IDs, allocated in order, so that the memory system can
+// serve the bursts out of order. The R beats are buffered per ID, and handed
+// to the load unit in the same order as the AR bursts. The beats of the
+// oldest burst bypass the buffer.
+
+module vldu_rob import ara_pkg::*; #(
+    // Number of AXI IDs, i.e., of load bursts in flight
+    parameter  int  unsigned NrIds      = 0,
+    // Maximum length of a load burst, in beats
+    parameter  int  unsigned BurstBeats = 0,
+    parameter  type          axi_r_t    = logic,
+    // Dependant parameters. DO NOT CHANGE!
+    localparam type          id_t       = logic [$clog2(NrIds)-1:0],
+    localparam type          beat_cnt_t = logic [$clog2(BurstBeats):0]
+  ) (
+    input  logic   clk_i,
+    input  logic   rst_ni,
+    // AR channel
+    output id_t    ar_id_o,
+    output logic   ar_ready_o,
+    input  logic   ar_valid_i,
+    input  logic   ar_handshake_i,
+    // R channel, from the memory
+    input  axi_r_t axi_r_i,
+    input  logic   axi_r_valid_i,
+    output logic   axi_r_ready_o,
+    // R channel, towards the load unit
+    output axi_r_t axi_r_o,
+    output logic   axi_r_valid_o,
+    input  logic   axi_r_ready_i
+  );
+
+  `include "common_cells/registers.svh"
+
+  ///////////////////
+  //  ID tracking  //
+  ///////////////////
+
+  // IDs are allocated in order, so the oldest burst is the one with ID head_pnt_q
+  id_t                    alloc_pnt_d, alloc_pnt_q;
+  id_t                    head_pnt_d, head_pnt_q;
+  logic [$clog2(NrIds):0] inflight_d, inflight_q;
+
+  assign ar_id_o    = alloc_pnt_q;
+  // An ID is available
+  assign ar_ready_o = inflight_q != NrIds;
+
+  //////////////
+  //  Buffer  //
+  //////////////
+
+  // Every ID holds at most one burst, so there is always place for its beats
+  axi_r_t    [NrIds-1:0][BurstBeats-1:0] buffer_d, buffer_q;
+  beat_cnt_t [NrIds-1:0]                 wr_pnt_d, wr_pnt_q;
+  beat_cnt_t                             rd_pnt_d, rd_pnt_q;
+
+  always_comb begin: p_rob
+    // Beats of the oldest burst waiting in the buffer
+    automatic logic head_buffered = rd_pnt_q != wr_pnt_q[head_pnt_q];
+    // A beat of the oldest burst bypasses the buffer, if there is nothing else before it
+    automatic logic bypass = !head_buffered && axi_r_valid_i && (axi_r_i.id == head_pnt_q);
+
+    // Maintain state
+    alloc_pnt_d = alloc_pnt_q;
+    head_pnt_d  = head_pnt_q;
+    inflight_d  = inflight_q;
+    buffer_d    = buffer_q;
+    wr_pnt_d    = wr_pnt_q;
+    rd_pnt_d    = rd_pnt_q;
+
+    // Hand the oldest beats to the load unit
+    axi_r_o       = head_buffered ? buffer_q[head_pnt_q][rd_pnt_q] : axi_r_i;
+    axi_r_valid_o = head_buffered || bypass;
+    // Beats of the younger bursts are always accepted
+    axi_r_ready_o = bypass ? axi_r_ready_i : 1'b1;
+
+    // Allocate an ID
+    if (ar_valid_i && ar_handshake_i) begin
+      alloc_pnt_d = alloc_pnt_q + 1;
+      inflight_d += 1;
+    end
+
+    // Buffer a beat
+    if (axi_r_valid_i && !bypass) begin
+      buffer_d[axi_r_i.id[$clog2(NrIds)-1:0]][wr_pnt_q[axi_r_i.id[$clog2(NrIds)-1:0]]] = axi_r_i;
+      wr_pnt_d[axi_r_i.id[$clog2(NrIds)-1:0]] += 1;
+    end
+
+    // Release a beat
+    if (axi_r_valid_o && axi_r_ready_i) begin
+      if (head_buffered)
+        rd_pnt_d = rd_pnt_q + 1;
+      // Last beat of the oldest burst: free its ID
+      if (axi_r_o.last) begin
+        wr_pnt_d[head_pnt_q] = '0;
+        rd_pnt_d             = '0;
+        head_pnt_d           = head_pnt_q + 1;
+        inflight_d          -= 1;
+      end
+    end
+  end: p_rob
+
+  `FF(alloc_pnt_q, alloc_pnt_d, '0)
+  `FF(head_pnt_q, head_pnt_d, '0)
+  `FF(inflight_q, inflight_d, '0)
+  `FF(buffer_q, buffer_d, '0)
+  `FF(wr_pnt_q, wr_pnt_d, '0)
+  `FF(rd_pnt_q, rd_pnt_d, '0)
+
+  //////////////////
+  //  Assertions  //
+  //////////////////
+
+  if (NrIds < 2 || NrIds != 2**$clog2(NrIds))
+    $error("[vldu_rob] The number of AXI IDs must be a power of two, and at least two.");
+
+  if (BurstBeats == 0)
+    $error("[vldu_rob] The bursts must be at least one beat long.");
+
+endmodule : vldu_rob
@@ -14,6 +14,8 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
     parameter  type          vaddr_t     = logic,  // Type used to address vector register file elements
     parameter  type          pe_req_t    = logic,
     parameter  type          pe_resp_t   = logic,
+    // Support for segment memory operations
+    parameter  seg_support_e SegSupport  = SegSupportEnable,
     // CVA6 configuration
     parameter  config_pkg::cva6_cfg_t CVA6Cfg = cva6_config_pkg::cva6_cfg,
     parameter  type          exception_t = logic,
@@ -73,6 +75,8 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
 
     // CSR input
     input  logic                    en_ld_st_translation_i,
+    // Stride prefetcher enable
+    input  logic                    pf_en_i,
 
     // Interface with CVA6's sv39 MMU
     // This is everything the MMU can provide, it might be overcomplete for Ara and some signals be useless
@@ -96,9 +100,15 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
     output elen_t     [NrLanes-1:0] ldu_result_wdata_o,
     output strb_t     [NrLanes-1:0] ldu_result_be_o,
     input  logic      [NrLanes-1:0] ldu_result_gnt_i,
-    input  logic      [NrLanes-1:0] ldu_result_final_gnt_i
+    input  logic      [NrLanes-1:0] ldu_result_final_gnt_i,
+    // Performance counters
+    output logic                    perf_pf_hit_o,
+    output logic                    perf_pf_miss_o,
+    output logic                    perf_pf_prefetch_o
   );
 
+  import cf_math_pkg::idx_width;
+
   `include "common_cells/registers.svh"
 
   logic load_complete, store_complete;
@@ -146,15 +156,223 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
   //  Address Generation  //
   //////////////////////////
 
+  // Loads and stores have their own address generator, so that the AR and AW channels can be
+  // busy at the same time. The signals are indexed by Load (0) and Store (1).
+
   // Interface with the load/store units
-  addrgen_axi_req_t axi_addrgen_req;
-  logic             axi_addrgen_req_valid;
-  logic             ldu_axi_addrgen_req_ready;
-  logic             stu_axi_addrgen_req_ready;
+  addrgen_axi_req_t [1:0] axi_addrgen_req;
+  logic             [1:0] axi_addrgen_req_valid;
+  logic                   ldu_axi_addrgen_req_ready;
+  logic                   stu_axi_addrgen_req_ready;
+
+  // Reorder buffer ready to accept a new load burst
+  logic    rob_ar_ready;
+
+  // Interface with the sequencer
+  logic       [1:0] addrgen_ack;
+  exception_t [1:0] addrgen_exception;
+  vlen_t      [1:0] addrgen_exception_vstart;
+  logic       [1:0] addrgen_fof_exception;
+  logic       [1:0] addrgen_operand_ready;
+  logic       [1:0] addrgen_mem_hazard;
+
+  // Interface with the MMU
+  logic                       [1:0] addrgen_mmu_req;
+  logic [1:0][CVA6Cfg.VLEN-1:0]     addrgen_mmu_vaddr;
+  logic                       [1:0] addrgen_mmu_is_store;
+  logic                       [1:0] addrgen_mmu_dtlb_hit;
+  logic                       [1:0] addrgen_mmu_valid;
+  exception_t                 [1:0] addrgen_mmu_exception;
+
+  // Only one memory operation is acknowledged at a time
+  always_comb begin: p_addrgen_resp
+    automatic int unsigned ack_unit = addrgen_ack[OffsetStore] ? OffsetStore : OffsetLoad;
+
+    addrgen_ack_o              = |addrgen_ack;
+    addrgen_exception_o        = addrgen_exception[ack_unit];
+    addrgen_exception_vstart_o = addrgen_exception_vstart[ack_unit];
+    addrgen_fof_exception_o    = addrgen_fof_exception[ack_unit];
+    // Only one indexed operation reads the lanes at a time
+    addrgen_operand_ready_o    = |addrgen_operand_ready;
+  end: p_addrgen_resp
+
+  /////////////////////////////
+  //  Memory Disambiguation  //
+  /////////////////////////////
+
+  // Range of bytes accessed by the vector memory operations in flight. Only unit-stride
+  // operations have an exact range; strided and indexed ones can access any address.
+  typedef struct packed {
+    axi_addr_t lo;
+    axi_addr_t hi;
+  } mem_range_t;
+
+  mem_range_t [NrVInsn-1:0] mem_range_d, mem_range_q;
+  logic       [NrVInsn-1:0] mem_range_ld_d, mem_range_ld_q;
+  logic       [NrVInsn-1:0] mem_range_st_d, mem_range_st_q;
+
+  always_comb begin: p_mem_disambiguation
+    automatic mem_range_t range;
+
+    if (pe_req_i.op inside {VLE, VSE}) begin
+      range.lo = pe_req_i.scalar_op + ((pe_req_i.vstart * (pe_req_i.nf + 1)) << unsigned'(pe_req_i.vtype.vsew));
+      range.hi = pe_req_i.scalar_op + ((pe_req_i.vl * (pe_req_i.nf + 1)) << unsigned'(pe_req_i.vtype.vsew));
+    end else begin
+      range.lo = '0;
+      range.hi = '1;
+    end
+
+    // Forget the operations that are over
+    mem_range_d    = mem_range_q;
+    mem_range_ld_d = mem_range_ld_q & pe_vinsn_running_i;
+    mem_range_st_d = mem_range_st_q & pe_vinsn_running_i;
+
+    // A store cannot start while it overlaps with an older load in flight. The sequencer
+    // issues the memory operations one at a time, so all the tracked operations of the other
+    // kind are older than the current request. It also waits for the address generator to
+    // send all the AXI requests of a memory operation before issuing the next one, so a load
+    // only needs to wait for the store bursts it overlaps (see below). With address
+    // translation, the last store bursts might still be waiting for the AW channel, so a
+    // load cannot start while it overlaps with an older store in flight.
+    addrgen_mem_hazard = '0;
+    for (int unsigned v = 0; v < NrVInsn; v++)
+      if (range.lo < mem_range_q[v].hi && mem_range_q[v].lo < range.hi) begin
+        addrgen_mem_hazard[OffsetLoad]  |= mem_range_st_q[v] && en_ld_st_translation_i;
+        addrgen_mem_hazard[OffsetStore] |= mem_range_ld_q[v];
+      end
+
+    // Track the new memory operation
+    if (pe_req_valid_i && (is_load(pe_req_i.op) || is_store(pe_req_i.op))) begin
+      mem_range_d[pe_req_i.id]    = range;
+      mem_range_ld_d[pe_req_i.id] = is_load(pe_req_i.op);
+      mem_range_st_d[pe_req_i.id] = is_store(pe_req_i.op);
+    end
+  end: p_mem_disambiguation
+
+  `FF(mem_range_q, mem_range_d, '0, clk_i, rst_ni);
+  `FF(mem_range_ld_q, mem_range_ld_d, '0, clk_i, rst_ni);
+  `FF(mem_range_st_q, mem_range_st_d, '0, clk_i, rst_ni);
+
+  // Range of bytes accessed by an AXI burst
+  function automatic mem_range_t burst_range(axi_addr_t addr, axi_pkg::size_t size,
+      axi_pkg::len_t len);
+    burst_range.lo = axi_pkg::aligned_addr(addr, size);
+    burst_range.hi = burst_range.lo + ((axi_addr_t'(len) + 1) << size);
+  endfunction: burst_range
+
+  // Store bursts in flight, from their AW handshake to their B handshake. The store bursts
+  // share the same AXI ID, so their B responses come back in order.
+  mem_range_t [VlsuNrStBursts-1:0]             st_burst_d, st_burst_q;
+  logic       [VlsuNrStBursts-1:0]             st_burst_valid_d, st_burst_valid_q;
+  logic       [idx_width(VlsuNrStBursts)-1:0] st_burst_wr_ptr_d, st_burst_wr_ptr_q;
+  logic       [idx_width(VlsuNrStBursts)-1:0] st_burst_rd_ptr_d, st_burst_rd_ptr_q;
+  logic                                        st_burst_full;
+
+  // AW channel from the store address generator
+  axi_aw_t addrgen_axi_aw;
+  logic    addrgen_axi_aw_valid;
+  logic    addrgen_axi_aw_ready;
+
+  // AR channel from the load address generator, and its overlap with the store bursts
+  axi_ar_t addrgen_axi_ar;
+  logic    addrgen_axi_ar_valid;
+  logic    addrgen_axi_ar_ready;
+  axi_ar_t ld_ar_buf;
+  logic    ld_ar_buf_valid;
+  logic    ld_ar_buf_ready;
+  logic    ld_ar_st_hazard;
+
+  // Do not send a new store burst if its range cannot be tracked
+  assign st_burst_full        = &st_burst_valid_q;
+  assign axi_req.aw           = addrgen_axi_aw;
+  assign axi_req.aw_valid     = addrgen_axi_aw_valid && !st_burst_full;
+  assign addrgen_axi_aw_ready = axi_resp.aw_ready && !st_burst_full;
+
+  always_comb begin: p_st_burst
+    automatic mem_range_t ar_range = burst_range(ld_ar_buf.addr, ld_ar_buf.size, ld_ar_buf.len);
+
+    st_burst_d        = st_burst_q;
+    st_burst_valid_d  = st_burst_valid_q;
+    st_burst_wr_ptr_d = st_burst_wr_ptr_q;
+    st_burst_rd_ptr_d = st_burst_rd_ptr_q;
+
+    // Retire the oldest store burst
+    if (axi_resp.b_valid && axi_req.b_ready) begin
+      st_burst_valid_d[st_burst_rd_ptr_q] = 1'b0;
+      st_burst_rd_ptr_d = (st_burst_rd_ptr_q == VlsuNrStBursts - 1) ? '0 : st_burst_rd_ptr_q + 1;
+    end
+
+    // Track the new store burst
+    if (axi_req.aw_valid && axi_resp.aw_ready) begin
+      st_burst_d[st_burst_wr_ptr_q]       = burst_range(axi_req.aw.addr, axi_req.aw.size,
+                                              axi_req.aw.len);
+      st_burst_valid_d[st_burst_wr_ptr_q] = 1'b1;
+      st_burst_wr_ptr_d = (st_burst_wr_ptr_q == VlsuNrStBursts - 1) ? '0 : st_burst_wr_ptr_q + 1;
+    end
+
+    // All the store bursts in flight are older than the load bursts, but the ones of stores
+    // that do not overlap with the running loads. A load burst waits for the B responses of
+    // the store bursts it overlaps, so that it reads their data from the memory.
+    ld_ar_st_hazard = 1'b0;
+    for (int unsigned b = 0; b < VlsuNrStBursts; b++)
+      if (st_burst_valid_q[b] && ar_range.lo < st_burst_q[b].hi && st_burst_q[b].lo < ar_range.hi)
+        ld_ar_st_hazard = 1'b1;
+  end: p_st_burst
+
+  `FF(st_burst_q, st_burst_d, '0, clk_i, rst_ni);
+  `FF(st_burst_valid_q, st_burst_valid_d, '0, clk_i, rst_ni);
+  `FF(st_burst_wr_ptr_q, st_burst_wr_ptr_d, '0, clk_i, rst_ni);
+  `FF(st_burst_rd_ptr_q, st_burst_rd_ptr_d, '0, clk_i, rst_ni);
+
+  // The address generator only sends an AR request when the AR channel is ready, so its AR
+  // requests go through a fall-through register before being checked against the store bursts
+  fall_through_register #(
+    .T(axi_ar_t)
+  ) i_ld_ar_buf (
+    .clk_i     (clk_i               ),
+    .rst_ni    (rst_ni              ),
+    .clr_i     (1'b0                ),
+    .testmode_i(1'b0                ),
+    .valid_i   (addrgen_axi_ar_valid),
+    .ready_o   (addrgen_axi_ar_ready),
+    .data_i    (addrgen_axi_ar      ),
+    .valid_o   (ld_ar_buf_valid     ),
+    .ready_i   (ld_ar_buf_ready     ),
+    .data_o    (ld_ar_buf           )
+  );
+
+  ///////////////////
+  //  MMU Arbiter  //
+  ///////////////////
+
+  // The address generators share the MMU. A translation is not interrupted, and the loads
+  // have the priority.
+  logic mmu_sel, mmu_sel_q;
+  logic mmu_lock_q;
+
+  always_comb begin: p_mmu_arbiter
+    mmu_sel = mmu_lock_q ? mmu_sel_q : !addrgen_mmu_req[OffsetLoad];
+
+    mmu_misaligned_ex_o = 1'b0;
+    mmu_req_o           = addrgen_mmu_req[mmu_sel];
+    mmu_vaddr_o         = addrgen_mmu_vaddr[mmu_sel];
+    mmu_is_store_o      = addrgen_mmu_is_store[mmu_sel];
+
+    addrgen_mmu_dtlb_hit           = '0;
+    addrgen_mmu_valid              = '0;
+    addrgen_mmu_exception          = '0;
+    addrgen_mmu_dtlb_hit[mmu_sel]  = mmu_dtlb_hit_i;
+    addrgen_mmu_valid[mmu_sel]     = mmu_valid_i;
+    addrgen_mmu_exception[mmu_sel] = mmu_exception_i;
+  end: p_mmu_arbiter
+
+  `FF(mmu_sel_q, mmu_sel, 1'b0, clk_i, rst_ni);
+  `FF(mmu_lock_q, mmu_req_o && !mmu_valid_i, 1'b0, clk_i, rst_ni);
 
   addrgen #(
     .NrLanes     (NrLanes     ),
     .VLEN        (VLEN        ),
+    .IsLoad      (1'b1        ),
     .AxiDataWidth(AxiDataWidth),
     .AxiAddrWidth(AxiAddrWidth),
     .axi_ar_t    (axi_ar_t    ),
@@ -163,52 +381,214 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
     .pe_resp_t   (pe_resp_t   ),
     .CVA6Cfg     (CVA6Cfg     ),
     .exception_t (exception_t )
-  ) i_addrgen (
-    .clk_i                      (clk_i                      ),
-    .rst_ni                     (rst_ni                     ),
+  ) i_addrgen_load (
+    .clk_i                      (clk_i                                ),
+    .rst_ni                     (rst_ni                               ),
     // AXI Memory Interface
-    .axi_aw_o                   (axi_req.aw                 ),
-    .axi_aw_valid_o             (axi_req.aw_valid           ),
-    .axi_aw_ready_i             (axi_resp.aw_ready          ),
-    .axi_ar_o                   (axi_req.ar                 ),
-    .axi_ar_valid_o             (axi_req.ar_valid           ),
-    .axi_ar_ready_i             (axi_resp.ar_ready          ),
+    .axi_aw_o                   (/* Unused */                         ),
+    .axi_aw_valid_o             (/* Unused */                         ),
+    .axi_aw_ready_i             (1'b0                                 ),
+    .axi_ar_o                   (addrgen_axi_ar                       ),
+    .axi_ar_valid_o             (addrgen_axi_ar_valid                 ),
+    .axi_ar_ready_i             (addrgen_axi_ar_ready                 ),
     // Interface with dispatcher
-    .core_st_pending_i          (core_st_pending_i          ),
+    .core_st_pending_i          (core_st_pending_i                    ),
+    .mem_hazard_i               (addrgen_mem_hazard[OffsetLoad]       ),
     // Interface with the sequencer
-    .pe_req_i                   (pe_req_i                   ),
-    .pe_req_valid_i             (pe_req_valid_i             ),
-    .pe_vinsn_running_i         (pe_vinsn_running_i         ),
-    .addrgen_ack_o              (addrgen_ack_o              ),
-    .addrgen_exception_o        ( addrgen_exception_o       ),
-    .addrgen_exception_vstart_o ( addrgen_exception_vstart_o),
-    .addrgen_fof_exception_o    ( addrgen_fof_exception_o   ),
-    .addrgen_illegal_load_o     (addrgen_illegal_load       ),
-    .addrgen_illegal_store_o    (addrgen_illegal_store      ),
+    .pe_req_i                   (pe_req_i                             ),
+    .pe_req_valid_i             (pe_req_valid_i                       ),
+    .pe_vinsn_running_i         (pe_vinsn_running_i                   ),
+    .addrgen_ack_o              (addrgen_ack[OffsetLoad]              ),
+    .addrgen_exception_o        (addrgen_exception[OffsetLoad]        ),
+    .addrgen_exception_vstart_o (addrgen_exception_vstart[OffsetLoad] ),
+    .addrgen_fof_exception_o    (addrgen_fof_exception[OffsetLoad]    ),
+    .addrgen_illegal_load_o     (addrgen_illegal_load                 ),
+    .addrgen_illegal_store_o    (/* Unused */                         ),
     // Interface with the lanes
-    .addrgen_operand_i          (addrgen_operand_i          ),
-    .addrgen_operand_valid_i    (addrgen_operand_valid_i    ),
-    .addrgen_operand_ready_o    (addrgen_operand_ready_o    ),
+    .addrgen_operand_i          (addrgen_operand_i                    ),
+    .addrgen_operand_valid_i    (addrgen_operand_valid_i              ),
+    .addrgen_operand_ready_o    (addrgen_operand_ready[OffsetLoad]    ),
     // Interface with the load/store units
-    .axi_addrgen_req_o          (axi_addrgen_req            ),
-    .axi_addrgen_req_valid_o    (axi_addrgen_req_valid      ),
-    .ldu_axi_addrgen_req_ready_i(ldu_axi_addrgen_req_ready  ),
-    .stu_axi_addrgen_req_ready_i(stu_axi_addrgen_req_ready  ),
-    .lsu_ex_flush_i             (lsu_ex_flush_i             ),
+    .axi_addrgen_req_o          (axi_addrgen_req[OffsetLoad]          ),
+    .axi_addrgen_req_valid_o    (axi_addrgen_req_valid[OffsetLoad]    ),
+    .ldu_axi_addrgen_req_ready_i(ldu_axi_addrgen_req_ready            ),
+    .stu_axi_addrgen_req_ready_i(1'b0                                 ),
+    .lsu_ex_flush_i             (lsu_ex_flush_i                       ),
+    // CSR input
+    .en_ld_st_translation_i     (en_ld_st_translation_i               ),
+    // Interface with the MMU
+    .mmu_misaligned_ex_o        (/* Unused */                         ),
+    .mmu_req_o                  (addrgen_mmu_req[OffsetLoad]          ),
+    .mmu_vaddr_o                (addrgen_mmu_vaddr[OffsetLoad]        ),
+    .mmu_is_store_o             (addrgen_mmu_is_store[OffsetLoad]     ),
+    .mmu_dtlb_hit_i             (addrgen_mmu_dtlb_hit[OffsetLoad]     ),
+    .mmu_dtlb_ppn_i             (mmu_dtlb_ppn_i                       ),
+    .mmu_valid_i                (addrgen_mmu_valid[OffsetLoad]        ),
+    .mmu_paddr_i                (mmu_paddr_i                          ),
+    .mmu_exception_i            (addrgen_mmu_exception[OffsetLoad]    )
+  );
 
+  addrgen #(
+    .NrLanes     (NrLanes     ),
+    .VLEN        (VLEN        ),
+    .IsLoad      (1'b0        ),
+    .AxiDataWidth(AxiDataWidth),
+    .AxiAddrWidth(AxiAddrWidth),
+    .axi_ar_t    (axi_ar_t    ),
+    .axi_aw_t    (axi_aw_t    ),
+    .pe_req_t    (pe_req_t    ),
+    .pe_resp_t   (pe_resp_t   ),
+    .CVA6Cfg     (CVA6Cfg     ),
+    .exception_t (exception_t )
+  ) i_addrgen_store (
+    .clk_i                      (clk_i                                ),
+    .rst_ni                     (rst_ni                               ),
+    // AXI Memory Interface
+    .axi_aw_o                   (addrgen_axi_aw                       ),
+    .axi_aw_valid_o             (addrgen_axi_aw_valid                 ),
+    .axi_aw_ready_i             (addrgen_axi_aw_ready                 ),
+    .axi_ar_o                   (/* Unused */                         ),
+    .axi_ar_valid_o             (/* Unused */                         ),
+    .axi_ar_ready_i             (1'b0                                 ),
+    // Interface with dispatcher
+    .core_st_pending_i          (core_st_pending_i                    ),
+    .mem_hazard_i               (addrgen_mem_hazard[OffsetStore]      ),
+    // Interface with the sequencer
+    .pe_req_i                   (pe_req_i                             ),
+    .pe_req_valid_i             (pe_req_valid_i                       ),
+    .pe_vinsn_running_i         (pe_vinsn_running_i                   ),
+    .addrgen_ack_o              (addrgen_ack[OffsetStore]             ),
+    .addrgen_exception_o        (addrgen_exception[OffsetStore]       ),
+    .addrgen_exception_vstart_o (addrgen_exception_vstart[OffsetStore]),
+    .addrgen_fof_exception_o    (addrgen_fof_exception[OffsetStore]   ),
+    .addrgen_illegal_load_o     (/* Unused */                         ),
+    .addrgen_illegal_store_o    (addrgen_illegal_store                ),
+    // Interface with the lanes
+    .addrgen_operand_i          (addrgen_operand_i                    ),
+    .addrgen_operand_valid_i    (addrgen_operand_valid_i              ),
+    .addrgen_operand_ready_o    (addrgen_operand_ready[OffsetStore]   ),
+    // Interface with the load/store units
+    .axi_addrgen_req_o          (axi_addrgen_req[OffsetStore]         ),
+    .axi_addrgen_req_valid_o    (axi_addrgen_req_valid[OffsetStore]   ),
+    .ldu_axi_addrgen_req_ready_i(1'b0                                 ),
+    .stu_axi_addrgen_req_ready_i(stu_axi_addrgen_req_ready            ),
+    .lsu_ex_flush_i             (lsu_ex_flush_i                       ),
     // CSR input
-    .en_ld_st_translation_i,
-    .mmu_misaligned_ex_o,
-    .mmu_req_o,
-    .mmu_vaddr_o,
-    .mmu_is_store_o,
-    .mmu_dtlb_hit_i,
-    .mmu_dtlb_ppn_i,
-    .mmu_valid_i,
-    .mmu_paddr_i,
-    .mmu_exception_i
+    .en_ld_st_translation_i     (en_ld_st_translation_i               ),
+    // Interface with the MMU
+    .mmu_misaligned_ex_o        (/* Unused */                         ),
+    .mmu_req_o                  (addrgen_mmu_req[OffsetStore]         ),
+    .mmu_vaddr_o                (addrgen_mmu_vaddr[OffsetStore]       ),
+    .mmu_is_store_o             (addrgen_mmu_is_store[OffsetStore]    ),
+    .mmu_dtlb_hit_i             (addrgen_mmu_dtlb_hit[OffsetStore]    ),
+    .mmu_dtlb_ppn_i             (mmu_dtlb_ppn_i                       ),
+    .mmu_valid_i                (addrgen_mmu_valid[OffsetStore]       ),
+    .mmu_paddr_i                (mmu_paddr_i                          ),
+    .mmu_exception_i            (addrgen_mmu_exception[OffsetStore]   )
   );
 
+  //////////////////////
+  //  Reorder Buffer  //
+  //////////////////////
+
+  // Every load burst gets its own AXI ID, and the responses are put back in order
+  logic [$clog2(VlsuNrAxiIds)-1:0] rob_ar_id;
+  axi_r_t                          rob_axi_r;
+  logic                            rob_axi_r_valid;
+  logic                            rob_axi_r_ready;
+
+  // AR and R channels between the reorder buffer and the stride prefetcher
+  axi_ar_t ld_axi_ar;
+  logic    ld_axi_ar_valid;
+  logic    ld_axi_ar_ready;
+  axi_r_t  ld_axi_r;
+  logic    ld_axi_r_valid;
+  logic    ld_axi_r_ready;
+
+  always_comb begin: p_axi_ar
+    ld_axi_ar       = ld_ar_buf;
+    ld_axi_ar.id    = rob_ar_id;
+    ld_axi_ar_valid = ld_ar_buf_valid && rob_ar_ready && !ld_ar_st_hazard;
+
+    ld_ar_buf_ready = ld_axi_ar_ready && rob_ar_ready && !ld_ar_st_hazard;
+  end: p_axi_ar
+
+  vldu_rob #(
+    .NrIds     (VlsuNrAxiIds     ),
+    .BurstBeats(VlsuRobBurstBeats),
+    .axi_r_t   (axi_r_t          )
+  ) i_vldu_rob (
+    .clk_i         (clk_i            ),
+    .rst_ni        (rst_ni           ),
+    .ar_id_o       (rob_ar_id        ),
+    .ar_ready_o    (rob_ar_ready     ),
+    .ar_valid_i    (ld_axi_ar_valid  ),
+    .ar_handshake_i(ld_axi_ar_ready  ),
+    .axi_r_i       (ld_axi_r         ),
+    .axi_r_valid_i (ld_axi_r_valid   ),
+    .axi_r_ready_o (ld_axi_r_ready   ),
+    .axi_r_o       (rob_axi_r        ),
+    .axi_r_valid_o (rob_axi_r_valid  ),
+    .axi_r_ready_i (rob_axi_r_ready  )
+  );
+
+  /////////////////////////
+  //  Stride Prefetcher  //
+  /////////////////////////
+
+  if (VlsuPfEntries != 0) begin: gen_prefetcher
+    // The prefetches use the first AXI ID after the ones of the reorder buffer
+    vldu_prefetcher #(
+      .NrEntries   (VlsuPfEntries    ),
+      .NrStreams   (VlsuPfStreams    ),
+      .BurstBeats  (VlsuRobBurstBeats),
+      .PfId        (VlsuNrAxiIds     ),
+      .AxiDataWidth(AxiDataWidth     ),
+      .AxiAddrWidth(AxiAddrWidth     ),
+      .axi_ar_t    (axi_ar_t         ),
+      .axi_r_t     (axi_r_t          ),
+      .axi_aw_t    (axi_aw_t         ),
+      .pe_req_t    (pe_req_t         )
+    ) i_vldu_prefetcher (
+      .clk_i             (clk_i                                        ),
+      .rst_ni            (rst_ni                                       ),
+      // The physical addresses of the next loads are not known with address translation
+      .en_i              (pf_en_i && !en_ld_st_translation_i           ),
+      .pe_req_i          (pe_req_i                                     ),
+      .pe_req_valid_i    (pe_req_valid_i                               ),
+      .axi_aw_i          (axi_req.aw                                   ),
+      .axi_aw_handshake_i(axi_req.aw_valid && axi_resp.aw_ready        ),
+      .axi_b_handshake_i (axi_resp.b_valid && axi_req.b_ready          ),
+      .core_st_pending_i (core_st_pending_i                            ),
+      .slv_ar_i          (ld_axi_ar                                    ),
+      .slv_ar_valid_i    (ld_axi_ar_valid                              ),
+      .slv_ar_ready_o    (ld_axi_ar_ready                              ),
+      .slv_r_o           (ld_axi_r                                     ),
+      .slv_r_valid_o     (ld_axi_r_valid                               ),
+      .slv_r_ready_i     (ld_axi_r_ready                               ),
+      .mst_ar_o          (axi_req.ar                                   ),
+      .mst_ar_valid_o    (axi_req.ar_valid                             ),
+      .mst_ar_ready_i    (axi_resp.ar_ready                            ),
+      .mst_r_i           (axi_resp.r                                   ),
+      .mst_r_valid_i     (axi_resp.r_valid                             ),
+      .mst_r_ready_o     (axi_req.r_ready                              ),
+      .hit_o             (perf_pf_hit_o                                ),
+      .miss_o            (perf_pf_miss_o                               ),
+      .prefetch_o        (perf_pf_prefetch_o                           )
+    );
+  end: gen_prefetcher else begin: gen_no_prefetcher
+    assign axi_req.ar       = ld_axi_ar;
+    assign axi_req.ar_valid = ld_axi_ar_valid;
+    assign ld_axi_ar_ready  = axi_resp.ar_ready;
+    assign ld_axi_r         = axi_resp.r;
+    assign ld_axi_r_valid   = axi_resp.r_valid;
+    assign axi_req.r_ready  = ld_axi_r_ready;
+
+    assign perf_pf_hit_o      = 1'b0;
+    assign perf_pf_miss_o     = 1'b0;
+    assign perf_pf_prefetch_o = 1'b0;
+  end: gen_no_prefetcher
+
   ////////////////////////
   //  Vector Load Unit  //
   ////////////////////////
@@ -221,14 +601,15 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
     .VLEN        (VLEN        ),
     .vaddr_t     (vaddr_t     ),
     .pe_req_t    (pe_req_t    ),
-    .pe_resp_t   (pe_resp_t   )
+    .pe_resp_t   (pe_resp_t   ),
+    .SegSupport  (SegSupport  )
   ) i_vldu (
     .clk_i                  (clk_i                     ),
     .rst_ni                 (rst_ni                    ),
     // AXI Memory Interface
-    .axi_r_i                (axi_resp.r                ),
-    .axi_r_valid_i          (axi_resp.r_valid          ),
-    .axi_r_ready_o          (axi_req.r_ready           ),
+    .axi_r_i                (rob_axi_r                 ),
+    .axi_r_valid_i          (rob_axi_r_valid           ),
+    .axi_r_ready_o          (rob_axi_r_ready           ),
     // Interface with the dispatcher
     .load_complete_o        (load_complete             ),
     // Interface with the main sequencer
@@ -239,8 +620,8 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
     .pe_resp_o              (pe_resp_o[OffsetLoad]     ),
     .ldu_current_burst_exception_o (ldu_current_burst_exception),
     // Interface with the address generator
-    .axi_addrgen_req_i      (axi_addrgen_req           ),
-    .axi_addrgen_req_valid_i(axi_addrgen_req_valid     ),
+    .axi_addrgen_req_i      (axi_addrgen_req[OffsetLoad]      ),
+    .axi_addrgen_req_valid_i(axi_addrgen_req_valid[OffsetLoad]),
     .axi_addrgen_req_ready_o(ldu_axi_addrgen_req_ready ),
     .addrgen_illegal_load_i (addrgen_illegal_load      ),
     // Interface with the Mask unit
@@ -271,7 +652,8 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
     .VLEN        (VLEN        ),
     .vaddr_t     (vaddr_t     ),
     .pe_req_t    (pe_req_t    ),
-    .pe_resp_t   (pe_resp_t   )
+    .pe_resp_t   (pe_resp_t   ),
+    .SegSupport  (SegSupport  )
   ) i_vstu (
     .clk_i                  (clk_i                      ),
     .rst_ni                 (rst_ni                     ),
@@ -293,8 +675,8 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
     .pe_resp_o              (pe_resp_o[OffsetStore]     ),
     .stu_current_burst_exception_o (stu_current_burst_exception),
     // Interface with the address generator
-    .axi_addrgen_req_i      (axi_addrgen_req            ),
-    .axi_addrgen_req_valid_i(axi_addrgen_req_valid      ),
+    .axi_addrgen_req_i      (axi_addrgen_req[OffsetStore]      ),
+    .axi_addrgen_req_valid_i(axi_addrgen_req_valid[OffsetStore]),
     .axi_addrgen_req_ready_o(stu_axi_addrgen_req_ready  ),
     .addrgen_illegal_store_i(addrgen_illegal_store      ),
     // Interface with the Mask unit
@@ -318,6 +700,15 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
   if (AxiAddrWidth == 0)
     $error("[vlsu] The address width of the AXI bus cannot be zero.");
 
+  if (AxiDataWidth/8 > MaxAxiDataWidthB)
+    $error("[vlsu] The data width of the AXI bus cannot exceed %0d bits.", 8*MaxAxiDataWidthB);
+
+  if ($bits(axi_req.ar.id) < $clog2(VlsuNrAxiIds))
+    $error("[vlsu] The AXI ID is too narrow for %0d load bursts in flight.", VlsuNrAxiIds);
+
+  if (VlsuPfEntries != 0 && $bits(axi_req.ar.id) <= $clog2(VlsuNrAxiIds))
+    $error("[vlsu] The AXI ID is too narrow for the prefetches.");
+
   if (NrLanes == 0)
     $error("[vlsu] Ara needs to have at least one lane.");
 
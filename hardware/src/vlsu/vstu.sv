@@ -19,6 +19,8 @@ module vstu import ara_pkg::*; import rvv_pkg::*; #(
     parameter  type          vaddr_t   = logic,  // Type used to address vector register file elements
     parameter  type          pe_req_t  = logic,
     parameter  type          pe_resp_t = logic,
+    // Support for segment memory operations
+    parameter  seg_support_e SegSupport = SegSupportEnable,
     // AXI Interface parameters
     parameter  int  unsigned AxiDataWidth = 0,
     parameter  int  unsigned AxiAddrWidth = 0,
@@ -241,6 +243,45 @@ module vstu import ara_pkg::*; import rvv_pkg::*; #(
   // Signal that the current burst is having an exception
   logic stu_current_burst_exception_d;
 
+  // Bytes of the current W beat that belong to the vector, and their position in the
+  // sequence of valid bytes. Requests that coalesce several non-contiguous elements only
+  // write some of the bytes of their beat.
+  logic [AxiDataWidth/8-1:0]                              beat_byte_valid;
+  logic [AxiDataWidth/8-1:0][idx_width(AxiDataWidth/8):0] beat_byte_idx;
+  logic [idx_width(AxiDataWidth/8):0]                     beat_valid_bytes;
+
+  // Misaligned stores: an AXI beat can take bytes from more than one VRF word. The bytes
+  // taken from the previous words wait in this buffer until the rest of the beat is ready.
+  axi_w_t                             w_beat_d, w_beat_q;
+  logic [idx_width(AxiDataWidth/8):0] w_beat_bytes_d, w_beat_bytes_q;
+
+  // Unit-stride segment stores: the lanes send the VRF words of the nf + 1 fields of the
+  // same elements one after the other. The words of the first nf fields wait in this buffer
+  // for the one of the last field, and the fields are then interleaved into the W beats.
+  logic                                  issue_segment;
+  elen_t [MaxSegFields-1:0][NrLanes-1:0] seg_word_d, seg_word_q;
+  // Number of buffered fields
+  logic  [2:0]                           seg_fill_d, seg_fill_q;
+  // Field of the next byte written into the W channel
+  logic  [2:0]                           seg_field_d, seg_field_q;
+
+  assign issue_segment = SegSupport && vinsn_issue_valid && (vinsn_issue_q.nf != '0);
+
+  always_comb begin: p_beat_bytes
+    automatic shortint unsigned lower_byte = beat_lower_byte(axi_addrgen_req_i.addr,
+      axi_addrgen_req_i.size, axi_addrgen_req_i.len, BURST_INCR, AxiDataWidth/8, axi_len_q);
+    automatic shortint unsigned upper_byte = beat_upper_byte(axi_addrgen_req_i.addr,
+      axi_addrgen_req_i.size, axi_addrgen_req_i.len, BURST_INCR, AxiDataWidth/8, axi_len_q);
+
+    beat_valid_bytes = '0;
+    for (int unsigned axi_byte = 0; axi_byte < AxiDataWidth/8; axi_byte++) begin
+      beat_byte_valid[axi_byte] = (axi_byte >= lower_byte) && (axi_byte <= upper_byte) &&
+                                  axi_addrgen_req_i.strb[axi_byte];
+      beat_byte_idx[axi_byte]   = beat_valid_bytes;
+      beat_valid_bytes          = beat_valid_bytes + beat_byte_valid[axi_byte];
+    end
+  end: p_beat_bytes
+
   always_comb begin: p_vstu
     // NOTE: these are out here only for debug visibility, they could go in p_vldu as automatic variables
     vrf_seq_byte = '0;
@@ -277,11 +318,25 @@ module vstu import ara_pkg::*; import rvv_pkg::*; #(
     vrf_cnt_d = vrf_cnt_q;
     first_lane_payload_d = first_lane_payload_q;
 
+    w_beat_d       = w_beat_q;
+    w_beat_bytes_d = w_beat_bytes_q;
+
+    seg_word_d  = seg_word_q;
+    seg_fill_d  = seg_fill_q;
+    seg_field_d = seg_field_q;
+
     stu_current_burst_exception_d = 1'b0;
 
     // Inform the main sequencer if we are idle
     pe_req_ready_o = !vinsn_queue_full;
 
+    // Buffer the VRF words of the first fields of a unit-stride segment store
+    if (issue_segment && (seg_fill_q != vinsn_issue_q.nf) && &stu_operand_valid) begin : segment_buffer
+      seg_word_d[seg_fill_q] = stu_operand;
+      stu_operand_ready      = '1;
+      seg_fill_d             = seg_fill_q + 1;
+    end : segment_buffer
+
     /////////////////////////////////////
     //  Write data into the W channel  //
     /////////////////////////////////////
@@ -295,12 +350,6 @@ module vstu import ara_pkg::*; import rvv_pkg::*; #(
     if (vinsn_issue_valid &&
         axi_addrgen_req_valid_i && !axi_addrgen_req_i.is_load
      && !axi_addrgen_req_i.is_exception && axi_w_ready_i) begin : issue_valid
-      // Bytes valid in the current W beat
-      automatic shortint unsigned lower_byte = beat_lower_byte(axi_addrgen_req_i.addr,
-        axi_addrgen_req_i.size, axi_addrgen_req_i.len, BURST_INCR, AxiDataWidth/8, axi_len_q);
-      automatic shortint unsigned upper_byte = beat_upper_byte(axi_addrgen_req_i.addr,
-        axi_addrgen_req_i.size, axi_addrgen_req_i.len, BURST_INCR, AxiDataWidth/8, axi_len_q);
-
       // For non-zero vstart values, the last operand read is not going to involve all the lanes
       automatic logic [NrLanes-1:0] mask_valid;
 
@@ -312,8 +361,8 @@ module vstu import ara_pkg::*; import rvv_pkg::*; #(
       vrf_valid_bytes   = (NrLanes * DataWidthB) - vrf_pnt_q;
       // How many bytes are valid in this instruction
       vinsn_valid_bytes = issue_cnt_bytes_q - vrf_cnt_q;
-      // How many bytes are valid in this AXI word
-      axi_valid_bytes   = upper_byte - lower_byte + 1;
+      // How many bytes are valid in this AXI word, and not yet filled
+      axi_valid_bytes   = beat_valid_bytes - w_beat_bytes_q;
 
       valid_bytes = (issue_cnt_bytes_q < (NrLanes * DataWidthB)) ? vinsn_valid_bytes : vrf_valid_bytes;
       valid_bytes = (valid_bytes       < axi_valid_bytes       ) ? valid_bytes       : axi_valid_bytes;
@@ -323,47 +372,109 @@ module vstu import ara_pkg::*; import rvv_pkg::*; #(
       mask_valid = mask_valid_q;
 
       // Wait for all expected operands from the lanes
-      if (&stu_operand_valid && (vinsn_issue_q.vm || (|mask_valid_q))) begin : operands_ready
+      if (&stu_operand_valid && (!issue_segment || (seg_fill_q == vinsn_issue_q.nf)) &&
+          (vinsn_issue_q.vm || (|mask_valid_q))) begin : operands_ready
         vrf_pnt_d = vrf_pnt_q + valid_bytes;
         vrf_cnt_d = vrf_cnt_q + valid_bytes;
 
         // Copy data from the operands into the W channel
         for (int unsigned axi_byte = 0; axi_byte < AxiDataWidth/8; axi_byte++) begin : stu_operand_to_axi_w
           // Is this byte a valid byte in the W beat?
-          if (axi_byte >= lower_byte && axi_byte <= upper_byte) begin
-            // Map axy_byte to the corresponding byte in the VRF word (sequential)
-            vrf_seq_byte = axi_byte - lower_byte + vrf_pnt_q;
-            // Follow the vrf_seq_byte, but without the vstart information
-            vrf_seq_byte_cnt = axi_byte - lower_byte + vrf_cnt_q;
-            // And then shuffle it
-            vrf_byte     = shuffle_index(vrf_seq_byte, NrLanes, vinsn_issue_q.old_eew_vs1);
-
-            // Is this byte a valid byte in the VRF word?
-            if (vrf_seq_byte_cnt < issue_cnt_bytes_q) begin
-              // At which lane, and what is the byte offset in that lane, of the byte vrf_byte?
-              automatic int unsigned vrf_offset = vrf_byte[2:0];
-              // automatic logic [$clog2(NrLanes)-1:0] vrf_lane = (vrf_byte >> 3) + vinsn_issue_q.vstart[idx_width(NrLanes)-1:0];
-              automatic int unsigned vrf_lane = (vrf_byte >> 3);
-
-              // Copy data
-              axi_w_o.data[8*axi_byte +: 8] = stu_operand[vrf_lane][8*vrf_offset +: 8];
-              axi_w_o.strb[axi_byte]        = vinsn_issue_q.vm || mask_q[vrf_lane][vrf_offset];
-            end
+          if (beat_byte_valid[axi_byte]) begin
+            if (beat_byte_idx[axi_byte] < w_beat_bytes_q) begin : buffered_byte
+              // This byte was taken from a previous VRF word
+              axi_w_o.data[8*axi_byte +: 8] = w_beat_q.data[8*axi_byte +: 8];
+              axi_w_o.strb[axi_byte]        = w_beat_q.strb[axi_byte];
+            end : buffered_byte else if (!issue_segment) begin : vrf_word_byte
+              // Map axy_byte to the corresponding byte in the VRF word (sequential)
+              vrf_seq_byte = beat_byte_idx[axi_byte] - w_beat_bytes_q + vrf_pnt_q;
+              // Follow the vrf_seq_byte, but without the vstart information
+              vrf_seq_byte_cnt = beat_byte_idx[axi_byte] - w_beat_bytes_q + vrf_cnt_q;
+              // And then shuffle it
+              vrf_byte     = shuffle_index(vrf_seq_byte, NrLanes, vinsn_issue_q.old_eew_vs1);
+
+              // Is this byte a valid byte in the VRF word?
+              if (vrf_seq_byte < NrLanes * DataWidthB && vrf_seq_byte_cnt < issue_cnt_bytes_q) begin
+                // At which lane, and what is the byte offset in that lane, of the byte vrf_byte?
+                automatic int unsigned vrf_offset = vrf_byte[2:0];
+                // automatic logic [$clog2(NrLanes)-1:0] vrf_lane = (vrf_byte >> 3) + vinsn_issue_q.vstart[idx_width(NrLanes)-1:0];
+                automatic int unsigned vrf_lane = (vrf_byte >> 3);
+
+                // Copy data
+                axi_w_o.data[8*axi_byte +: 8] = stu_operand[vrf_lane][8*vrf_offset +: 8];
+                axi_w_o.strb[axi_byte]        = vinsn_issue_q.vm || mask_q[vrf_lane][vrf_offset];
+              end
+            end : vrf_word_byte
           end
         end : stu_operand_to_axi_w
 
-        // Send the W beat
-        axi_w_valid_o = 1'b1;
-        // Account for the beat we sent
-        axi_len_d     = axi_len_q + 1;
-        // We wrote all the beats for this AW burst
-        if ($unsigned(axi_len_d) == axi_pkg::len_t'($unsigned(axi_addrgen_req_i.len) + 1)) begin : beats_complete
-          axi_w_o.last            = 1'b1;
-          // Ask for another burst by the address generator
-          axi_addrgen_req_ready_o = 1'b1;
-          // Reset AXI pointers
-          axi_len_d                   = '0;
-        end : beats_complete
+        // Unit-stride segment stores: element i of field f comes from element i of the
+        // register group vs1 + f * EMUL. The VRF word pointers point to the current
+        // element, and go back to its first byte until all its fields are over.
+        if (issue_segment) begin : segment_interleave
+          automatic logic [idx_width(DataWidth*NrLanes/8):0] seg_pnt = vrf_pnt_q;
+          automatic logic [idx_width(DataWidth*NrLanes/8):0] seg_cnt = vrf_cnt_q;
+          automatic logic [2:0] seg_field = seg_field_q;
+
+          valid_bytes = '0;
+          for (int unsigned axi_byte = 0; axi_byte < AxiDataWidth/8; axi_byte++) begin : fields_to_axi_w
+            if (beat_byte_valid[axi_byte] && (beat_byte_idx[axi_byte] >= w_beat_bytes_q) &&
+                seg_pnt < (NrLanes * DataWidthB) && seg_cnt < issue_cnt_bytes_q) begin : is_field_byte
+              automatic int unsigned vrf_offset;
+              automatic int unsigned vrf_lane;
+
+              vrf_byte   = shuffle_index(seg_pnt, NrLanes, vinsn_issue_q.old_eew_vs1);
+              vrf_offset = vrf_byte[2:0];
+              vrf_lane   = (vrf_byte >> 3);
+
+              // The last field comes directly from the lanes
+              axi_w_o.data[8*axi_byte +: 8] = (seg_field == vinsn_issue_q.nf)
+                                            ? stu_operand[vrf_lane][8*vrf_offset +: 8]
+                                            : seg_word_q[seg_field][vrf_lane][8*vrf_offset +: 8];
+              axi_w_o.strb[axi_byte]        = vinsn_issue_q.vm || mask_q[vrf_lane][vrf_offset];
+
+              valid_bytes += 1;
+              seg_pnt     += 1;
+              seg_cnt     += 1;
+              // Last byte of the element of this field
+              if ((seg_pnt & ((1 << vinsn_issue_q.vtype.vsew) - 1)) == '0) begin
+                if (seg_field == vinsn_issue_q.nf) begin
+                  seg_field = '0;
+                end else begin
+                  seg_field += 1;
+                  seg_pnt   -= (1 << vinsn_issue_q.vtype.vsew);
+                  seg_cnt   -= (1 << vinsn_issue_q.vtype.vsew);
+                end
+              end
+            end : is_field_byte
+          end : fields_to_axi_w
+
+          vrf_pnt_d   = seg_pnt;
+          vrf_cnt_d   = seg_cnt;
+          seg_field_d = seg_field;
+        end : segment_interleave
+
+        // Send the beat once it is full, or if the vector is over
+        if ((w_beat_bytes_q + valid_bytes == beat_valid_bytes) || (vrf_cnt_d == issue_cnt_bytes_q)) begin : beat_ready
+          w_beat_bytes_d = '0;
+
+          // Send the W beat
+          axi_w_valid_o = 1'b1;
+          // Account for the beat we sent
+          axi_len_d     = axi_len_q + 1;
+          // We wrote all the beats for this AW burst
+          if ($unsigned(axi_len_d) == axi_pkg::len_t'($unsigned(axi_addrgen_req_i.len) + 1)) begin : beats_complete
+            axi_w_o.last            = 1'b1;
+            // Ask for another burst by the address generator
+            axi_addrgen_req_ready_o = 1'b1;
+            // Reset AXI pointers
+            axi_len_d                   = '0;
+          end : beats_complete
+        end : beat_ready else begin : beat_partial
+          // The rest of the beat comes from the next VRF word
+          w_beat_d       = axi_w_o;
+          w_beat_bytes_d = w_beat_bytes_q + valid_bytes;
+        end : beat_partial
 
         // We consumed a whole word from the lanes
         if (vrf_pnt_d == NrLanes*8 || vrf_cnt_d == issue_cnt_bytes_q) begin : vrf_word_done
@@ -374,6 +485,8 @@ module vstu import ara_pkg::*; import rvv_pkg::*; #(
           first_lane_payload_d = 1'b0;
           // Acknowledge the operands with the lanes
           stu_operand_ready = '1;
+          // The buffered fields were consumed as well
+          seg_fill_d        = '0;
           // Acknowledge the mask operand
           mask_ready_d      = !vinsn_issue_q.vm;
           // Account for the results that were issued
@@ -415,6 +528,7 @@ module vstu import ara_pkg::*; import rvv_pkg::*; #(
         first_payload_byte_d = (NrLanes * DataWidthB) - vrf_word_start_byte[$clog2(8*NrLanes)-1:0];
         // The next payload will be the first one for this store
         first_lane_payload_d = 1'b1;
+        seg_field_d          = '0;
       end : issue_cnt_bytes_update
     end : axi_w_beat_finish
 
@@ -467,6 +581,10 @@ module vstu import ara_pkg::*; import rvv_pkg::*; #(
       axi_addrgen_req_ready_o = axi_addrgen_req_valid_i;
       // Reset AXI pointers
       axi_len_d = '0;
+      // Drop the partial beat and the buffered fields
+      w_beat_bytes_d = '0;
+      seg_fill_d     = '0;
+      seg_field_d    = '0;
 
       // Abort the main sequencer -> operand-req request
       stu_current_burst_exception_d = 1'b1;
@@ -510,6 +628,7 @@ module vstu import ara_pkg::*; import rvv_pkg::*; #(
         first_payload_byte_d = (NrLanes * DataWidthB) - vrf_word_start_byte[$clog2(8*NrLanes)-1:0];
         // The next payload will be the first one for this store
         first_lane_payload_d = 1'b1;
+        seg_field_d          = '0;
       end
 
       // Bump pointers and counters of the vector instruction queue
@@ -534,6 +653,12 @@ module vstu import ara_pkg::*; import rvv_pkg::*; #(
 
       vrf_cnt_q <= '0;
 
+      w_beat_q       <= '0;
+      w_beat_bytes_q <= '0;
+
+      seg_fill_q  <= '0;
+      seg_field_q <= '0;
+
       lsu_ex_flush_q <= 1'b0;
 
       stu_current_burst_exception_o <= 1'b0;
@@ -551,10 +676,21 @@ module vstu import ara_pkg::*; import rvv_pkg::*; #(
 
       vrf_cnt_q <= vrf_cnt_d;
 
+      w_beat_q       <= w_beat_d;
+      w_beat_bytes_q <= w_beat_bytes_d;
+
+      seg_fill_q  <= seg_fill_d;
+      seg_field_q <= seg_field_d;
+
       lsu_ex_flush_q <= lsu_ex_flush_i;
 
       stu_current_burst_exception_o <= stu_current_burst_exception_d;
     end
   end
 
+  // The buffered fields are only read once they are all valid
+  always_ff @(posedge clk_i) begin
+    seg_word_q <= seg_word_d;
+  end
+
 endmodule : vstu
@@ -12,7 +12,9 @@ module ara_tb_verilator #(
   )(
     input  logic        clk_i,
     input  logic        rst_ni,
-    output logic [63:0] exit_o
+    output logic [63:0] exit_o,
+    output logic [63:0] event_trigger_o,
+    output logic [63:0] hw_cycles_o
   );
 
   /*****************
@@ -37,6 +39,46 @@ module ara_tb_verilator #(
     .exit_o(exit_o)
   );
 
+  // Expose the event trigger register to the C++ simulation controller
+  assign event_trigger_o = dut.i_ara_soc.i_ctrl_registers.event_trigger_o;
+  assign hw_cycles_o     = dut.runtime_buf_q;
+
+  /*********************
+   *  Pipeline probes  *
+   *********************/
+
+  // Follow every vector instruction through the sequencer. These signals are
+  // public (see waiver.vlt) and are read by the Konata pipeline tracer
+  // (verilator/ara_konata.cpp).
+
+  localparam int unsigned NrPEs = NrLanes + 4;
+
+  logic [7:0]                             probe_nr_pes;
+  logic [7:0]                             probe_nr_vinsn;
+  logic                                   probe_req_valid;
+  logic                                   probe_req_ready;
+  logic [7:0]                             probe_req_op;
+  logic [4:0]                             probe_req_vd;
+  logic [31:0]                            probe_req_vl;
+  logic [NrPEs-1:0][ara_pkg::NrVInsn-1:0] probe_pe_running;
+  logic                                   probe_pe_req_valid;
+  logic [7:0]                             probe_pe_req_id;
+  logic [NrPEs-1:0]                       probe_pe_req_ready;
+
+  assign probe_nr_pes       = NrPEs;
+  assign probe_nr_vinsn     = ara_pkg::NrVInsn;
+  // Instructions from the dispatcher
+  assign probe_req_valid    = dut.i_ara_soc.i_system.i_ara.i_sequencer.ara_req_valid_i;
+  assign probe_req_ready    = dut.i_ara_soc.i_system.i_ara.i_sequencer.ara_req_ready_o;
+  assign probe_req_op       = dut.i_ara_soc.i_system.i_ara.i_sequencer.ara_req_i.op;
+  assign probe_req_vd       = dut.i_ara_soc.i_system.i_ara.i_sequencer.ara_req_i.vd;
+  assign probe_req_vl       = dut.i_ara_soc.i_system.i_ara.i_sequencer.ara_req_i.vl;
+  // Issue to the processing elements
+  assign probe_pe_running   = dut.i_ara_soc.i_system.i_ara.i_sequencer.pe_vinsn_running_q;
+  assign probe_pe_req_valid = dut.i_ara_soc.i_system.i_ara.i_sequencer.pe_req_valid_o;
+  assign probe_pe_req_id    = dut.i_ara_soc.i_system.i_ara.i_sequencer.pe_req_o.id;
+  assign probe_pe_req_ready = dut.i_ara_soc.i_system.i_ara.i_sequencer.pe_req_ready_i;
+
   /*********
    *  EOC  *
    *********/
@@ -44,6 +44,18 @@ module ara_testharness #(
   `AXI_TYPEDEF_REQ_T(axi_req_t, aw_chan_t, w_chan_t, ar_chan_t)
   `AXI_TYPEDEF_RESP_T(axi_resp_t, b_chan_t, r_chan_t)
 
+  // Last-level cache in front of the L2 memory, see ara_soc.sv
+`ifdef LLC_BYTES
+  localparam int unsigned LlcNumBytes = `LLC_BYTES;
+`else
+  localparam int unsigned LlcNumBytes = 0;
+`endif
+`ifdef LLC_WAYS
+  localparam int unsigned LlcNumWays = `LLC_WAYS;
+`else
+  localparam int unsigned LlcNumWays = 4;
+`endif
+
   /*************
    *  Signals  *
    *************/
@@ -73,7 +85,9 @@ module ara_testharness #(
     .AxiDataWidth(AxiDataWidth ),
     .AxiIdWidth  (AxiIdWidth   ),
     .AxiUserWidth(AxiUserWidth ),
-    .AxiRespDelay(AxiRespDelay )
+    .AxiRespDelay(AxiRespDelay ),
+    .LlcNumBytes (LlcNumBytes  ),
+    .LlcNumWays  (LlcNumWays   )
   ) i_ara_soc (
     .clk_i         (clk_i       ),
     .rst_ni        (rst_ni      ),
@@ -279,6 +293,215 @@ module ara_testharness #(
 
 `endif
 
+  /*******************
+   *  ARA STALL CNT  *
+   *******************/
+
+  // Top-down classification of the V runtime. From the point of view of the sequencer, every
+  // cycle falls in exactly one of the following buckets:
+  //   - issue:          the sequencer accepted a request from the dispatcher
+  //   - seq-full:       the request waits since all the NrVInsn instruction slots are taken
+  //   - seq-desynch:    the request waits for the lanes to get in sync
+  //   - seq-other:      the request waits for other reasons (hazards, busy PEs)
+  //   - disp-wait-idle: no request, the dispatcher waits for Ara to be idle (e.g., CSR)
+  //   - disp-reshuffle: no request, the dispatcher is injecting a reshuffle
+  //   - frontend:       no request from CVA6
+  // The following events are counted independently, and can overlap with each other:
+  //   - opreq-stall:    an operand requester of any lane is stalled by a hazard
+  //   - vrf-conflict:   a VRF bank request of any lane lost the arbitration
+  //   - vlsu-r-wait:    the VLDU waits for an R beat of the current burst
+  //   - vlsu-w-wait:    the VSTU waits for the memory to accept a W beat
+  //   - fpu-lat-stall:  the FPU of any lane stalls to execute in-order
+
+  typedef enum int unsigned {
+    StallIssue,
+    StallSeqFull,
+    StallSeqDesynch,
+    StallSeqOther,
+    StallDispWaitIdle,
+    StallDispReshuffle,
+    StallFrontend,
+    StallOpReq,
+    StallVrfConflict,
+    StallVlsuRWait,
+    StallVlsuWWait,
+    StallFpuLatency,
+    NrStallCnt
+  } stall_cnt_e;
+
+  logic [NrStallCnt-1:0]       stall_event;
+  logic [NrStallCnt-1:0][63:0] stall_cnt_d, stall_cnt_q;
+  logic [NrStallCnt-1:0][63:0] stall_buf_d, stall_buf_q;
+
+  // States of the dispatcher (see ara_dispatcher::state_e)
+  localparam logic [1:0] DispWaitIdle      = 2'd1;
+  localparam logic [1:0] DispWaitIdleFlush = 2'd2;
+  localparam logic [1:0] DispReshuffle     = 2'd3;
+
+  logic       seq_req_valid, seq_req_ready;
+  logic [1:0] disp_state;
+
+  assign seq_req_valid = i_ara_soc.i_system.i_ara.i_sequencer.ara_req_valid_i;
+  assign seq_req_ready = i_ara_soc.i_system.i_ara.i_sequencer.ara_req_ready_o;
+  assign disp_state    = i_ara_soc.i_system.i_ara.i_dispatcher.state_q;
+
+  always_comb begin
+    stall_event = '0;
+
+    // Top-down buckets
+    if (seq_req_valid && seq_req_ready)
+      stall_event[StallIssue] = 1'b1;
+    else if (seq_req_valid && i_ara_soc.i_system.i_ara.i_sequencer.vinsn_running_full)
+      stall_event[StallSeqFull] = 1'b1;
+    else if (seq_req_valid && i_ara_soc.i_system.i_ara.i_sequencer.stall_lanes_desynch)
+      stall_event[StallSeqDesynch] = 1'b1;
+    else if (seq_req_valid)
+      stall_event[StallSeqOther] = 1'b1;
+    else if (disp_state == DispWaitIdle || disp_state == DispWaitIdleFlush)
+      stall_event[StallDispWaitIdle] = 1'b1;
+    else if (disp_state == DispReshuffle)
+      stall_event[StallDispReshuffle] = 1'b1;
+    else
+      stall_event[StallFrontend] = 1'b1;
+
+    // Independent events
+    stall_event[StallOpReq]       = |i_ara_soc.i_system.i_ara.lane_hazard_stall;
+    stall_event[StallVrfConflict] = |i_ara_soc.i_system.i_ara.lane_vrf_conflict;
+    stall_event[StallVlsuRWait]   = i_ara_soc.i_system.i_ara.i_vlsu.i_vldu.axi_addrgen_req_valid_i &&
+                                    i_ara_soc.i_system.i_ara.i_vlsu.i_vldu.axi_addrgen_req_i.is_load &&
+                                   !i_ara_soc.i_system.i_ara.i_vlsu.i_vldu.axi_r_valid_i;
+    stall_event[StallVlsuWWait]   = i_ara_soc.i_system.i_ara.i_vlsu.i_vstu.axi_addrgen_req_valid_i &&
+                                   !i_ara_soc.i_system.i_ara.i_vlsu.i_vstu.axi_addrgen_req_i.is_load &&
+                                   !i_ara_soc.i_system.i_ara.i_vlsu.i_vstu.axi_w_ready_i;
+    stall_event[StallFpuLatency]  = |i_ara_soc.i_system.i_ara.lane_fpu_latency_stall;
+  end
+
+  always_comb begin
+    stall_cnt_d = stall_cnt_q;
+    stall_buf_d = stall_buf_q;
+
+    for (int unsigned i = 0; i < NrStallCnt; i++)
+      if (runtime_cnt_en_q && stall_event[i]) stall_cnt_d[i] = stall_cnt_q[i] + 1;
+
+    // Update the buffers together with the runtime
+    if (runtime_to_be_updated_q           &&
+        i_ara_soc.i_system.i_ara.ara_idle &&
+        !i_ara_soc.i_system.i_ara.acc_req_i.acc_req.req_valid) begin
+      stall_buf_d = stall_cnt_q;
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      stall_cnt_q <= '0;
+      stall_buf_q <= '0;
+    end else begin
+      stall_cnt_q <= stall_cnt_d;
+      stall_buf_q <= stall_buf_d;
+    end
+  end
+
+  // Print the counters at the end of a successful run, next to the [hw-cycles]. They are
+  // printed once per run, and cleared by the reset, e.g., between the images of a batch.
+  logic stall_printed_q;
+
+  always @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      stall_printed_q <= 1'b0;
+    end else if (exit_o[0] && !stall_printed_q) begin
+      stall_printed_q <= 1'b1;
+      if (!(exit_o >> 1)) begin
+        $display("[ara-stall-issue]: %d", stall_buf_q[StallIssue]);
+        $display("[ara-stall-seq-full]: %d", stall_buf_q[StallSeqFull]);
+        $display("[ara-stall-seq-desynch]: %d", stall_buf_q[StallSeqDesynch]);
+        $display("[ara-stall-seq-other]: %d", stall_buf_q[StallSeqOther]);
+        $display("[ara-stall-disp-wait-idle]: %d", stall_buf_q[StallDispWaitIdle]);
+        $display("[ara-stall-disp-reshuffle]: %d", stall_buf_q[StallDispReshuffle]);
+        $display("[ara-stall-frontend]: %d", stall_buf_q[StallFrontend]);
+        $display("[ara-stall-opreq-stall]: %d", stall_buf_q[StallOpReq]);
+        $display("[ara-stall-vrf-conflict]: %d", stall_buf_q[StallVrfConflict]);
+        $display("[ara-stall-vlsu-r-wait]: %d", stall_buf_q[StallVlsuRWait]);
+        $display("[ara-stall-vlsu-w-wait]: %d", stall_buf_q[StallVlsuWWait]);
+        $display("[ara-stall-fpu-lat-stall]: %d", stall_buf_q[StallFpuLatency]);
+      end
+    end
+  end
+
+  /***********************
+   *  ARA IN-FLIGHT CNT  *
+   ***********************/
+
+  // Cycles of the V runtime in which each VFU has at least one instruction in flight,
+  // from the point of view of the sequencer. They count the occupancy of the units, not
+  // their busy cycles: an instruction waiting for its operands is in flight too. Together
+  // with the issue count, they give the IPC for a given instruction window (NrVInsn).
+  // The instructions whose destination was renamed to a spare register copy are counted too.
+
+  logic [ara_pkg::NrVFUs-1:0]       inflight_event;
+  logic [ara_pkg::NrVFUs-1:0][63:0] inflight_cnt_d, inflight_cnt_q;
+  logic [ara_pkg::NrVFUs-1:0][63:0] inflight_buf_d, inflight_buf_q;
+  logic                             rename_event;
+  logic                      [63:0] rename_cnt_d, rename_cnt_q;
+  logic                      [63:0] rename_buf_d, rename_buf_q;
+
+  assign inflight_event = i_ara_soc.i_system.i_ara.i_sequencer.perf_vfu_active_o;
+  assign rename_event   = i_ara_soc.i_system.i_ara.i_sequencer.vreg_issue &&
+                          i_ara_soc.i_system.i_ara.i_sequencer.vd_rename;
+
+  always_comb begin
+    inflight_cnt_d = inflight_cnt_q;
+    inflight_buf_d = inflight_buf_q;
+    rename_cnt_d   = rename_cnt_q;
+    rename_buf_d   = rename_buf_q;
+
+    for (int unsigned i = 0; i < ara_pkg::NrVFUs; i++)
+      if (runtime_cnt_en_q && inflight_event[i]) inflight_cnt_d[i] = inflight_cnt_q[i] + 1;
+    if (runtime_cnt_en_q && rename_event) rename_cnt_d = rename_cnt_q + 1;
+
+    // Update the buffers together with the runtime
+    if (runtime_to_be_updated_q           &&
+        i_ara_soc.i_system.i_ara.ara_idle &&
+        !i_ara_soc.i_system.i_ara.acc_req_i.acc_req.req_valid) begin
+      inflight_buf_d = inflight_cnt_q;
+      rename_buf_d   = rename_cnt_q;
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      inflight_cnt_q <= '0;
+      inflight_buf_q <= '0;
+      rename_cnt_q   <= '0;
+      rename_buf_q   <= '0;
+    end else begin
+      inflight_cnt_q <= inflight_cnt_d;
+      inflight_buf_q <= inflight_buf_d;
+      rename_cnt_q   <= rename_cnt_d;
+      rename_buf_q   <= rename_buf_d;
+    end
+  end
+
+  // Print the counters at the end of a successful run, together with the stall counters
+  logic inflight_printed_q;
+
+  always @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      inflight_printed_q <= 1'b0;
+    end else if (exit_o[0] && !inflight_printed_q) begin
+      inflight_printed_q <= 1'b1;
+      if (!(exit_o >> 1)) begin
+        $display("[ara-nr-vinsn]: %d", ara_pkg::NrVInsn);
+        $display("[ara-inflight-alu]: %d", inflight_buf_q[ara_pkg::VFU_Alu]);
+        $display("[ara-inflight-mfpu]: %d", inflight_buf_q[ara_pkg::VFU_MFpu]);
+        $display("[ara-inflight-sldu]: %d", inflight_buf_q[ara_pkg::VFU_SlideUnit]);
+        $display("[ara-inflight-masku]: %d", inflight_buf_q[ara_pkg::VFU_MaskUnit]);
+        $display("[ara-inflight-vldu]: %d", inflight_buf_q[ara_pkg::VFU_LoadUnit]);
+        $display("[ara-inflight-vstu]: %d", inflight_buf_q[ara_pkg::VFU_StoreUnit]);
+        $display("[ara-nr-renamed]: %d", rename_buf_q);
+      end
+    end
+  end
+
 
 `endif
 endmodule : ara_testharness
@@ -0,0 +1,134 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Timing model of a banked DRAM, used by dram_timing_model.sv through DPI.
+// The model only computes when the data of each AXI burst is available; the
+// data itself is still held by the L2 memory of the SoC.
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <svdpi.h>
+#include <vector>
+
+namespace {
+
+struct DramBank {
+  bool row_open;
+  uint64_t open_row;
+  uint64_t busy_until;
+};
+
+struct DramConfig {
+  // Fixed controller and PHY latency [cycles]
+  uint32_t latency;
+  // Sustained bandwidth of the data bus [bytes/cycle]
+  uint32_t bytes_per_cycle;
+  uint32_t num_banks;
+  uint32_t row_bytes;
+  // Access time for a row-buffer hit/miss [cycles]
+  uint32_t row_hit_cycles;
+  uint32_t row_miss_cycles;
+};
+
+struct DramStats {
+  uint64_t reads;
+  uint64_t writes;
+  uint64_t bytes;
+  uint64_t row_hits;
+  uint64_t row_misses;
+  uint64_t total_latency;
+};
+
+DramConfig cfg;
+DramStats stats;
+std::vector<DramBank> banks;
+// The data bus is shared among all the banks
+uint64_t bus_busy_until;
+
+}  // namespace
+
+extern "C" {
+
+void dram_model_init(int latency, int bytes_per_cycle, int num_banks,
+                     int row_bytes, int row_hit_cycles, int row_miss_cycles) {
+  cfg.latency = latency;
+  cfg.bytes_per_cycle = std::max(bytes_per_cycle, 1);
+  cfg.num_banks = std::max(num_banks, 1);
+  cfg.row_bytes = std::max(row_bytes, 1);
+  cfg.row_hit_cycles = row_hit_cycles;
+  cfg.row_miss_cycles = row_miss_cycles;
+
+  banks.assign(cfg.num_banks, DramBank{false, 0, 0});
+  bus_busy_until = 0;
+  stats = DramStats{};
+
+  std::cout << "[dram-model] latency: " << cfg.latency
+            << ", bandwidth: " << cfg.bytes_per_cycle
+            << " B/cycle, banks: " << cfg.num_banks
+            << ", row size: " << cfg.row_bytes
+            << " B, row hit/miss: " << cfg.row_hit_cycles << "/"
+            << cfg.row_miss_cycles << " cycles" << std::endl;
+}
+
+// Return 1 if the model was initialized, i.e., if dram_timing_model.sv is part
+// of the design. Its state is not part of the checkpoints of the model.
+int dram_model_in_use() { return !banks.empty(); }
+
+// Close all the rows and free the banks and the bus. The cycle counter of
+// dram_timing_model.sv restarts from zero at every reset, so the timestamps of
+// the previous run must not delay the accesses of the next one.
+void dram_model_reset() {
+  banks.assign(cfg.num_banks, DramBank{false, 0, 0});
+  bus_busy_until = 0;
+}
+
+// Schedule a burst of |bytes| bytes at |addr|, issued at cycle |now|.
+// Return the cycle in which the burst can be served by the L2 memory.
+long long dram_model_access(long long now, long long addr, int bytes,
+                            svBit is_write) {
+  uint64_t row = (uint64_t)addr / cfg.row_bytes;
+  DramBank &bank = banks[row % cfg.num_banks];
+  row /= cfg.num_banks;
+
+  // Wait for the bank, then open the row if needed
+  uint64_t start = std::max((uint64_t)now, bank.busy_until);
+  bool hit = bank.row_open && bank.open_row == row;
+  uint64_t ready =
+      start + (hit ? cfg.row_hit_cycles : cfg.row_miss_cycles) + cfg.latency;
+
+  // Serialize the data transfers on the bus
+  uint64_t transfer = (bytes + cfg.bytes_per_cycle - 1) / cfg.bytes_per_cycle;
+  uint64_t data_start = std::max(ready, bus_busy_until);
+  bus_busy_until = data_start + transfer;
+
+  bank.row_open = true;
+  bank.open_row = row;
+  bank.busy_until = data_start + transfer - cfg.latency;
+
+  if (is_write)
+    stats.writes++;
+  else
+    stats.reads++;
+  if (hit)
+    stats.row_hits++;
+  else
+    stats.row_misses++;
+  stats.bytes += bytes;
+  stats.total_latency += data_start - now;
+
+  return data_start;
+}
+
+void dram_model_report() {
+  uint64_t accesses = stats.reads + stats.writes;
+  std::cout << "[dram-model] reads: " << stats.reads
+            << ", writes: " << stats.writes << ", bytes: " << stats.bytes
+            << ", row hits: " << stats.row_hits
+            << ", row misses: " << stats.row_misses << ", avg latency: "
+            << (accesses ? (double)stats.total_latency / accesses : 0)
+            << " cycles" << std::endl;
+}
+}
@@ -0,0 +1,83 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Streaming reader of the vector traces replayed by the ideal dispatcher
+// (see accel_dispatcher_ideal.sv). The trace is read one record at a time,
+// so its length is not bound by the size of the model.
+//
+// A trace is a sequence of 20-byte little-endian records, each one holding
+// the 32-bit vector instruction and the 64-bit values of rs1 and rs2. The
+// file can be gzip-compressed, zlib reads plain files transparently.
+
+#include <cstdint>
+#include <iostream>
+#include <zlib.h>
+
+namespace {
+
+constexpr unsigned kRecordBytes = 4 + 8 + 8;
+
+gzFile vtrace = nullptr;
+uint64_t records = 0;
+
+uint64_t LoadLE(const unsigned char *buf, unsigned bytes) {
+  uint64_t value = 0;
+  for (unsigned i = 0; i < bytes; ++i) {
+    value |= (uint64_t)buf[i] << (8 * i);
+  }
+  return value;
+}
+
+}  // namespace
+
+extern "C" {
+
+// Open the trace at |path|. Return 0 on failure.
+int vtrace_open(const char *path) {
+  vtrace = gzopen(path, "rb");
+  if (!vtrace) {
+    std::cerr << "[vtrace] ERROR: Could not open `" << path << "'."
+              << std::endl;
+    return 0;
+  }
+  gzbuffer(vtrace, 1 << 20);
+  records = 0;
+  std::cout << "[vtrace] Streaming the vector instructions from " << path
+            << std::endl;
+  return 1;
+}
+
+// Return 1 if a trace was opened. Its position is not part of the checkpoints
+// of the model.
+int vtrace_in_use() { return vtrace != nullptr || records != 0; }
+
+// Fetch the next record of the trace. Return 0 once the trace is over.
+int vtrace_next(int *insn, long long *rs1, long long *rs2) {
+  unsigned char buf[kRecordBytes];
+
+  if (!vtrace) {
+    return 0;
+  }
+
+  int bytes = gzread(vtrace, buf, kRecordBytes);
+  if (bytes != (int)kRecordBytes) {
+    if (bytes != 0) {
+      std::cerr << "[vtrace] ERROR: Truncated record after " << records
+                << " instructions." << std::endl;
+    }
+    std::cout << "[vtrace] " << records << " vector instructions read"
+              << std::endl;
+    gzclose(vtrace);
+    vtrace = nullptr;
+    return 0;
+  }
+
+  *insn = (int)LoadLE(buf, 4);
+  *rs1 = (long long)LoadLE(buf + 4, 8);
+  *rs2 = (long long)LoadLE(buf + 12, 8);
+  records++;
+  return 1;
+}
+}
@@ -0,0 +1,173 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description: AXI timing model of a DRAM, for simulation only.
+//              Every AR/AW burst is scheduled by a banked DRAM model (see
+//              tb/dpi/dram_model.cc), and only forwarded to the memory once
+//              its data is available. The defaults can be overridden at
+//              runtime with the +dram_latency, +dram_bw, +dram_banks,
+//              +dram_row_bytes, +dram_row_hit, +dram_row_miss and
+//              +dram_max_txns plusargs.
+//              Read bursts with different AXI IDs are released as soon as
+//              they are served, possibly out of order. Write bursts and read
+//              bursts with the same ID keep their order.
+
+import "DPI-C" function void dram_model_init(input int latency, input int bytes_per_cycle,
+  input int num_banks, input int row_bytes, input int row_hit_cycles, input int row_miss_cycles);
+import "DPI-C" function longint dram_model_access(input longint now, input longint addr,
+  input int bytes, input bit is_write);
+import "DPI-C" function void dram_model_reset();
+import "DPI-C" function void dram_model_report();
+
+module dram_timing_model #(
+    // Default timing parameters
+    parameter int unsigned Latency       = 50,
+    parameter int unsigned BytesPerCycle = 8,
+    parameter int unsigned NumBanks      = 8,
+    parameter int unsigned RowBytes      = 2048,
+    parameter int unsigned RowHitCycles  = 10,
+    parameter int unsigned RowMissCycles = 30,
+    // Maximum number of outstanding read and write transactions
+    parameter int unsigned MaxTxns       = 8,
+    // AXI types
+    parameter type         axi_ar_t      = logic,
+    parameter type         axi_aw_t      = logic,
+    parameter type         axi_req_t     = logic,
+    parameter type         axi_resp_t    = logic
+  ) (
+    input  logic      clk_i,
+    input  logic      rst_ni,
+    // Towards the interconnect
+    input  axi_req_t  slv_req_i,
+    output axi_resp_t slv_resp_o,
+    // Towards the memory
+    output axi_req_t  mst_req_o,
+    input  axi_resp_t mst_resp_i
+  );
+
+  /////////////////////
+  //  Configuration  //
+  /////////////////////
+
+  int unsigned max_txns;
+
+  initial begin
+    int unsigned latency, bytes_per_cycle, num_banks, row_bytes, row_hit, row_miss;
+
+    if (!$value$plusargs("dram_latency=%d", latency)) latency = Latency;
+    if (!$value$plusargs("dram_bw=%d", bytes_per_cycle)) bytes_per_cycle = BytesPerCycle;
+    if (!$value$plusargs("dram_banks=%d", num_banks)) num_banks = NumBanks;
+    if (!$value$plusargs("dram_row_bytes=%d", row_bytes)) row_bytes = RowBytes;
+    if (!$value$plusargs("dram_row_hit=%d", row_hit)) row_hit = RowHitCycles;
+    if (!$value$plusargs("dram_row_miss=%d", row_miss)) row_miss = RowMissCycles;
+    if (!$value$plusargs("dram_max_txns=%d", max_txns)) max_txns = MaxTxns;
+
+    dram_model_init(latency, bytes_per_cycle, num_banks, row_bytes, row_hit, row_miss);
+  end
+
+  final begin
+    dram_model_report();
+  end
+
+  //////////////////
+  //  Scheduling  //
+  //////////////////
+
+  // Bursts waiting for the DRAM, with the cycle in which they can be served
+  axi_ar_t ar_q       [$];
+  longint  ar_ready_q [$];
+  axi_aw_t aw_q       [$];
+  longint  aw_ready_q [$];
+
+  // Read burst released to the memory, locked until the handshake
+  int   ar_sel, ar_sel_q;
+  logic ar_locked_q;
+
+  longint      cycle_q;
+  // Transactions accepted from the interconnect and not yet responded
+  int unsigned rd_txns_q, wr_txns_q;
+
+  logic slv_ar_hs, slv_aw_hs, mst_ar_hs, mst_aw_hs, r_last_hs, b_hs;
+
+  // Oldest read burst served by the DRAM, with no older burst with the same ID. -1 if none.
+  function automatic int ready_ar(longint cycle);
+    ready_ar = -1;
+    for (int i = 0; i < ar_q.size(); i++) begin
+      automatic logic same_id = 1'b0;
+      for (int j = 0; j < i; j++)
+        if (ar_q[j].id == ar_q[i].id) same_id = 1'b1;
+      if (ar_ready_q[i] <= cycle && !same_id) return i;
+    end
+  endfunction : ready_ar
+
+  always_comb begin
+    // By default, pass everything through
+    mst_req_o  = slv_req_i;
+    slv_resp_o = mst_resp_i;
+
+    // Accept new bursts only below the outstanding transaction limit
+    slv_resp_o.ar_ready = rd_txns_q < max_txns;
+    slv_resp_o.aw_ready = wr_txns_q < max_txns;
+
+    // Release a read burst once the DRAM served it
+    ar_sel             = ar_locked_q ? ar_sel_q : ready_ar(cycle_q);
+    mst_req_o.ar_valid = ar_sel >= 0;
+    mst_req_o.ar       = ar_sel >= 0 ? ar_q[ar_sel] : '0;
+    // Release the oldest write burst once the DRAM served it
+    mst_req_o.aw_valid = (aw_q.size() != 0) && (aw_ready_q[0] <= cycle_q);
+    mst_req_o.aw       = aw_q.size() != 0 ? aw_q[0] : '0;
+  end
+
+  assign slv_ar_hs = slv_req_i.ar_valid && slv_resp_o.ar_ready;
+  assign slv_aw_hs = slv_req_i.aw_valid && slv_resp_o.aw_ready;
+  assign mst_ar_hs = mst_req_o.ar_valid && mst_resp_i.ar_ready;
+  assign mst_aw_hs = mst_req_o.aw_valid && mst_resp_i.aw_ready;
+  assign r_last_hs = mst_resp_i.r_valid && slv_req_i.r_ready && mst_resp_i.r.last;
+  assign b_hs      = mst_resp_i.b_valid && slv_req_i.b_ready;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      cycle_q     <= '0;
+      ar_sel_q    <= '0;
+      ar_locked_q <= 1'b0;
+      rd_txns_q   <= '0;
+      wr_txns_q   <= '0;
+      ar_q.delete();
+      ar_ready_q.delete();
+      aw_q.delete();
+      aw_ready_q.delete();
+      // The cycle counter restarts, so do the timestamps of the DRAM model
+      dram_model_reset();
+    end else begin
+      cycle_q <= cycle_q + 1;
+
+      // Keep the AR payload stable until the handshake
+      ar_sel_q    <= ar_sel;
+      ar_locked_q <= mst_req_o.ar_valid && !mst_resp_i.ar_ready;
+      if (mst_ar_hs) begin
+        ar_q.delete(ar_sel);
+        ar_ready_q.delete(ar_sel);
+      end
+      if (mst_aw_hs) begin
+        void'(aw_q.pop_front());
+        void'(aw_ready_q.pop_front());
+      end
+
+      if (slv_ar_hs) begin
+        ar_q.push_back(slv_req_i.ar);
+        ar_ready_q.push_back(dram_model_access(cycle_q, longint'(slv_req_i.ar.addr),
+            (int'(slv_req_i.ar.len) + 1) << slv_req_i.ar.size, 1'b0));
+      end
+      if (slv_aw_hs) begin
+        aw_q.push_back(slv_req_i.aw);
+        aw_ready_q.push_back(dram_model_access(cycle_q, longint'(slv_req_i.aw.addr),
+            (int'(slv_req_i.aw.len) + 1) << slv_req_i.aw.size, 1'b1));
+      end
+
+      rd_txns_q <= rd_txns_q + slv_ar_hs - r_last_hs;
+      wr_txns_q <= wr_txns_q + slv_aw_hs - b_hs;
+    end
+  end
+
+endmodule : dram_timing_model
@@ -0,0 +1,88 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description: Multi-port memory of the L2, for the Verilator model only.
+//              It behaves like a tc_sram with a read latency of one cycle,
+//              but only its memory array is made public (see waiver.vlt),
+//              so that the memory images can be copied into it in bulk
+//              without exposing the arrays of every other tc_sram, e.g.,
+//              the VRF banks of the lanes.
+
+module l2_sram #(
+    parameter  int unsigned NumWords  = 1024,
+    parameter  int unsigned NumPorts  = 1,
+    parameter  int unsigned DataWidth = 128,
+    // Dependant parameters. DO NOT CHANGE!
+    localparam int unsigned AddrWidth = (NumWords > 1) ? $clog2(NumWords) : 1,
+    localparam int unsigned BeWidth   = DataWidth / 8,
+    localparam type         addr_t    = logic [AddrWidth-1:0],
+    localparam type         data_t    = logic [DataWidth-1:0],
+    localparam type         be_t      = logic [BeWidth-1:0]
+  ) (
+    input  logic                 clk_i,
+    input  logic                 rst_ni,
+    input  logic  [NumPorts-1:0] req_i,
+    input  logic  [NumPorts-1:0] we_i,
+    input  addr_t [NumPorts-1:0] addr_i,
+    input  data_t [NumPorts-1:0] wdata_i,
+    input  be_t   [NumPorts-1:0] be_i,
+    output data_t [NumPorts-1:0] rdata_o
+  );
+
+  data_t sram [NumWords-1:0];
+  addr_t [NumPorts-1:0] r_addr_q;
+
+  for (genvar p = 0; p < NumPorts; p++) begin: gen_port
+    // The ports are the banks of the L2, and never write the same word at the same time
+    for (genvar b = 0; b < BeWidth; b++) begin: gen_byte
+      always_ff @(posedge clk_i) begin
+        if (req_i[p] && we_i[p] && be_i[p][b])
+          sram[addr_i[p]][8*b +: 8] <= wdata_i[p][8*b +: 8];
+      end
+    end: gen_byte
+
+    always_ff @(posedge clk_i or negedge rst_ni) begin
+      if (!rst_ni) begin
+        r_addr_q[p] <= '0;
+      end else if (req_i[p] && !we_i[p]) begin
+        r_addr_q[p] <= addr_i[p];
+      end
+    end
+
+    assign rdata_o[p] = sram[r_addr_q[p]];
+  end: gen_port
+
+  //////////////////////
+  //  Memory loaders  //
+  //////////////////////
+
+  // Same interface as the loaders of tc_sram, see patches/0001-tech-cells-generic-sram.patch
+
+  export "DPI-C" task simutil_memload;
+
+  task simutil_memload;
+    input string file;
+    $readmemh(file, sram);
+  endtask
+
+  export "DPI-C" function simutil_set_mem;
+  function int simutil_set_mem(input int index, input bit [511:0] val);
+    if (DataWidth > 512 || index >= NumWords)
+      return 0;
+
+    sram[index] = val[DataWidth-1:0];
+    return 1;
+  endfunction
+
+  export "DPI-C" function simutil_get_mem;
+  function int simutil_get_mem(input int index, output bit [511:0] val);
+    if (DataWidth > 512 || index >= NumWords)
+      return 0;
+
+    val                = 0;
+    val[DataWidth-1:0] = sram[index];
+    return 1;
+  endfunction
+
+endmodule : l2_sram
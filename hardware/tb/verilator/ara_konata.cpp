@@ -0,0 +1,307 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Pipeline tracer for Ara, see ara_konata.h.
+//
+// Every instruction goes through three stages:
+// - Ds: dispatched, waiting for the sequencer (hazards, full instruction
+//       window, lanes out of sync)
+// - Is: issued, waiting for all its processing elements to accept it
+// - Ex: executing, until all its processing elements are done
+// The per-unit accept/done cycles are added to the instruction details.
+
+#include "ara_konata.h"
+
+#include <algorithm>
+#include <cstring>
+#include <getopt.h>
+#include <iostream>
+#include <sstream>
+#include <verilated.h>
+#include <verilated_syms.h>
+
+// Scope of the pipeline probes, see ara_tb_verilator.sv
+static const char *kProbeScope = "TOP.ara_tb_verilator";
+
+bool PublicSignal::Find(const VerilatedScope *scope, const char *name) {
+  VerilatedVar *var = scope->varFind(name);
+  if (!var) {
+    std::cerr << "ERROR: Could not find the public signal `" << name << "'."
+              << std::endl;
+    return false;
+  }
+  data_ = static_cast<const uint8_t *>(var->datap());
+  size_byte_ = var->totalSize();
+  return true;
+}
+
+uint64_t PublicSignal::Value() const {
+  uint64_t value = 0;
+  memcpy(&value, data_, std::min(size_byte_, sizeof(value)));
+  return value;
+}
+
+AraKonata::AraKonata()
+    : num_pes_(0),
+      num_vinsn_(0),
+      req_open_(false),
+      req_accepted_(false),
+      req_kid_(0),
+      cycle_written_(false),
+      last_cycle_(0),
+      next_kid_(0),
+      retired_(0) {}
+
+bool AraKonata::ParseCLIArguments(int argc, char **argv, bool &exit_app) {
+  const struct option long_options[] = {
+      {"konata", required_argument, nullptr, 'p'},
+      {"help", no_argument, nullptr, 'h'},
+      {nullptr, no_argument, nullptr, 0}};
+
+  // Reset the command parsing index in-case other utils have already parsed
+  // some arguments
+  optind = 1;
+  while (1) {
+    int c = getopt_long(argc, argv, ":h", long_options, nullptr);
+    if (c == -1) {
+      break;
+    }
+
+    // Disable error reporting by getopt
+    opterr = 0;
+
+    switch (c) {
+      case 'p':
+        konata_file_ = optarg;
+        break;
+      case 'h':
+        std::cout << "--konata=FILE\n"
+                     "  Write a pipeline trace of all the vector instructions "
+                     "to FILE,\n"
+                     "  to be opened with the Konata pipeline viewer\n\n";
+        return true;
+      default:;
+        // Ignore unrecognized options since they might be consumed by
+        // other utils
+    }
+  }
+  return true;
+}
+
+void AraKonata::PreExec() {
+  if (konata_file_.empty()) {
+    return;
+  }
+
+  const VerilatedScope *scope = Verilated::scopeFind(kProbeScope);
+  if (!scope) {
+    std::cerr << "ERROR: Could not find the scope `" << kProbeScope
+              << "', the pipeline trace is disabled." << std::endl;
+    konata_file_.clear();
+    return;
+  }
+  if (!nr_pes_.Find(scope, "probe_nr_pes") ||
+      !nr_vinsn_.Find(scope, "probe_nr_vinsn") ||
+      !req_valid_.Find(scope, "probe_req_valid") ||
+      !req_ready_.Find(scope, "probe_req_ready") ||
+      !req_op_.Find(scope, "probe_req_op") ||
+      !req_vd_.Find(scope, "probe_req_vd") ||
+      !req_vl_.Find(scope, "probe_req_vl") ||
+      !pe_running_.Find(scope, "probe_pe_running") ||
+      !pe_req_valid_.Find(scope, "probe_pe_req_valid") ||
+      !pe_req_id_.Find(scope, "probe_pe_req_id") ||
+      !pe_req_ready_.Find(scope, "probe_pe_req_ready")) {
+    std::cerr << "ERROR: The pipeline trace is disabled." << std::endl;
+    konata_file_.clear();
+    return;
+  }
+
+  konata_.open(konata_file_);
+  if (!konata_.is_open()) {
+    std::cerr << "ERROR: Could not open `" << konata_file_ << "'."
+              << std::endl;
+    konata_file_.clear();
+    return;
+  }
+  konata_ << "Kanata\t0004" << std::endl;
+}
+
+// The instructions in flight at the checkpoint are unknown to the tracer
+bool AraKonata::PostRestore() {
+  if (konata_file_.empty()) {
+    return true;
+  }
+  std::cerr << "ERROR: The pipeline trace cannot follow a restored simulation."
+            << std::endl;
+  return false;
+}
+
+void AraKonata::OnClock(unsigned long sim_time) {
+  if (konata_file_.empty()) {
+    return;
+  }
+
+  // The constant probes are only valid once the initial blocks ran
+  if (!num_pes_) {
+    num_pes_ = nr_pes_.Value();
+    num_vinsn_ = nr_vinsn_.Value();
+    if (!num_pes_) {
+      return;
+    }
+    int nr_lanes = num_pes_ - 4;
+    for (int l = 0; l < nr_lanes; ++l) {
+      pe_names_.push_back("lane" + std::to_string(l));
+    }
+    // Same order as ara_pkg::vfu_offset_e
+    pe_names_.insert(pe_names_.end(), {"vldu", "vstu", "masku", "sldu"});
+    vinsn_.assign(num_vinsn_, VInsn{false, 0, 0, {}, {}, false});
+    running_q_.assign(num_vinsn_, 0);
+  }
+
+  unsigned long cycle = sim_time / 2;
+
+  // Processing elements running each vid
+  std::vector<uint64_t> running(num_vinsn_, 0);
+  for (unsigned int pe = 0; pe < num_pes_; ++pe) {
+    for (unsigned int vid = 0; vid < num_vinsn_; ++vid) {
+      if (pe_running_.Bit(pe * num_vinsn_ + vid)) {
+        running[vid] |= 1ULL << pe;
+      }
+    }
+  }
+
+  // The sequencer accepted a request in the previous cycle. It got a vid if
+  // it started running on any processing element.
+  if (req_accepted_) {
+    req_accepted_ = false;
+    Cycle(cycle);
+    konata_ << "E\t" << req_kid_ << "\t0\tDs" << std::endl;
+
+    unsigned int vid = 0;
+    while (vid < num_vinsn_ && !(running[vid] && !running_q_[vid])) {
+      ++vid;
+    }
+    if (vid < num_vinsn_) {
+      VInsn &vinsn = vinsn_[vid];
+      vinsn.valid = true;
+      vinsn.kid = req_kid_;
+      vinsn.pe_mask = 0;
+      vinsn.pe_start.assign(num_pes_, -1);
+      vinsn.pe_end.assign(num_pes_, -1);
+      vinsn.executing = false;
+      konata_ << "L\t" << req_kid_ << "\t0\tvid " << vid << ": " << req_label_
+              << std::endl
+              << "S\t" << req_kid_ << "\t0\tIs" << std::endl;
+    } else {
+      // Handled without any processing element
+      konata_ << "L\t" << req_kid_ << "\t0\t" << req_label_ << std::endl
+              << "R\t" << req_kid_ << "\t" << retired_++ << "\t0" << std::endl;
+    }
+  }
+
+  // New request from the dispatcher
+  if (req_valid_.Value() && !req_open_) {
+    req_open_ = true;
+    req_kid_ = next_kid_++;
+    Cycle(cycle);
+    konata_ << "I\t" << req_kid_ << "\t" << req_kid_ << "\t0" << std::endl
+            << "S\t" << req_kid_ << "\t0\tDs" << std::endl;
+  }
+  if (req_open_ && req_valid_.Value() && req_ready_.Value()) {
+    req_open_ = false;
+    req_accepted_ = true;
+    std::ostringstream label;
+    label << "op " << req_op_.Value() << " vd v" << req_vd_.Value() << " vl "
+          << req_vl_.Value();
+    req_label_ = label.str();
+  }
+
+  // Instructions in flight
+  bool pe_req_valid = pe_req_valid_.Value();
+  unsigned int pe_req_id = pe_req_id_.Value();
+  for (unsigned int vid = 0; vid < num_vinsn_; ++vid) {
+    VInsn &vinsn = vinsn_[vid];
+    if (!vinsn.valid) {
+      continue;
+    }
+
+    vinsn.pe_mask |= running[vid];
+    for (unsigned int pe = 0; pe < num_pes_; ++pe) {
+      bool was_running = (running_q_[vid] >> pe) & 1;
+      bool is_running = (running[vid] >> pe) & 1;
+      if (is_running && vinsn.pe_start[pe] < 0 && pe_req_valid &&
+          pe_req_id == vid && pe_req_ready_.Bit(pe)) {
+        vinsn.pe_start[pe] = cycle;
+      }
+      if (was_running && !is_running) {
+        if (vinsn.pe_start[pe] < 0) {
+          vinsn.pe_start[pe] = cycle;
+        }
+        vinsn.pe_end[pe] = cycle;
+      }
+    }
+
+    // Executing once all its processing elements accepted it
+    if (!vinsn.executing) {
+      bool accepted = true;
+      for (unsigned int pe = 0; pe < num_pes_; ++pe) {
+        if (((vinsn.pe_mask >> pe) & 1) && vinsn.pe_start[pe] < 0) {
+          accepted = false;
+        }
+      }
+      if (accepted) {
+        vinsn.executing = true;
+        Cycle(cycle);
+        konata_ << "E\t" << vinsn.kid << "\t0\tIs" << std::endl
+                << "S\t" << vinsn.kid << "\t0\tEx" << std::endl;
+      }
+    }
+
+    if (!running[vid]) {
+      Cycle(cycle);
+      Retire(vinsn);
+    }
+  }
+
+  running_q_ = running;
+}
+
+void AraKonata::PostExec() {
+  if (konata_.is_open()) {
+    konata_.close();
+  }
+}
+
+void AraKonata::PrintStatistics() {
+  if (konata_file_.empty()) {
+    return;
+  }
+  std::cout << "Pipeline trace:   " << retired_ << " instructions written to "
+            << konata_file_ << std::endl;
+}
+
+void AraKonata::Cycle(unsigned long cycle) {
+  if (!cycle_written_) {
+    konata_ << "C=\t" << cycle << std::endl;
+    cycle_written_ = true;
+  } else if (cycle > last_cycle_) {
+    konata_ << "C\t" << cycle - last_cycle_ << std::endl;
+  }
+  last_cycle_ = cycle;
+}
+
+void AraKonata::Retire(VInsn &vinsn) {
+  konata_ << "E\t" << vinsn.kid << "\t0\t" << (vinsn.executing ? "Ex" : "Is")
+          << std::endl;
+  for (unsigned int pe = 0; pe < num_pes_; ++pe) {
+    if ((vinsn.pe_mask >> pe) & 1) {
+      konata_ << "L\t" << vinsn.kid << "\t1\t" << pe_names_[pe] << ": "
+              << vinsn.pe_start[pe] << "-" << vinsn.pe_end[pe] << "\\n"
+              << std::endl;
+    }
+  }
+  konata_ << "R\t" << vinsn.kid << "\t" << retired_++ << "\t0" << std::endl;
+  vinsn.valid = false;
+}
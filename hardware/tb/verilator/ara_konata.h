@@ -0,0 +1,103 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Pipeline tracer for Ara. Follows every vector instruction through the
+// sequencer and the processing elements, and writes a trace in the Kanata
+// format, which can be opened with the Konata pipeline viewer.
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "sim_ctrl_extension.h"
+
+class VerilatedScope;
+
+// A public signal of the testbench, read through the Verilator scope tables.
+// Packed signals are stored little-endian, so that bit i of a signal is bit
+// (i % 8) of its byte (i / 8), regardless of the signal width.
+class PublicSignal {
+ public:
+  PublicSignal() : data_(nullptr), size_byte_(0) {}
+
+  bool Find(const VerilatedScope *scope, const char *name);
+
+  bool Bit(size_t i) const { return (data_[i / 8] >> (i % 8)) & 1; }
+
+  uint64_t Value() const;
+
+ private:
+  const uint8_t *data_;
+  size_t size_byte_;
+};
+
+class AraKonata : public SimCtrlExtension {
+ public:
+  AraKonata();
+
+  // Declared in SimCtrlExtension
+  bool ParseCLIArguments(int argc, char **argv, bool &exit_app) override;
+  void PreExec() override;
+  bool PostRestore() override;
+  void OnClock(unsigned long sim_time) override;
+  void PostExec() override;
+  void PrintStatistics() override;
+
+ private:
+  // A vector instruction in flight, identified by its vid
+  struct VInsn {
+    bool valid;
+    uint64_t kid;
+    // Processing elements the instruction ran on, and when they accepted and
+    // completed it (-1 if not yet)
+    uint64_t pe_mask;
+    std::vector<long> pe_start;
+    std::vector<long> pe_end;
+    bool executing;
+  };
+
+  std::string konata_file_;
+  std::ofstream konata_;
+
+  PublicSignal nr_pes_;
+  PublicSignal nr_vinsn_;
+  PublicSignal req_valid_;
+  PublicSignal req_ready_;
+  PublicSignal req_op_;
+  PublicSignal req_vd_;
+  PublicSignal req_vl_;
+  PublicSignal pe_running_;
+  PublicSignal pe_req_valid_;
+  PublicSignal pe_req_id_;
+  PublicSignal pe_req_ready_;
+
+  unsigned int num_pes_;
+  unsigned int num_vinsn_;
+  std::vector<std::string> pe_names_;
+
+  // Request from the dispatcher, waiting for the sequencer
+  bool req_open_;
+  bool req_accepted_;
+  uint64_t req_kid_;
+  std::string req_label_;
+
+  std::vector<VInsn> vinsn_;
+  // Processing elements running each vid in the previous cycle
+  std::vector<uint64_t> running_q_;
+
+  bool cycle_written_;
+  unsigned long last_cycle_;
+  uint64_t next_kid_;
+  uint64_t retired_;
+
+  // Advance the trace to |cycle|
+  void Cycle(unsigned long cycle);
+
+  // Write the end of |vinsn| and retire it
+  void Retire(VInsn &vinsn);
+};
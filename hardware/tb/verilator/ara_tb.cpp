@@ -9,10 +9,71 @@
 #include <fstream>
 #include <iostream>
 
+#include "ara_konata.h"
 #include "verilated_toplevel.h"
 #include "verilator_memutil.h"
 #include "verilator_sim_ctrl.h"
 
+extern "C" {
+int dram_model_in_use();
+int vtrace_in_use();
+}
+
+// Refuse the checkpoints that would miss the state of the DPI models
+class AraDpiState : public SimCtrlExtension {
+ public:
+  bool PreCheckpoint() override { return Check("save"); }
+  bool PostRestore() override { return Check("restore"); }
+
+ private:
+  bool Check(const char *action) {
+    if (dram_model_in_use()) {
+      std::cerr << "ERROR: Cannot " << action
+                << " a checkpoint with the DRAM timing model, whose state is "
+                   "not part of the checkpoint."
+                << std::endl;
+      return false;
+    }
+    if (vtrace_in_use()) {
+      std::cerr << "ERROR: Cannot " << action
+                << " a checkpoint with a streamed vtrace, whose position is "
+                   "not part of the checkpoint."
+                << std::endl;
+      return false;
+    }
+    return true;
+  }
+};
+
+// Report the outcome of every batch run
+class AraBatchResult : public SimCtrlExtension {
+ public:
+  explicit AraBatchResult(ara_tb_verilator *tb) : tb_(tb) {}
+
+  void PostBatchRun(BatchRecord &record) override {
+    // An image that could not be loaded did not run: the outputs of the design
+    // still belong to the previous image, so report an explicit failure
+    bool loaded = true;
+    for (const auto &field : record) {
+      if (field.first == "loaded") loaded = field.second == "1";
+    }
+    if (!loaded) {
+      record.emplace_back("exit_code", "-1");
+      record.emplace_back("hw_cycles", "0");
+      return;
+    }
+
+    // The exit register is only valid if the program wrote it
+    bool exited = tb_->dut().exit_o & 1;
+    record.emplace_back("exit_code",
+                        exited ? std::to_string(tb_->dut().exit_o >> 1) : "-");
+    record.emplace_back("hw_cycles", std::to_string(tb_->dut().hw_cycles_o));
+  }
+
+ private:
+  ara_tb_verilator *tb_;
+};
+
 int main(int argc, char **argv) {
   // Create an instance of the DUT
   ara_tb_verilator *tb = new ara_tb_verilator;
@@ -22,13 +83,25 @@ int main(int argc, char **argv) {
   VerilatorSimCtrl &simctrl = VerilatorSimCtrl::GetInstance();
   simctrl.SetTop(tb, &tb->clk_i, &tb->rst_ni,
                  VerilatorSimCtrlFlags::ResetPolarityNegative);
+  simctrl.SetEventTrigger(&tb->event_trigger_o);
 
   // Initialize the DRAM
-  MemAreaLoc l2_mem = {.base=0x80000000, .size=0x00100000};
+  // (2^22 / NR_LANES) words of 32 * NR_LANES bits, i.e., the full 16 MiB of the
+  // L2 memory (see L2NumWords in ara_soc.sv)
+  MemAreaLoc l2_mem = {.base=0x80000000, .size=0x01000000};
   memutil.RegisterMemoryArea(
                              "ram", "TOP.ara_tb_verilator.dut.i_ara_soc.i_dram", 64*NR_LANES/2, &l2_mem);
   simctrl.RegisterExtension(&memutil);
 
+  AraBatchResult batch_result(tb);
+  simctrl.RegisterExtension(&batch_result);
+
+  AraDpiState dpi_state;
+  simctrl.RegisterExtension(&dpi_state);
+
+  AraKonata konata;
+  simctrl.RegisterExtension(&konata);
+
   simctrl.SetInitialResetDelay(5);
   simctrl.SetResetDuration(5);
 
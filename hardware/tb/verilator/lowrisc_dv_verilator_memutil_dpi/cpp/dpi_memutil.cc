@@ -13,6 +13,8 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <vector>
+#include <verilated.h>
+#include <verilated_syms.h>
 
 #include "sv_scoped.h"
 
@@ -64,7 +66,9 @@ class ElfFile {
       throw ElfError(path, "could not open file.");
     }
 
-    ptr_ = elf_begin(fd_, ELF_C_READ, NULL);
+    // Map the file instead of reading it into a private buffer. The segments
+    // are then copied only once, from the page cache into the memories.
+    ptr_ = elf_begin(fd_, ELF_C_READ_MMAP, NULL);
     if (!ptr_) {
       close(fd_);
       throw ElfError(path, elf_errmsg(-1));
@@ -306,7 +310,92 @@ static void WriteSegment(const MemArea &m, uint32_t offset,
   }
 }
 
+// Get the storage of the memory array of |m|, if the verilated model exposes
+// it (public `sram' array of the l2_sram, see waiver.vlt). Its words are stored
+// back-to-back in little-endian order, i.e., with the memory's byte layout.
+// Return nullptr if the storage cannot be accessed directly.
+static uint8_t *GetMemStorage(const MemArea &m, size_t &size_byte) {
+  const VerilatedScope *scope = Verilated::scopeFind(m.location.c_str());
+  if (!scope) {
+    return nullptr;
+  }
+  VerilatedVar *var = scope->varFind("sram");
+  if (!var || var->udims() != 1 || var->entSize() != m.width_byte) {
+    return nullptr;
+  }
+  size_byte = var->totalSize();
+  return static_cast<uint8_t *>(var->datap());
+}
+
+// Copy |src_len| bytes from |src| to the storage of |m| at byte |offset|, and
+// zero-fill the storage up to |dst_len| bytes.
+static void WriteBytesDirect(const MemArea &m, uint8_t *storage,
+                             size_t storage_size, uint32_t offset,
+                             const char *src, size_t src_len, size_t dst_len) {
+  if ((size_t)offset + dst_len > storage_size) {
+    std::ostringstream oss;
+    oss << "Segment at byte offset 0x" << std::hex << offset << " of size 0x"
+        << dst_len << " does not fit into `" << m.name << "' memory.";
+    throw std::runtime_error(oss.str());
+  }
+  memcpy(storage + offset, src, src_len);
+  memset(storage + offset + src_len, 0, dst_len - src_len);
+}
+
+// Bulk-copy the PT_LOAD segments of an ELF file straight into the storage of
+// |m|, placing the lowest segment at offset 0 like FlattenElfFile(). Return
+// false if the storage is not accessible, so that the caller can fall back to
+// the word-by-word DPI path.
+static bool WriteElfToMemDirect(const MemArea &m, const std::string &filepath) {
+  size_t storage_size;
+  uint8_t *storage = GetMemStorage(m, storage_size);
+  if (!storage) {
+    return false;
+  }
+
+  ElfFile elf(filepath);
+  size_t file_size;
+  const char *file_data = elf_rawfile(elf.ptr_, &file_size);
+  assert(file_data);
+
+  size_t phnum = elf.GetPhdrNum();
+  const Elf64_Phdr *phdrs = elf.GetPhdrs();
+
+  bool any = false;
+  Elf64_Addr low = 0;
+  for (size_t i = 0; i < phnum; i++) {
+    const Elf64_Phdr &phdr = phdrs[i];
+    if (phdr.p_type != PT_LOAD || phdr.p_memsz == 0 || phdr.p_filesz == 0)
+      continue;
+    if (!any || phdr.p_paddr < low)
+      low = phdr.p_paddr;
+    any = true;
+  }
+
+  for (size_t i = 0; i < phnum; i++) {
+    const Elf64_Phdr &phdr = phdrs[i];
+    if (phdr.p_type != PT_LOAD || phdr.p_memsz == 0 || phdr.p_filesz == 0)
+      continue;
+
+    if (file_size < phdr.p_offset + phdr.p_filesz) {
+      std::ostringstream oss;
+      oss << "phdr for segment " << i << " claims to end at offset 0x"
+          << std::hex << phdr.p_offset + phdr.p_filesz
+          << ", but the file only has size 0x" << file_size << ".";
+      throw ElfError(filepath, oss.str());
+    }
+
+    size_t src_len = std::min(phdr.p_filesz, phdr.p_memsz);
+    WriteBytesDirect(m, storage, storage_size, phdr.p_paddr - low,
+                     file_data + phdr.p_offset, src_len, phdr.p_memsz);
+  }
+  return true;
+}
+
 static void WriteElfToMem(const MemArea &m, const std::string &filepath) {
+  if (WriteElfToMemDirect(m, filepath)) {
+    return;
+  }
   WriteSegment(m, 0, FlattenElfFile(filepath));
 }
 
@@ -539,7 +628,68 @@ void DpiMemUtil::LoadFileToNamedMem(bool verbose, const std::string &name,
   }
 }
 
+bool DpiMemUtil::LoadElfToMemoriesDirect(bool verbose,
+                                         const std::string &path) {
+  ElfFile elf(path);
+
+  size_t file_size;
+  const char *file_data = elf_rawfile(elf.ptr_, &file_size);
+  assert(file_data);
+
+  size_t phnum = elf.GetPhdrNum();
+  const Elf64_Phdr *phdrs = elf.GetPhdrs();
+
+  // Check that all the target memories expose their storage before touching
+  // any of them
+  std::vector<std::pair<uint8_t *, size_t>> storages(phnum, {nullptr, 0});
+  for (size_t i = 0; i < phnum; ++i) {
+    const Elf64_Phdr &phdr = phdrs[i];
+    if (phdr.p_type != PT_LOAD || phdr.p_memsz == 0)
+      continue;
+
+    const MemArea &mem_area =
+        GetRegionForSegment(path, i, phdr.p_paddr, phdr.p_memsz);
+    storages[i].first = GetMemStorage(mem_area, storages[i].second);
+    if (!storages[i].first)
+      return false;
+
+    if (file_size < (size_t)phdr.p_offset + phdr.p_filesz) {
+      std::ostringstream oss;
+      oss << "phdr for segment " << i << " claims to end at offset 0x"
+          << std::hex << phdr.p_offset + phdr.p_filesz - 1
+          << ", but the file only has size 0x" << file_size << ".";
+      throw ElfError(path, oss.str());
+    }
+  }
+
+  for (size_t i = 0; i < phnum; ++i) {
+    const Elf64_Phdr &phdr = phdrs[i];
+    if (phdr.p_type != PT_LOAD || phdr.p_memsz == 0)
+      continue;
+
+    const MemArea &mem_area =
+        GetRegionForSegment(path, i, phdr.p_paddr, phdr.p_memsz);
+    if (verbose) {
+      std::cout << "Loading segment " << i << " from ELF file `" << path
+                << "' into memory `" << mem_area.name << "'." << std::endl;
+    }
+
+    uint32_t local_base = phdr.p_paddr - mem_area.addr_loc.base;
+    size_t src_len = std::min(phdr.p_filesz, phdr.p_memsz);
+    WriteBytesDirect(mem_area, storages[i].first, storages[i].second,
+                     local_base, file_data + phdr.p_offset, src_len,
+                     phdr.p_memsz);
+  }
+  return true;
+}
+
 void DpiMemUtil::LoadElfToMemories(bool verbose, const std::string &filepath) {
+  // Bulk-copy the segments if the memories allow it
+  if (LoadElfToMemoriesDirect(verbose, filepath)) {
+    staging_area_.clear();
+    return;
+  }
+
   // Load the contents of the ELF file into the staging area
   StageElf(verbose, filepath);
 
@@ -569,6 +719,27 @@ void DpiMemUtil::LoadElfToMemories(bool verbose, const std::string &filepath) {
   }
 }
 
+void DpiMemUtil::ClearMemories() {
+  for (const auto &pr : name_to_mem_) {
+    const MemArea &m = pr.second;
+
+    size_t storage_size;
+    uint8_t *storage = GetMemStorage(m, storage_size);
+    if (storage) {
+      memset(storage, 0, storage_size);
+    } else if (m.addr_loc.size) {
+      try {
+        WriteSegment(m, 0, std::vector<uint8_t>(m.addr_loc.size, 0));
+      } catch (const SVScoped::Error &err) {
+        std::ostringstream oss;
+        oss << "No memory found at `" << err.scope_name_
+            << "' (the scope associated with region `" << m.name << "').";
+        throw std::runtime_error(oss.str());
+      }
+    }
+  }
+}
+
 void DpiMemUtil::StageElf(bool verbose, const std::string &path) {
   // Clear out anything that was in the staging area before
   staging_area_.clear();
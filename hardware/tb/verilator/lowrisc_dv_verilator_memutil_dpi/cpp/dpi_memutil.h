@@ -131,6 +131,11 @@ class DpiMemUtil {
    */
   void LoadElfToMemories(bool verbose, const std::string &filepath);
 
+  /**
+   * Zero the whole content of all the registered memories with a known size.
+   */
+  void ClearMemories();
+
   /**
    * Load an ELF file into a staging area in this object, which can then be
    * accessed with GetMemoryData().
@@ -157,6 +162,15 @@ class DpiMemUtil {
   std::map<std::string, StagedMem> staging_area_;
   const StagedMem empty_;
 
+  /**
+   * Load an ELF file by copying its segments straight into the storage of the
+   * verilated memories, bypassing the staging area and the DPI calls.
+   *
+   * Return false, without writing anything, if any of the target memories
+   * does not expose its storage.
+   */
+  bool LoadElfToMemoriesDirect(bool verbose, const std::string &path);
+
   /**
    * Find a region containing for the given segment's addresses.
    * Raises a std::exception if none is found.
@@ -76,6 +76,9 @@ static void PrintHelp() {
                "  TYPE is either 'elf' or 'vmem'\n\n"
                "-E|--load-elf=FILE\n"
                "  Load ELF file, using segment LMAs to pick memory regions\n\n"
+               "--restore-meminit=NAME,FILE[,TYPE]\n"
+               "  Initialize memory region NAME with FILE [of TYPE] after\n"
+               "  a checkpoint has been restored\n\n"
                "-l list|--meminit=list\n"
                "  Print registered memory regions\n\n"
                "--verbose-mem-load\n"
@@ -84,11 +87,17 @@ static void PrintHelp() {
                "  Show help\n\n";
 }
 
-VerilatorMemUtil::VerilatorMemUtil() : allocation_(new DpiMemUtil()) {
+VerilatorMemUtil::VerilatorMemUtil()
+    : allocation_(new DpiMemUtil()),
+      verbose_(false),
+      load_time_(std::chrono::steady_clock::duration::zero()) {
   mem_util_ = allocation_.get();
 }
 
-VerilatorMemUtil::VerilatorMemUtil(DpiMemUtil *mem_util) : mem_util_(mem_util) {
+VerilatorMemUtil::VerilatorMemUtil(DpiMemUtil *mem_util)
+    : mem_util_(mem_util),
+      verbose_(false),
+      load_time_(std::chrono::steady_clock::duration::zero()) {
   assert(mem_util);
 }
 
@@ -101,6 +110,7 @@ bool VerilatorMemUtil::ParseCLIArguments(int argc, char **argv,
       {"meminit", required_argument, nullptr, 'l'},
       {"verbose-mem-load", no_argument, nullptr, 'V'},
       {"load-elf", required_argument, nullptr, 'E'},
+      {"restore-meminit", required_argument, nullptr, 'L'},
       {"help", no_argument, nullptr, 'h'},
       {nullptr, no_argument, nullptr, 0}};
 
@@ -149,6 +159,16 @@ bool VerilatorMemUtil::ParseCLIArguments(int argc, char **argv,
           return false;
         }
         break;
+      case 'L':
+        // Only check the format now, the load happens after the restore
+        try {
+          ParseMemArg(optarg);
+        } catch (const std::runtime_error &err) {
+          std::cerr << "ERROR: " << err.what() << std::endl;
+          return false;
+        }
+        restore_mem_args_.push_back(optarg);
+        break;
       case 'V':
         verbose = true;
         break;
@@ -169,6 +189,9 @@ bool VerilatorMemUtil::ParseCLIArguments(int argc, char **argv,
     }
   }
 
+  verbose_ = verbose;
+
+  auto load_begin = std::chrono::steady_clock::now();
   for (const LoadArg &arg : load_args) {
     try {
       if (!arg.name.empty()) {
@@ -183,6 +206,45 @@ bool VerilatorMemUtil::ParseCLIArguments(int argc, char **argv,
       return false;
     }
   }
+  load_time_ += std::chrono::steady_clock::now() - load_begin;
 
   return true;
 }
+
+bool VerilatorMemUtil::PostRestore() {
+  auto load_begin = std::chrono::steady_clock::now();
+  bool success = true;
+  for (const std::string &mem_arg : restore_mem_args_) {
+    try {
+      LoadArg arg = ParseMemArg(mem_arg);
+      mem_util_->LoadFileToNamedMem(verbose_, arg.name, arg.filepath,
+                                    arg.type);
+    } catch (const std::exception &err) {
+      std::cerr << "ERROR: " << err.what() << std::endl;
+      success = false;
+    }
+  }
+  load_time_ += std::chrono::steady_clock::now() - load_begin;
+  return success;
+}
+
+bool VerilatorMemUtil::PreBatchRun(const std::string &image) {
+  // Batch images are ELF files, placed in memory by LMA. Clear the memories
+  // first, so that no run sees the data left by the previous image.
+  auto load_begin = std::chrono::steady_clock::now();
+  bool success = true;
+  try {
+    mem_util_->ClearMemories();
+    mem_util_->LoadElfToMemories(verbose_, image);
+  } catch (const std::exception &err) {
+    std::cerr << "ERROR: " << err.what() << std::endl;
+    success = false;
+  }
+  load_time_ += std::chrono::steady_clock::now() - load_begin;
+  return success;
+}
+
+void VerilatorMemUtil::PrintStatistics() {
+  double load_time_s = std::chrono::duration<double>(load_time_).count();
+  std::cout << "Memory load time: " << load_time_s << " s" << std::endl;
+}
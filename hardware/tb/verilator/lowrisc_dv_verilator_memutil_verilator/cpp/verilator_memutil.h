@@ -8,7 +8,10 @@
 // A wrapper class that converts a VerilatorMemutil into a SimCtrlExtension
 //
 
+#include <chrono>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "dpi_memutil.h"
 #include "sim_ctrl_extension.h"
@@ -22,6 +25,9 @@ class VerilatorMemUtil : public SimCtrlExtension {
 
   // Declared in SimCtrlExtension
   bool ParseCLIArguments(int argc, char **argv, bool &exit_app) override;
+  bool PostRestore() override;
+  bool PreBatchRun(const std::string &image) override;
+  void PrintStatistics() override;
 
   // Get underlying DpiMemUtil object
   DpiMemUtil *GetUnderlying() { return mem_util_; }
@@ -39,4 +45,11 @@ class VerilatorMemUtil : public SimCtrlExtension {
  private:
   DpiMemUtil *mem_util_;
   std::unique_ptr<DpiMemUtil> allocation_;
+
+  // Memory initializations deferred until a checkpoint has been restored
+  std::vector<std::string> restore_mem_args_;
+  bool verbose_;
+
+  // Wallclock time spent loading memory images
+  std::chrono::steady_clock::duration load_time_;
 };
@@ -5,6 +5,13 @@
 #ifndef OPENTITAN_HW_DV_VERILATOR_SIMUTIL_VERILATOR_CPP_SIM_CTRL_EXTENSION_H_
 #define OPENTITAN_HW_DV_VERILATOR_SIMUTIL_VERILATOR_CPP_SIM_CTRL_EXTENSION_H_
 
+#include <string>
+#include <utility>
+#include <vector>
+
+// Named fields of the result record of a batch run
+typedef std::vector<std::pair<std::string, std::string>> BatchRecord;
+
 class SimCtrlExtension {
  public:
   virtual ~SimCtrlExtension() = default;
@@ -32,10 +39,48 @@ class SimCtrlExtension {
    */
   virtual void OnClock(unsigned long sim_time) {}
 
+  /**
+   * Function to be called before the model state is saved to a checkpoint
+   *
+   * @return Return code, true == the state of the extension can be omitted
+   *         from the checkpoint
+   */
+  virtual bool PreCheckpoint() { return true; }
+
+  /**
+   * Function to be called after the model state has been restored from a
+   * checkpoint, before the simulation resumes
+   *
+   * @return Return code, true == success
+   */
+  virtual bool PostRestore() { return true; }
+
+  /**
+   * Function to be called before every run of a batch, while the design is
+   * still in reset
+   *
+   * @param image Path to the memory image of this run
+   * @return Return code, true == success
+   */
+  virtual bool PreBatchRun(const std::string &image) { return true; }
+
+  /**
+   * Function to be called after every run of a batch
+   *
+   * @param record Result record of this run, to be extended with the fields
+   *               provided by the extension
+   */
+  virtual void PostBatchRun(BatchRecord &record) {}
+
   /**
    * Function to be called after executing the simulation
    */
   virtual void PostExec() {}
+
+  /**
+   * Function to be called when the simulation statistics are printed
+   */
+  virtual void PrintStatistics() {}
 };
 
 #endif  // OPENTITAN_HW_DV_VERILATOR_SIMUTIL_VERILATOR_CPP_SIM_CTRL_EXTENSION_H_
@@ -4,10 +4,16 @@
 
 #include "verilator_sim_ctrl.h"
 
+#include <climits>
+#include <dirent.h>
+#include <fstream>
 #include <getopt.h>
 #include <iostream>
 #include <signal.h>
+#include <sstream>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include <verilated.h>
 
 // This is defined by Verilator and passed through the command line
@@ -15,6 +21,16 @@
 #define VM_TRACE 0
 #endif
 
+// This is defined by the user when calling Verilator with --savable
+#ifndef VM_SAVABLE
+#define VM_SAVABLE 0
+#endif
+
+// Values written to the event_trigger control register to switch tracing on
+// and off, see also tb/ara_tb.sv
+static const QData kEventTriggerOn = 0x0000000000000001ULL;
+static const QData kEventTriggerOff = 0xFFFFFFFFFFFFFFFFULL;
+
 /**
  * Get the current simulation time
  *
@@ -47,6 +63,10 @@ void VerilatorSimCtrl::SetTop(VerilatedToplevel *top, CData *sig_clk,
   flags_ = flags;
 }
 
+void VerilatorSimCtrl::SetEventTrigger(QData *sig_event_trigger) {
+  sig_event_trigger_ = sig_event_trigger;
+}
+
 std::pair<int, bool> VerilatorSimCtrl::Exec(int argc, char **argv) {
   bool exit_app = false;
   bool good_cmdline = ParseCommandArgs(argc, argv, exit_app);
@@ -64,6 +84,18 @@ bool VerilatorSimCtrl::ParseCommandArgs(int argc, char **argv, bool &exit_app) {
   const struct option long_options[] = {
       {"term-after-cycles", required_argument, nullptr, 'c'},
       {"trace", no_argument, nullptr, 't'},
+      {"trace-start", required_argument, nullptr, 'T'},
+      {"trace-stop", required_argument, nullptr, 'P'},
+      {"trace-on-event", no_argument, nullptr, 'E'},
+      {"trace-scope", required_argument, nullptr, 's'},
+      {"checkpoint-at-cycle", required_argument, nullptr, 'k'},
+      {"checkpoint-on-event", no_argument, nullptr, 'e'},
+      {"checkpoint-file", required_argument, nullptr, 'K'},
+      {"checkpoint-and-stop", no_argument, nullptr, 'S'},
+      {"restore", required_argument, nullptr, 'R'},
+      {"batch", required_argument, nullptr, 'b'},
+      {"batch-results", required_argument, nullptr, 'B'},
+      {"batch-jobs", required_argument, nullptr, 'j'},
       {"help", no_argument, nullptr, 'h'},
       {nullptr, no_argument, nullptr, 0}};
 
@@ -80,17 +112,82 @@ bool VerilatorSimCtrl::ParseCommandArgs(int argc, char **argv, bool &exit_app) {
       case 0:
         break;
       case 't':
+      case 'T':
+      case 'P':
+      case 'E':
+      case 's':
         if (!tracing_possible_) {
           std::cerr << "ERROR: Tracing has not been enabled at compile time."
                     << std::endl;
           exit_app = true;
           return false;
         }
-        TraceOn();
+        if (c == 't') {
+          TraceOn();
+        } else if (c == 'T') {
+          trace_start_cycle_ = strtoul(optarg, nullptr, 0);
+        } else if (c == 'P') {
+          trace_stop_cycle_ = strtoul(optarg, nullptr, 0);
+        } else if (c == 'E') {
+          if (!sig_event_trigger_) {
+            std::cerr << "ERROR: No event trigger signal has been set."
+                      << std::endl;
+            exit_app = true;
+            return false;
+          }
+          trace_on_event_ = true;
+        } else {
+          // Comma-separated list of hierarchy prefixes
+          std::istringstream scopes(optarg);
+          for (std::string scope; std::getline(scopes, scope, ',');) {
+            if (!scope.empty()) {
+              trace_scopes_.push_back(scope);
+            }
+          }
+        }
         break;
       case 'c':
         term_after_cycles_ = atoi(optarg);
         break;
+      case 'k':
+      case 'e':
+      case 'R':
+        if (!savable_possible_) {
+          std::cerr << "ERROR: Checkpointing has not been enabled at compile "
+                       "time."
+                    << std::endl;
+          exit_app = true;
+          return false;
+        }
+        if (c == 'k') {
+          checkpoint_cycle_ = strtoul(optarg, nullptr, 0);
+        } else if (c == 'e') {
+          if (!sig_event_trigger_) {
+            std::cerr << "ERROR: No event trigger signal has been set."
+                      << std::endl;
+            exit_app = true;
+            return false;
+          }
+          checkpoint_on_event_ = true;
+        } else {
+          restore_file_ = optarg;
+        }
+        break;
+      case 'K':
+        checkpoint_file_ = optarg;
+        break;
+      case 'S':
+        checkpoint_and_stop_ = true;
+        break;
+      case 'b':
+        batch_file_ = optarg;
+        break;
+      case 'B':
+        batch_results_file_ = optarg;
+        break;
+      case 'j':
+        batch_jobs_ = atoi(optarg) > 0 ? atoi(optarg) : 1;
+        break;
       case 'h':
         PrintHelp();
         exit_app = true;
@@ -136,7 +233,11 @@ void VerilatorSimCtrl::RunSimulation() {
     (*it)->PreExec();
   }
   // Run the simulation
-  Run();
+  if (batch_file_.empty()) {
+    Run();
+  } else {
+    RunBatch();
+  }
   // Call all extension post-exec methods
   for (auto it = extension_array_.begin(); it != extension_array_.end(); ++it) {
     (*it)->PostExec();
@@ -175,12 +276,28 @@ VerilatorSimCtrl::VerilatorSimCtrl()
       tracing_enabled_changed_(false),
       tracing_ever_enabled_(false),
       tracing_possible_(VM_TRACE),
+      trace_start_cycle_(0),
+      trace_stop_cycle_(0),
+      trace_on_event_(false),
+      in_trace_window_(false),
       initial_reset_delay_cycles_(2),
       reset_duration_cycles_(2),
       request_stop_(false),
       simulation_success_(true),
       tracer_(VerilatedTracer()),
-      term_after_cycles_(0) {}
+      term_after_cycles_(0),
+      sig_event_trigger_(nullptr),
+      event_trigger_q_(0),
+      event_trigger_written_(false),
+      savable_possible_(VM_SAVABLE),
+      checkpoint_cycle_(0),
+      checkpoint_on_event_(false),
+      checkpoint_and_stop_(false),
+      checkpoint_taken_(false),
+      checkpoint_file_("sim.ckpt"),
+      time_restored_(0),
+      batch_results_file_("batch_results.csv"),
+      batch_jobs_(1) {}
 
 void VerilatorSimCtrl::RegisterSignalHandler() {
   struct sigaction sigIntHandler;
@@ -214,10 +331,46 @@ void VerilatorSimCtrl::PrintHelp() const {
   std::cout << "Execute a simulation model for " << GetName() << "\n\n";
   if (tracing_possible_) {
     std::cout << "-t|--trace\n"
-                 "  Write a trace file from the start\n\n";
+                 "  Write a trace file from the start\n\n"
+                 "--trace-start=N\n"
+                 "  Start tracing at cycle N\n\n"
+                 "--trace-stop=N\n"
+                 "  Stop tracing at cycle N\n\n"
+                 "--trace-on-event\n"
+                 "  Start tracing when software writes 1 to the event_trigger\n"
+                 "  control register, and stop when it writes -1\n\n"
+                 "--trace-scope=SCOPE[,SCOPE...]\n"
+                 "  Only trace the signals below the given hierarchy prefixes,\n"
+                 "  e.g., TOP.ara_tb_verilator.dut.i_ara_soc.i_system.i_ara.i_vlsu\n\n";
+  }
+  if (savable_possible_) {
+    std::cout << "--checkpoint-at-cycle=N\n"
+                 "  Save the full model state after N cycles\n\n"
+                 "--checkpoint-on-event\n"
+                 "  Save the full model state when software first writes the\n"
+                 "  event_trigger control register\n\n"
+                 "--checkpoint-file=FILE\n"
+                 "  Write the checkpoint to FILE (default: sim.ckpt)\n\n"
+                 "--checkpoint-and-stop\n"
+                 "  Terminate simulation once the checkpoint is written\n\n"
+                 "--restore=FILE\n"
+                 "  Resume the simulation from the checkpoint in FILE\n\n"
+                 "  Only the state of the model is saved, not the one of the\n"
+                 "  DPI models: checkpointing fails with the DRAM timing model\n"
+                 "  or a streamed vtrace, and restoring fails with --konata.\n\n";
   }
-  std::cout << "-c|--term-after-cycles=N\n"
-               "  Terminate simulation after N cycles\n\n"
+  std::cout << "--batch=FILE\n"
+               "  Run every memory image listed in FILE (one per line) on the\n"
+               "  same model, resetting the design in between\n\n"
+               "--batch-results=FILE\n"
+               "  Write one CSV record per batch image to FILE\n"
+               "  (default: batch_results.csv)\n\n"
+               "--batch-jobs=N\n"
+               "  Split the batch among N copies of the model running in\n"
+               "  parallel\n\n"
+               "-c|--term-after-cycles=N\n"
+               "  Terminate simulation after N cycles (per image in batch "
+               "mode)\n\n"
                "-h|--help\n"
                "  Show help\n\n"
                "All arguments are passed to the design and can be used "
@@ -245,14 +398,18 @@ bool VerilatorSimCtrl::TraceOff() {
 }
 
 void VerilatorSimCtrl::PrintStatistics() const {
-  double speed_hz = time_ / 2 / (GetExecutionTimeMs() / 1000.0);
+  double speed_hz =
+      (time_ - time_restored_) / 2 / (GetExecutionTimeMs() / 1000.0);
   double speed_khz = speed_hz / 1000.0;
 
   std::cout << std::endl
             << "Simulation statistics" << std::endl
             << "=====================" << std::endl
-            << "Executed cycles:  " << time_ / 2 << std::endl
-            << "Wallclock time:   " << GetExecutionTimeMs() / 1000.0 << " s"
+            << "Executed cycles:  " << time_ / 2 << std::endl;
+  if (time_restored_) {
+    std::cout << "Restored cycles:  " << time_restored_ / 2 << std::endl;
+  }
+  std::cout << "Wallclock time:   " << GetExecutionTimeMs() / 1000.0 << " s"
             << std::endl
             << "Simulation speed: " << speed_hz << " cycles/s "
             << "(" << speed_khz << " kHz)" << std::endl;
@@ -261,6 +418,80 @@ void VerilatorSimCtrl::PrintStatistics() const {
   if (tracing_enabled_ && FileSize(GetTraceFileName(), trace_size_byte)) {
     std::cout << "Trace file size:  " << trace_size_byte << " B" << std::endl;
   }
+
+  for (auto it = extension_array_.begin(); it != extension_array_.end(); ++it) {
+    (*it)->PrintStatistics();
+  }
+
+  if (Verilated::threads() > 1) {
+    PrintThreadStatistics();
+  }
+}
+
+void VerilatorSimCtrl::PrintThreadStatistics() const {
+  double wallclock_s = GetExecutionTimeMs() / 1000.0;
+  long ticks_per_s = sysconf(_SC_CLK_TCK);
+
+  DIR *dir = opendir("/proc/self/task");
+  if (!dir || !wallclock_s || ticks_per_s <= 0) {
+    if (dir) {
+      closedir(dir);
+    }
+    return;
+  }
+
+  std::cout << std::endl
+            << "Thread utilization (" << Verilated::threads() << " threads)"
+            << std::endl;
+
+  double total_s = 0;
+  unsigned int nr_threads = 0;
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != nullptr) {
+    if (entry->d_name[0] == '.') {
+      continue;
+    }
+
+    std::ifstream stat_file(std::string("/proc/self/task/") + entry->d_name +
+                            "/stat");
+    std::string stat;
+    if (!std::getline(stat_file, stat)) {
+      continue;
+    }
+
+    // The thread name can contain spaces, skip it before splitting the
+    // remaining fields. utime and stime are fields 14 and 15.
+    size_t name_end = stat.rfind(')');
+    if (name_end == std::string::npos) {
+      continue;
+    }
+    std::istringstream fields(stat.substr(name_end + 2));
+    std::string field;
+    unsigned long utime = 0, stime = 0;
+    for (int i = 3; i <= 15 && fields >> field; ++i) {
+      if (i == 14) {
+        utime = strtoul(field.c_str(), nullptr, 10);
+      } else if (i == 15) {
+        stime = strtoul(field.c_str(), nullptr, 10);
+      }
+    }
+
+    // This also accounts for the time spent before the main loop, e.g., to
+    // load the memories, which is negligible for long simulations.
+    double busy_s = (double)(utime + stime) / ticks_per_s;
+    total_s += busy_s;
+    ++nr_threads;
+    std::cout << "  Thread " << entry->d_name << ": " << busy_s << " s ("
+              << 100.0 * busy_s / wallclock_s << " %)" << std::endl;
+  }
+  closedir(dir);
+
+  if (!nr_threads) {
+    return;
+  }
+  std::cout << "Average utilization: "
+            << 100.0 * total_s / (wallclock_s * nr_threads) << " %"
+            << std::endl;
 }
 
 const char *VerilatorSimCtrl::GetTraceFileName() const {
@@ -272,12 +503,49 @@ const char *VerilatorSimCtrl::GetTraceFileName() const {
 }
 
 void VerilatorSimCtrl::Run() {
+  StartSimulation();
+
+  unsigned long start_reset_cycle = initial_reset_delay_cycles_;
+  unsigned long end_reset_cycle = start_reset_cycle + reset_duration_cycles_;
+
+  // Resume from a checkpoint. The reset sequence lies in the past of the
+  // restored state and is therefore skipped, even if the checkpoint was taken
+  // before the end of the reset.
+  if (!restore_file_.empty()) {
+    bool restored = RestoreCheckpoint(restore_file_);
+    for (auto it = extension_array_.begin();
+         restored && it != extension_array_.end(); ++it) {
+      restored = (*it)->PostRestore();
+    }
+    if (!restored) {
+      std::cerr << "ERROR: Could not resume from checkpoint `"
+                << restore_file_ << "'." << std::endl;
+      RequestStop(false);
+      FinishSimulation();
+      return;
+    }
+    UnsetReset();
+    start_reset_cycle = ULONG_MAX;
+    end_reset_cycle = ULONG_MAX;
+    time_begin_ = std::chrono::steady_clock::now();
+  }
+
+  RunCycles(start_reset_cycle, end_reset_cycle, term_after_cycles_);
+
+  FinishSimulation();
+}
+
+void VerilatorSimCtrl::StartSimulation() {
   assert(top_ && "Use SetTop() first.");
 
   // We always need to enable this as tracing can be enabled at runtime
   if (tracing_possible_) {
     Verilated::traceEverOn(true);
     top_->trace(tracer_, 99, 0);
+    // Restrict the dumped signals before the trace file is opened
+    for (const std::string &scope : trace_scopes_) {
+      tracer_.dumpvars(0, scope);
+    }
   }
 
   Trace();
@@ -290,16 +558,26 @@ void VerilatorSimCtrl::Run() {
 
   time_begin_ = std::chrono::steady_clock::now();
   UnsetReset();
+}
 
-  unsigned long start_reset_cycle_ = initial_reset_delay_cycles_;
-  unsigned long end_reset_cycle_ = start_reset_cycle_ + reset_duration_cycles_;
+void VerilatorSimCtrl::FinishSimulation() {
+  top_->final();
+  time_end_ = std::chrono::steady_clock::now();
 
+  if (TracingEverEnabled()) {
+    tracer_.close();
+  }
+}
+
+void VerilatorSimCtrl::RunCycles(unsigned long start_reset_cycle,
+                                 unsigned long end_reset_cycle,
+                                 unsigned long timeout_cycle) {
   while (1) {
     unsigned long cycle_ = time_ / 2;
 
-    if (cycle_ == start_reset_cycle_) {
+    if (cycle_ == start_reset_cycle) {
       SetReset();
-    } else if (cycle_ == end_reset_cycle_) {
+    } else if (cycle_ == end_reset_cycle) {
       UnsetReset();
     }
 
@@ -318,6 +596,12 @@ void VerilatorSimCtrl::Run() {
 
     Trace();
 
+    if (!*sig_clk_) {
+      SampleEventTrigger();
+      TraceWindow();
+      Checkpoint();
+    }
+
     if (request_stop_) {
       std::cout << "Received stop request, shutting down simulation."
                 << std::endl;
@@ -328,19 +612,143 @@ void VerilatorSimCtrl::Run() {
                 << std::endl;
       break;
     }
-    if (term_after_cycles_ && (time_ / 2 >= term_after_cycles_)) {
-      std::cout << "Simulation timeout of " << term_after_cycles_
+    if (timeout_cycle && (time_ / 2 >= timeout_cycle)) {
+      std::cout << "Simulation timeout of " << timeout_cycle
                 << " cycles reached, shutting down simulation." << std::endl;
       break;
     }
   }
+}
+
+void VerilatorSimCtrl::RunBatch() {
+  std::vector<std::string> images;
+  std::ifstream batch(batch_file_);
+  if (!batch.is_open()) {
+    std::cerr << "ERROR: Could not open batch file `" << batch_file_ << "'."
+              << std::endl;
+    simulation_success_ = false;
+    return;
+  }
+  for (std::string line; std::getline(batch, line);) {
+    if (!line.empty() && line[0] != '#') {
+      images.push_back(line);
+    }
+  }
 
-  top_->final();
+  unsigned int jobs = std::min<size_t>(batch_jobs_, images.size());
+  if (jobs <= 1) {
+    std::ofstream results(batch_results_file_);
+    RunBatchImages(images, results);
+    return;
+  }
+
+  // Every job is a forked copy of the (not yet evaluated) model. Job j runs
+  // the images j, j + jobs, j + 2 * jobs, ...
+  time_begin_ = std::chrono::steady_clock::now();
+  std::vector<pid_t> pids;
+  for (unsigned int j = 0; j < jobs; ++j) {
+    std::vector<std::string> job_images;
+    for (size_t i = j; i < images.size(); i += jobs) {
+      job_images.push_back(images[i]);
+    }
+
+    pid_t pid = fork();
+    if (pid == 0) {
+      std::ofstream results(batch_results_file_ + "." + std::to_string(j));
+      RunBatchImages(job_images, results);
+      results.close();
+      PrintStatistics();
+      std::cout.flush();
+      _exit(simulation_success_ ? 0 : 1);
+    } else if (pid < 0) {
+      std::cerr << "ERROR: Could not fork batch job " << j << "." << std::endl;
+      simulation_success_ = false;
+      break;
+    }
+    pids.push_back(pid);
+  }
+
+  for (pid_t pid : pids) {
+    int status;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status)) {
+      simulation_success_ = false;
+    }
+  }
   time_end_ = std::chrono::steady_clock::now();
 
-  if (TracingEverEnabled()) {
-    tracer_.close();
+  // Merge the per-job records back in the order of the batch file
+  std::vector<std::ifstream> job_results;
+  for (unsigned int j = 0; j < pids.size(); ++j) {
+    std::string job_file = batch_results_file_ + "." + std::to_string(j);
+    job_results.emplace_back(job_file);
+    unlink(job_file.c_str());
+  }
+  std::ofstream results(batch_results_file_);
+  bool header = true;
+  for (size_t i = 0; i < images.size() && !job_results.empty(); ++i) {
+    std::string header_line, record_line;
+    std::ifstream &job = job_results[i % job_results.size()];
+    // Every job file starts with its own header
+    if (i < job_results.size() && std::getline(job, header_line) && header) {
+      results << header_line << std::endl;
+      header = false;
+    }
+    if (std::getline(job, record_line)) {
+      results << record_line << std::endl;
+    }
+  }
+}
+
+void VerilatorSimCtrl::RunBatchImages(const std::vector<std::string> &images,
+                                      std::ostream &results) {
+  StartSimulation();
+
+  bool header_written = false;
+  for (const std::string &image : images) {
+    unsigned long start_cycle = time_ / 2;
+
+    // Keep the design in reset while the new image is loaded
+    SetReset();
+    bool loaded = true;
+    for (auto it = extension_array_.begin(); it != extension_array_.end();
+         ++it) {
+      loaded &= (*it)->PreBatchRun(image);
+    }
+
+    BatchRecord record = {{"image", image}};
+    if (loaded) {
+      std::cout << std::endl << "Batch run of " << image << std::endl;
+      Verilated::gotFinish(false);
+      RunCycles(start_cycle, start_cycle + reset_duration_cycles_,
+                term_after_cycles_ ? start_cycle + term_after_cycles_ : 0);
+    }
+    record.emplace_back("loaded", loaded ? "1" : "0");
+    record.emplace_back("cycles", std::to_string(time_ / 2 - start_cycle));
+    for (auto it = extension_array_.begin(); it != extension_array_.end();
+         ++it) {
+      (*it)->PostBatchRun(record);
+    }
+
+    // The header is taken from the fields of the first record
+    if (!header_written) {
+      header_written = true;
+      for (size_t i = 0; i < record.size(); ++i) {
+        results << (i ? "," : "") << record[i].first;
+      }
+      results << std::endl;
+    }
+    for (size_t i = 0; i < record.size(); ++i) {
+      results << (i ? "," : "") << record[i].second;
+    }
+    results << std::endl;
+
+    if (request_stop_) {
+      break;
+    }
   }
+
+  FinishSimulation();
 }
 
 std::string VerilatorSimCtrl::GetName() const {
@@ -408,3 +816,109 @@ void VerilatorSimCtrl::Trace() {
 
   tracer_.dump(GetTime());
 }
+
+void VerilatorSimCtrl::SampleEventTrigger() {
+  event_trigger_written_ = false;
+  if (sig_event_trigger_) {
+    event_trigger_written_ =
+        (*sig_event_trigger_ != event_trigger_q_) && *sig_event_trigger_;
+    event_trigger_q_ = *sig_event_trigger_;
+  }
+}
+
+void VerilatorSimCtrl::TraceWindow() {
+  // Tracing is switched only when entering or leaving the window, so that it
+  // can still be toggled through SIGUSR1 in between
+  if (trace_start_cycle_ || trace_stop_cycle_) {
+    unsigned long cycle = time_ / 2;
+    bool in_window = (cycle >= trace_start_cycle_) &&
+                     (!trace_stop_cycle_ || cycle < trace_stop_cycle_);
+    if (in_window != in_trace_window_) {
+      in_trace_window_ = in_window;
+      if (in_window) {
+        TraceOn();
+      } else {
+        TraceOff();
+      }
+    }
+  }
+
+  if (trace_on_event_ && event_trigger_written_) {
+    if (event_trigger_q_ == kEventTriggerOn) {
+      TraceOn();
+    } else if (event_trigger_q_ == kEventTriggerOff) {
+      TraceOff();
+    }
+  }
+}
+
+void VerilatorSimCtrl::Checkpoint() {
+  if (checkpoint_taken_) {
+    return;
+  }
+
+  bool at_cycle = checkpoint_cycle_ && (time_ / 2 == checkpoint_cycle_);
+  if (!at_cycle && !(checkpoint_on_event_ && event_trigger_written_)) {
+    return;
+  }
+
+  checkpoint_taken_ = true;
+  bool savable = true;
+  for (auto it = extension_array_.begin();
+       savable && it != extension_array_.end(); ++it) {
+    savable = (*it)->PreCheckpoint();
+  }
+  if (!savable || !SaveCheckpoint(checkpoint_file_)) {
+    RequestStop(false);
+    return;
+  }
+  if (checkpoint_and_stop_) {
+    RequestStop(true);
+  }
+}
+
+bool VerilatorSimCtrl::SaveCheckpoint(const std::string &filepath) {
+#if VM_SAVABLE == 1
+  VerilatedSave os;
+  os.open(filepath.c_str());
+  if (!os.isOpen()) {
+    std::cerr << "ERROR: Could not open checkpoint file `" << filepath
+              << "' for writing." << std::endl;
+    return false;
+  }
+  os << time_ << event_trigger_q_;
+  top_->save(os);
+  os.close();
+
+  std::cout << "Saved checkpoint to " << filepath << " at cycle " << time_ / 2
+            << "." << std::endl;
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool VerilatorSimCtrl::RestoreCheckpoint(const std::string &filepath) {
+#if VM_SAVABLE == 1
+  VerilatedRestore os;
+  os.open(filepath.c_str());
+  if (!os.isOpen()) {
+    std::cerr << "ERROR: Could not open checkpoint file `" << filepath
+              << "' for reading." << std::endl;
+    return false;
+  }
+  os >> time_ >> event_trigger_q_;
+  top_->restore(os);
+  os.close();
+
+  // Do not take the same checkpoint again
+  checkpoint_taken_ = true;
+  time_restored_ = time_;
+
+  std::cout << "Restored checkpoint from " << filepath << " at cycle "
+            << time_ / 2 << "." << std::endl;
+  return true;
+#else
+  return false;
+#endif
+}
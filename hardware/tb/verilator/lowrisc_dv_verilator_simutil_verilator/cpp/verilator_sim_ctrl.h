@@ -6,6 +6,7 @@
 #define OPENTITAN_HW_DV_VERILATOR_SIMUTIL_VERILATOR_CPP_VERILATOR_SIM_CTRL_H_
 
 #include <chrono>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -38,6 +39,15 @@ class VerilatorSimCtrl {
   void SetTop(VerilatedToplevel *top, CData *sig_clk, CData *sig_rst,
               VerilatorSimCtrlFlags flags = Defaults);
 
+  /**
+   * Set the signal mirroring the SoC event_trigger control register
+   *
+   * Software writes this register to mark its region of interest. It is
+   * sampled once per clock cycle and can be used to take a checkpoint or to
+   * switch tracing on (value 1) and off (value -1).
+   */
+  void SetEventTrigger(QData *sig_event_trigger);
+
   /**
    * Setup and run the simulation (all in one)
    *
@@ -122,6 +132,11 @@ class VerilatorSimCtrl {
   bool tracing_enabled_changed_;
   bool tracing_ever_enabled_;
   bool tracing_possible_;
+  unsigned long trace_start_cycle_;
+  unsigned long trace_stop_cycle_;
+  bool trace_on_event_;
+  bool in_trace_window_;
+  std::vector<std::string> trace_scopes_;
   unsigned int initial_reset_delay_cycles_;
   unsigned int reset_duration_cycles_;
   volatile unsigned int request_stop_;
@@ -131,6 +146,20 @@ class VerilatorSimCtrl {
   VerilatedTracer tracer_;
   int term_after_cycles_;
   std::vector<SimCtrlExtension *> extension_array_;
+  QData *sig_event_trigger_;
+  QData event_trigger_q_;
+  bool event_trigger_written_;
+  bool savable_possible_;
+  unsigned long checkpoint_cycle_;
+  bool checkpoint_on_event_;
+  bool checkpoint_and_stop_;
+  bool checkpoint_taken_;
+  std::string checkpoint_file_;
+  std::string restore_file_;
+  unsigned long time_restored_;
+  std::string batch_file_;
+  std::string batch_results_file_;
+  unsigned int batch_jobs_;
 
   /**
    * Default constructor
@@ -195,6 +224,13 @@ class VerilatorSimCtrl {
    */
   void PrintStatistics() const;
 
+  /**
+   * Print the CPU utilization of each simulation thread
+   *
+   * Only meaningful for models verilated with --threads N (N > 1).
+   */
+  void PrintThreadStatistics() const;
+
   /**
    * Get the file name of the trace file
    */
@@ -207,6 +243,41 @@ class VerilatorSimCtrl {
    */
   void Run();
 
+  /**
+   * Evaluate the initial blocks and prepare the first clock cycle
+   */
+  void StartSimulation();
+
+  /**
+   * Call the final blocks and close the trace
+   */
+  void FinishSimulation();
+
+  /**
+   * Toggle the clock until the simulation stops, finishes or |timeout_cycle|
+   * is reached (0 == no timeout)
+   *
+   * The reset signal is asserted during [start_reset_cycle, end_reset_cycle).
+   */
+  void RunCycles(unsigned long start_reset_cycle, unsigned long end_reset_cycle,
+                 unsigned long timeout_cycle);
+
+  /**
+   * Run every memory image listed in the batch file on the same model
+   *
+   * Before each run, the registered extensions load the new image and the
+   * design is reset. One result record per image is written to the batch
+   * results file. With more than one job, the list is split among forked
+   * copies of the model.
+   */
+  void RunBatch();
+
+  /**
+   * Run the images in |images| and write their CSV records to |results|
+   */
+  void RunBatchImages(const std::vector<std::string> &images,
+                      std::ostream &results);
+
   /**
    * Get a name for this simulation
    *
@@ -238,6 +309,46 @@ class VerilatorSimCtrl {
    * Perform tracing in Verilator if required
    */
   void Trace();
+
+  /**
+   * Sample the event trigger signal
+   *
+   * Called once per clock cycle, while the clock is low.
+   */
+  void SampleEventTrigger();
+
+  /**
+   * Switch tracing on and off at the cycle and event bounds
+   *
+   * Called once per clock cycle, while the clock is low.
+   */
+  void TraceWindow();
+
+  /**
+   * Is checkpointing support (--savable) compiled into the simulation?
+   */
+  bool SavablePossible() const { return savable_possible_; }
+
+  /**
+   * Take a checkpoint if the cycle or event condition is met
+   *
+   * Called once per clock cycle, while the clock is low.
+   */
+  void Checkpoint();
+
+  /**
+   * Write the full model state, including all memories, to |filepath|
+   *
+   * @return Return code, true == success
+   */
+  bool SaveCheckpoint(const std::string &filepath);
+
+  /**
+   * Restore the full model state from the checkpoint at |filepath|
+   *
+   * @return Return code, true == success
+   */
+  bool RestoreCheckpoint(const std::string &filepath);
 };
 
 #endif  // OPENTITAN_HW_DV_VERILATOR_SIMUTIL_VERILATOR_CPP_VERILATOR_SIM_CTRL_H_
@@ -3,6 +3,12 @@
 # Pass the option "ci" if there is no QuestaSim installed
 # Pass the name of the app to benchmark
 # If no app is passed, all the apps are benchmarked
+# Set dram_model=1 to benchmark the kernels with the DRAM timing model instead
+# of the ideal memory (configure it with dram_args="+dram_latency=...").
+# The results are then stored in *_dram.benchmark files
+# Set llc=1 to add the last-level cache in front of the memory (configure it
+# with llc_bytes=... llc_ways=...). The results are then stored in *_llc.benchmark
+# files (or *_dram_llc.benchmark files, with the DRAM timing model)
 
 ###########
 ## Setup ##
@@ -31,6 +37,19 @@ if [ -z ${config} ]; then
     fi
 fi
 
+# Realistic or ideal memory
+if [ "${dram_model}" == 1 ]; then
+    mem_suffix=_dram
+    mem_opt="dram_model=1"
+else
+    mem_suffix=""
+    mem_opt=""
+fi
+if [ "${llc}" == 1 ]; then
+    mem_suffix=${mem_suffix}_llc
+    mem_opt="${mem_opt} llc=1"
+fi
+
 tmpscript=`mktemp`
 sed "s/ ?= /=/g" config/${config}.mk > $tmpscript
 source ${tmpscript}
@@ -78,7 +97,7 @@ compile_and_run() {
   config=${config} ENV_DEFINES="-D${kernel^^}=1 $defines" \
          make -C apps/ bin/benchmarks${id_suffix} || exit
   echo "Simulating ${kernel}${id_suffix}:"
-  config=${config} make -C hardware/ -B $sim app=benchmarks ${id_opt} > $tempfile || exit
+  config=${config} make -C hardware/ -B $sim app=benchmarks ${id_opt} ${mem_opt} dram_args="${dram_args}" > $tempfile || exit
 }
 
 extract_performance() {
@@ -110,6 +129,9 @@ extract_performance() {
     echo "$python ./scripts/performance.py \"$metadata\" \"$args\" $hw_cycles >> $outfile"
     $python ./scripts/performance.py "$metadata" "$args" $hw_cycles >> $outfile || exit
   fi
+  echo "Extracting the CPI stack"
+  echo "$python ./scripts/performance.py --cpi-stack \"$metadata\" \"$args\" $tempfile >> ${outfile%.benchmark}.cpi"
+  $python ./scripts/performance.py --cpi-stack "$metadata" "$args" $tempfile >> ${outfile%.benchmark}.cpi || exit
 }
 
 extract_performance_dotp() {
@@ -212,8 +234,10 @@ matmul() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -228,12 +252,12 @@ matmul() {
 
     # Default System
     compile_and_run $kernel "$defines" $tempfile 0                                      || exit
-    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark || exit
 
     # Ideal Dispatcher System, if QuestaSim is available
     if [ "$ci" == 0 ]; then
       compile_and_run $kernel "$defines" $tempfile 1                                            || exit
-      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
       # Verify ID results is non-blocking! Check the report afterwards
       verify_id_results 0 | tee -a ${error_rpt}
     fi
@@ -254,8 +278,10 @@ conv2d() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -273,13 +299,13 @@ conv2d() {
 
       # Default System
       compile_and_run $kernel "$defines" $tempfile 0                                      || exit
-      echo "extract_performance $kernel \"$metadata 0\" \"$args\" $tempfile ${kernel}_${nr_lanes}.benchmark"
-      extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+      echo "extract_performance $kernel \"$metadata 0\" \"$args\" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark"
+      extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark || exit
 
       # Ideal Dispatcher System, if QuestaSim is available
       if [ "$ci" == 0 ]; then
         compile_and_run $kernel "$defines" $tempfile 1                                            || exit
-        extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+        extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
         # Verify ID results is non-blocking! Check the report afterwards
         verify_id_results 0 | tee -a ${error_rpt}
       fi
@@ -300,8 +326,10 @@ fconv3d() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -319,12 +347,12 @@ fconv3d() {
 
       # Default System
       compile_and_run $kernel "$defines" $tempfile 0                                      || exit
-      extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+      extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark || exit
 
       # Ideal Dispatcher System, if QuestaSim is available
       if [ "$ci" == 0 ]; then
         compile_and_run $kernel "$defines" $tempfile 1                                            || exit
-        extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+        extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
         # Verify ID results is non-blocking! Check the report afterwards
         verify_id_results 0 | tee -a ${error_rpt}
       fi
@@ -345,8 +373,10 @@ jacobi2d() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -360,12 +390,12 @@ jacobi2d() {
 
     # Default System
     compile_and_run $kernel "$defines" $tempfile 0                                      || exit
-    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark || exit
 
     # Ideal Dispatcher System, if QuestaSim is available
     if [ "$ci" == 0 ]; then
       compile_and_run $kernel "$defines" $tempfile 1                                            || exit
-      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
       # Verify ID results is non-blocking! Check the report afterwards
       verify_id_results 0 | tee -a ${error_rpt}
     fi
@@ -385,8 +415,10 @@ dropout() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -399,12 +431,12 @@ dropout() {
 
     # Default System
     compile_and_run $kernel "$defines" $tempfile 0                                || exit
-    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark || exit
 
     # Ideal Dispatcher System, if QuestaSim is available
     if [ "$ci" == 0 ]; then
       compile_and_run $kernel "$defines" $tempfile 1                                      || exit
-      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
       # Verify ID results is non-blocking! Check the report afterwards
       verify_id_results 0 | tee -a ${error_rpt}
     fi
@@ -422,8 +454,10 @@ fft() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -443,12 +477,12 @@ fft() {
 
     # Default System
     compile_and_run $kernel "$defines" $tempfile 0                                || exit
-    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark || exit
 
     # Ideal Dispatcher System, if QuestaSim is available
     if [ "$ci" == 0 ]; then
       compile_and_run $kernel "$defines" $tempfile 1                                      || exit
-      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
       # Verify ID results is non-blocking! Check the report afterwards
       verify_id_results 0 | tee -a ${error_rpt}
     fi
@@ -468,8 +502,10 @@ dwt() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -482,12 +518,12 @@ dwt() {
 
     # Default System
     compile_and_run $kernel "$defines" $tempfile 0                                || exit
-    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark || exit
 
     # Ideal Dispatcher System, if QuestaSim is available
     if [ "$ci" == 0 ]; then
       compile_and_run $kernel "$defines" $tempfile 1                                      || exit
-      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
       # Verify ID results is non-blocking! Check the report afterwards
       verify_id_results 0 | tee -a ${error_rpt}
     fi
@@ -507,8 +543,10 @@ exp() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -521,12 +559,12 @@ exp() {
 
     # Default System
     compile_and_run $kernel "$defines" $tempfile 0                                || exit
-    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark || exit
 
     # Ideal Dispatcher System, if QuestaSim is available
     if [ "$ci" == 0 ]; then
       compile_and_run $kernel "$defines" $tempfile 1                                      || exit
-      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
       # Verify ID results is non-blocking! Check the report afterwards
       verify_id_results 0 | tee -a ${error_rpt}
     fi
@@ -548,8 +586,10 @@ softmax() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -562,12 +602,12 @@ softmax() {
 
     # Default System
     compile_and_run $kernel "$defines" $tempfile 0                                || exit
-    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark || exit
 
     # Ideal Dispatcher System, if QuestaSim is available
     if [ "$ci" == 0 ]; then
       compile_and_run $kernel "$defines" $tempfile 1                                      || exit
-      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
       # Verify ID results is non-blocking! Check the report afterwards
       verify_id_results 0 | tee -a ${error_rpt}
     fi
@@ -584,8 +624,10 @@ fdotproduct() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -602,14 +644,14 @@ fdotproduct() {
 
       # Default System
       compile_and_run $kernel "$defines" $tempfile 0                                 || exit
-      extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark  || exit
-      extract_performance_dotp $kernel "$args" $sew $tempfile ${kernel}_${nr_lanes}_bar_plots.benchmark || exit
+      extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark  || exit
+      extract_performance_dotp $kernel "$args" $sew $tempfile ${kernel}_${nr_lanes}${mem_suffix}_bar_plots.benchmark || exit
 
       # Ideal Dispatcher System, if QuestaSim is available
       if [ "$ci" == 0 ]; then
         compile_and_run $kernel "$defines" $tempfile 1                                      || exit
-        extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
-        extract_performance_dotp $kernel "$args" $sew $tempfile ${kernel}_${nr_lanes}_ideal_bar_plots.benchmark || exit
+        extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
+        extract_performance_dotp $kernel "$args" $sew $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal_bar_plots.benchmark || exit
         # Verify ID results is non-blocking! Check the report afterwards
         verify_id_results 0 | tee -a ${error_rpt}
       fi
@@ -628,8 +670,10 @@ dotproduct() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -646,14 +690,14 @@ dotproduct() {
 
       # Default System
       compile_and_run $kernel "$defines" $tempfile 0                                 || exit
-      extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark  || exit
-      extract_performance_dotp $kernel "$args" $sew $tempfile ${kernel}_${nr_lanes}_bar_plots.benchmark  || exit
+      extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark  || exit
+      extract_performance_dotp $kernel "$args" $sew $tempfile ${kernel}_${nr_lanes}${mem_suffix}_bar_plots.benchmark  || exit
 
       # Ideal Dispatcher System, if QuestaSim is available
       if [ "$ci" == 0 ]; then
         compile_and_run $kernel "$defines" $tempfile 1                                      || exit
-        extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
-        extract_performance_dotp $kernel "$args" $sew $tempfile ${kernel}_${nr_lanes}_ideal_bar_plots.benchmark || exit
+        extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
+        extract_performance_dotp $kernel "$args" $sew $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal_bar_plots.benchmark || exit
         # Verify ID results is non-blocking! Check the report afterwards
         verify_id_results 0 | tee -a ${error_rpt}
       fi
@@ -676,8 +720,10 @@ pathfinder() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -691,12 +737,12 @@ pathfinder() {
 
       # Default System
       compile_and_run $kernel "$defines" $tempfile 0                                || exit
-      extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+      extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark || exit
 
       # Ideal Dispatcher System, if QuestaSim is available
       if [ "$ci" == 0 ]; then
         compile_and_run $kernel "$defines" $tempfile 1                                      || exit
-        extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+        extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
         # Verify ID results is non-blocking! Check the report afterwards
         verify_id_results 0 | tee -a ${error_rpt}
       fi
@@ -724,8 +770,10 @@ roi_align() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
   # Init error report
   echo "kernel: $kernel" >> ${error_rpt}
 
@@ -738,12 +786,12 @@ roi_align() {
 
     # Default System
     compile_and_run $kernel "$defines" $tempfile 0                                || exit
-    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark || exit
 
     # Ideal Dispatcher System, if QuestaSim is available
     if [ "$ci" == 0 ]; then
       compile_and_run $kernel "$defines" $tempfile 1                                      || exit
-      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
       # Verify ID results is non-blocking! Check the report afterwards
       verify_id_results 0 | tee -a ${error_rpt}
     fi
@@ -771,8 +819,10 @@ lavamd() {
   tempfile=`mktemp`
 
   # Log the performance results
-  > ${kernel}_${nr_lanes}.benchmark
-  > ${kernel}_${nr_lanes}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark
+  > ${kernel}_${nr_lanes}${mem_suffix}.cpi
+  > ${kernel}_${nr_lanes}${mem_suffix}_ideal.cpi
 
   for par4box in 4 8 16 32 64 96 128 256 512; do
 
@@ -783,12 +833,12 @@ lavamd() {
 
     # Default System
     compile_and_run $kernel "$defines" $tempfile 0                                || exit
-    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+    extract_performance $kernel "$metadata 0" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}.benchmark || exit
 
     # Ideal Dispatcher System, if QuestaSim is available
     if [ "$ci" == 0 ]; then
       compile_and_run $kernel "$defines" $tempfile 1                                      || exit
-      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+      extract_performance $kernel "$metadata 1" "$args" $tempfile ${kernel}_${nr_lanes}${mem_suffix}_ideal.benchmark || exit
       verify_id_results 10 $sew                                                           || exit
     fi
   done
@@ -20,6 +20,7 @@
 # Calculate throughput performance metric for a particular kernel, cycle count,
 # and environment conditions
 
+import re
 import sys
 import numpy as np
 
@@ -182,7 +183,101 @@ real_maxPerf = {
   'lavamd'     : lambda l, s : 0, # placeholder
 }
 
+# Top-down stall buckets of Ara (see ara_testharness.sv).
+# Every cycle of the runtime falls in exactly one of them.
+stallBuckets = [
+  'issue',
+  'seq-full',
+  'seq-desynch',
+  'seq-other',
+  'disp-wait-idle',
+  'disp-reshuffle',
+  'frontend',
+]
+
+# Stall events of Ara, which can overlap with each other
+stallEvents = [
+  'opreq-stall',
+  'vrf-conflict',
+  'vlsu-r-wait',
+  'vlsu-w-wait',
+  'fpu-lat-stall',
+]
+
+# Build the CPI stack of a kernel from the stall counters in its simulation log.
+# Every issue cycle accounts for one vector instruction, so that the CPI of
+# each bucket is its cycle count over the number of issued instructions.
+def cpi_stack(metadata, args, logfile):
+  counters = {}
+  with open(logfile) as log:
+    for line in log:
+      match = re.match(r'\s*\[ara-stall-([a-z-]+)\]:\s*(\d+)', line)
+      if match:
+        counters[match.group(1)] = int(match.group(2))
+
+  try:
+    cycles = sum(counters[b] for b in stallBuckets)
+    insns  = counters['issue']
+  except KeyError:
+    sys.exit('Error: no stall counters found in "' + logfile + '"')
+  if insns == 0:
+    sys.exit('Error: no vector instruction was issued in "' + logfile + '"')
+
+  try:
+    size = perfExtr[metadata[0]](args, cycles)[0]
+  except KeyError:
+    sys.exit('Error: the kernel "' + metadata[0] + '" is not valid')
+
+  # kernel, lanes, vsize, sew, ideal_disp, cycles, insns, cpi,
+  # cpi of every bucket, fraction of the cycles of every event
+  stack  = ['{:.3f}'.format(counters[b] / insns) for b in stallBuckets]
+  events = ['{:.3f}'.format(counters.get(e, 0) / cycles) for e in stallEvents]
+  print(metadata[0], metadata[1], size, metadata[3], metadata[4], cycles, insns,
+        '{:.3f}'.format(cycles / insns), *stack, *events)
+
+# Units whose in-flight cycles are counted by the testharness (see ara_testharness.sv)
+inflightUnits = [
+  'alu',
+  'mfpu',
+  'sldu',
+  'masku',
+  'vldu',
+  'vstu',
+]
+
+# IPC of a kernel, and fraction of its cycles in which every unit has an instruction in
+# flight, from the counters in its simulation log
+def ipc_inflight(logfile):
+  counters = {}
+  with open(logfile) as log:
+    for line in log:
+      match = re.match(r'\s*\[ara-(stall|inflight|nr)-([a-z-]+)\]:\s*(\d+)', line)
+      if match:
+        counters[match.group(1) + '-' + match.group(2)] = int(match.group(3))
+
+  try:
+    cycles   = sum(counters['stall-' + b] for b in stallBuckets)
+    insns    = counters['stall-issue']
+    inflight = [counters['inflight-' + u] for u in inflightUnits]
+  except KeyError:
+    sys.exit('Error: no in-flight counters found in "' + logfile + '"')
+  if cycles == 0:
+    sys.exit('Error: empty runtime in "' + logfile + '"')
+
+  # nr_vinsn, cycles, insns, ipc, in-flight fraction of every unit
+  print(counters.get('nr-vinsn', 0), cycles, insns, '{:.3f}'.format(insns / cycles),
+        *['{:.3f}'.format(c / cycles) for c in inflight])
+
 def main():
+  # CPI stack from a simulation log
+  if sys.argv[1] == '--cpi-stack':
+    cpi_stack(str(sys.argv[2]).split(), str(sys.argv[3]).split(), sys.argv[4])
+    return
+  # IPC and in-flight fractions from a simulation log
+  if sys.argv[1] == '--ipc':
+    ipc_inflight(sys.argv[2])
+    return
+
   # kernel lanes vsize sew ideal_dispatcher
   metadata    = str(sys.argv[1]).split()
   args        = str(sys.argv[2]).split()